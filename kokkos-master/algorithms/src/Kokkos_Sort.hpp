@@ -48,6 +48,8 @@
 #include <Kokkos_Core.hpp>
 
 #include <algorithm>
+#include <cstring>
+#include <functional>
 
 namespace Kokkos {
 
@@ -483,6 +485,587 @@ struct BinOp3D {
   }
 };
 
+//----------------------------------------------------------------------------
+
+namespace Impl {
+
+// Maps a key onto an unsigned integer whose natural ordering matches the
+// ordering of the key, so that the key can be sorted digit by digit.
+template <class T, class Enable = void>
+struct radix_sort_key_traits {
+  static constexpr bool is_sortable = false;
+};
+
+template <class T>
+struct radix_sort_key_traits<
+    T, typename std::enable_if<std::is_integral<T>::value &&
+                               !std::is_same<T, bool>::value>::type> {
+  static constexpr bool is_sortable = true;
+  using bits_type = typename std::make_unsigned<T>::type;
+
+  // Flip the sign bit of signed types so that negative keys come first
+  static constexpr bits_type sign_mask =
+      std::is_signed<T>::value ? bits_type(bits_type(1) << (8 * sizeof(T) - 1))
+                               : bits_type(0);
+
+  KOKKOS_INLINE_FUNCTION
+  static bits_type encode(T const& key) {
+    return bits_type(bits_type(key) ^ sign_mask);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static T decode(bits_type const& bits) { return T(bits ^ sign_mask); }
+};
+
+template <class T>
+struct radix_sort_key_traits<
+    T, typename std::enable_if<std::is_floating_point<T>::value &&
+                               (sizeof(T) == sizeof(uint32_t) ||
+                                sizeof(T) == sizeof(uint64_t))>::type> {
+  static constexpr bool is_sortable = true;
+  using bits_type = typename std::conditional<sizeof(T) == sizeof(uint32_t),
+                                              uint32_t, uint64_t>::type;
+
+  static constexpr bits_type sign_mask = bits_type(1) << (8 * sizeof(T) - 1);
+
+  // IEEE keys: flip all bits of negative values and only the sign bit of
+  // positive values.
+  KOKKOS_INLINE_FUNCTION
+  static bits_type encode(T const& key) {
+    bits_type bits;
+    std::memcpy(&bits, &key, sizeof(T));
+    return (bits & sign_mask) ? bits_type(~bits) : bits_type(bits | sign_mask);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static T decode(bits_type bits) {
+    bits = (bits & sign_mask) ? bits_type(bits ^ sign_mask) : bits_type(~bits);
+    T key;
+    std::memcpy(&key, &bits, sizeof(T));
+    return key;
+  }
+};
+
+// Least significant digit radix sort over host accessible memory. The range
+// is split into one contiguous block per thread; every pass builds a private
+// digit histogram per block, turns the histograms into scatter offsets and
+// then scatters each block stably into the second buffer.
+template <class KeyViewType>
+class RadixSortImpl {
+ public:
+  using execution_space = typename KeyViewType::execution_space;
+  using memory_space    = typename KeyViewType::memory_space;
+  using key_type        = typename KeyViewType::non_const_value_type;
+  using key_traits      = radix_sort_key_traits<key_type>;
+  using bits_type       = typename key_traits::bits_type;
+
+  enum : int { radix_bits = 8, radix_size = 1 << radix_bits };
+  enum : int { num_passes = (8 * sizeof(bits_type)) / radix_bits };
+
+  using bits_view_type  = Kokkos::View<bits_type*, memory_space>;
+  using index_view_type = Kokkos::View<size_t*, memory_space>;
+  using count_view_type =
+      Kokkos::View<size_t * [radix_size], Kokkos::LayoutRight, memory_space>;
+
+  struct encode_tag {};
+  struct count_tag {};
+  struct scatter_tag {};
+  struct decode_tag {};
+
+ private:
+  KeyViewType m_keys;
+  bits_view_type m_bits_src;
+  bits_view_type m_bits_dst;
+  index_view_type m_index_src;
+  index_view_type m_index_dst;
+  count_view_type m_counts;
+  size_t m_len;
+  size_t m_block_size;
+  size_t m_num_blocks;
+  int m_shift;
+  bool m_with_index;
+
+  KOKKOS_INLINE_FUNCTION
+  int digit(bits_type const& bits) const {
+    return int((bits >> m_shift) & bits_type(radix_size - 1));
+  }
+
+ public:
+  RadixSortImpl(KeyViewType const& keys, bool with_index)
+      : m_keys(keys),
+        m_bits_src(view_alloc(WithoutInitializing,
+                              "Kokkos::SortImpl::RadixSort::bits_a"),
+                   keys.extent(0)),
+        m_bits_dst(view_alloc(WithoutInitializing,
+                              "Kokkos::SortImpl::RadixSort::bits_b"),
+                   keys.extent(0)),
+        m_index_src(),
+        m_index_dst(),
+        m_counts(),
+        m_len(keys.extent(0)),
+        m_block_size(0),
+        m_num_blocks(0),
+        m_shift(0),
+        m_with_index(with_index) {
+    // Blocks smaller than this do not amortize their histogram
+    const size_t min_block_size = 4096;
+    const size_t concurrency    = execution_space().concurrency();
+
+    m_num_blocks = (m_len + min_block_size - 1) / min_block_size;
+    if (m_num_blocks > concurrency) m_num_blocks = concurrency;
+    if (m_num_blocks < 1) m_num_blocks = 1;
+    m_block_size = (m_len + m_num_blocks - 1) / m_num_blocks;
+
+    m_counts =
+        count_view_type(view_alloc(WithoutInitializing,
+                                   "Kokkos::SortImpl::RadixSort::counts"),
+                        m_num_blocks);
+
+    if (m_with_index) {
+      m_index_src =
+          index_view_type(view_alloc(WithoutInitializing,
+                                     "Kokkos::SortImpl::RadixSort::index_a"),
+                          m_len);
+      m_index_dst =
+          index_view_type(view_alloc(WithoutInitializing,
+                                     "Kokkos::SortImpl::RadixSort::index_b"),
+                          m_len);
+    }
+  }
+
+  // Sort the keys in place. Returns the permutation vector if it was
+  // requested at construction: entry i is the original position of the key
+  // now stored at position i.
+  index_view_type execute() {
+    using range_policy = Kokkos::RangePolicy<execution_space, encode_tag>;
+    using block_count_policy =
+        Kokkos::RangePolicy<execution_space, count_tag,
+                            Kokkos::Schedule<Kokkos::Static> >;
+    using block_scatter_policy =
+        Kokkos::RangePolicy<execution_space, scatter_tag,
+                            Kokkos::Schedule<Kokkos::Static> >;
+
+    Kokkos::parallel_for("Kokkos::Sort::RadixEncode", range_policy(0, m_len),
+                         *this);
+
+    for (int pass = 0; pass < num_passes; ++pass) {
+      m_shift = pass * radix_bits;
+
+      Kokkos::parallel_for("Kokkos::Sort::RadixCount",
+                           block_count_policy(0, m_num_blocks), *this);
+      execution_space().fence();
+
+      // Exclusive scan in digit-major, block-minor order so that each block
+      // owns a contiguous, stable output range for each digit.
+      bool skip_pass = false;
+      size_t offset  = 0;
+      for (int d = 0; d < radix_size; ++d) {
+        size_t digit_total = 0;
+        for (size_t b = 0; b < m_num_blocks; ++b) {
+          const size_t count = m_counts(b, d);
+          m_counts(b, d)     = offset;
+          offset += count;
+          digit_total += count;
+        }
+        // All keys share this digit: the pass would be the identity
+        if (digit_total == m_len) skip_pass = true;
+      }
+      if (skip_pass) continue;
+
+      Kokkos::parallel_for("Kokkos::Sort::RadixScatter",
+                           block_scatter_policy(0, m_num_blocks), *this);
+
+      std::swap(m_bits_src, m_bits_dst);
+      std::swap(m_index_src, m_index_dst);
+    }
+
+    Kokkos::parallel_for(
+        "Kokkos::Sort::RadixDecode",
+        Kokkos::RangePolicy<execution_space, decode_tag>(0, m_len), *this);
+    execution_space().fence();
+
+    return m_index_src;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const encode_tag& /*tag*/, const size_t i) const {
+    m_bits_src(i) = key_traits::encode(m_keys(i));
+    if (m_with_index) m_index_src(i) = i;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const count_tag& /*tag*/, const size_t b) const {
+    size_t counts[radix_size] = {};
+    const size_t begin        = b * m_block_size;
+    const size_t end = begin + m_block_size < m_len ? begin + m_block_size
+                                                    : m_len;
+    for (size_t i = begin; i < end; ++i) ++counts[digit(m_bits_src(i))];
+    for (int d = 0; d < radix_size; ++d) m_counts(b, d) = counts[d];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const scatter_tag& /*tag*/, const size_t b) const {
+    size_t offsets[radix_size];
+    for (int d = 0; d < radix_size; ++d) offsets[d] = m_counts(b, d);
+    const size_t begin = b * m_block_size;
+    const size_t end = begin + m_block_size < m_len ? begin + m_block_size
+                                                    : m_len;
+    for (size_t i = begin; i < end; ++i) {
+      const bits_type bits = m_bits_src(i);
+      const size_t j       = offsets[digit(bits)]++;
+      m_bits_dst(j)        = bits;
+      if (m_with_index) m_index_dst(j) = m_index_src(i);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const decode_tag& /*tag*/, const size_t i) const {
+    m_keys(i) = key_traits::decode(m_bits_src(i));
+  }
+};
+
+template <class DstViewType, class PermuteViewType, class SrcViewType>
+struct radix_sort_permute_functor {
+  using copy_op = CopyOp<DstViewType, SrcViewType>;
+
+  DstViewType dst_values;
+  PermuteViewType sort_order;
+  SrcViewType src_values;
+
+  radix_sort_permute_functor(DstViewType const& dst_values_,
+                             PermuteViewType const& sort_order_,
+                             SrcViewType const& src_values_)
+      : dst_values(dst_values_),
+        sort_order(sort_order_),
+        src_values(src_values_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const {
+    copy_op::copy(dst_values, i, src_values, sort_order(i));
+  }
+};
+
+template <class KeyViewType>
+void radix_sort_check_keys() {
+  static_assert(KeyViewType::Rank == 1,
+                "Kokkos::Experimental::radix_sort requires a rank 1 key View");
+  static_assert(
+      radix_sort_key_traits<
+          typename KeyViewType::non_const_value_type>::is_sortable,
+      "Kokkos::Experimental::radix_sort requires integral or IEEE floating "
+      "point keys");
+  static_assert(
+      Kokkos::Impl::MemorySpaceAccess<
+          Kokkos::HostSpace, typename KeyViewType::memory_space>::accessible,
+      "Kokkos::Experimental::radix_sort requires host accessible keys");
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+// Sort the keys in ascending order with a parallel LSD radix sort.
+template <class KeyViewType>
+void radix_sort(KeyViewType const& keys) {
+  Kokkos::Impl::radix_sort_check_keys<KeyViewType>();
+  if (keys.extent(0) < 2) return;
+  Kokkos::Impl::RadixSortImpl<KeyViewType>(keys, false).execute();
+}
+
+// Sort the keys in ascending order and apply the same (stable) permutation
+// to the first dimension of values.
+template <class KeyViewType, class ValuesViewType>
+void radix_sort(KeyViewType const& keys, ValuesViewType const& values) {
+  Kokkos::Impl::radix_sort_check_keys<KeyViewType>();
+  using execution_space = typename KeyViewType::execution_space;
+  using scratch_view_type =
+      Kokkos::View<typename ValuesViewType::data_type,
+                   typename ValuesViewType::array_layout,
+                   typename ValuesViewType::device_type>;
+
+  const size_t len = keys.extent(0);
+  if (values.extent(0) != len) {
+    Kokkos::abort("radix_sort: values length != keys length");
+  }
+  if (len < 2) return;
+
+  auto sort_order =
+      Kokkos::Impl::RadixSortImpl<KeyViewType>(keys, true).execute();
+
+  scratch_view_type sorted_values(
+      view_alloc(WithoutInitializing,
+                 "Kokkos::SortImpl::RadixSort::sorted_values"),
+      values.layout());
+
+  Kokkos::parallel_for(
+      "Kokkos::Sort::RadixPermute",
+      Kokkos::RangePolicy<execution_space>(0, len),
+      Kokkos::Impl::radix_sort_permute_functor<scratch_view_type,
+                                       decltype(sort_order), ValuesViewType>(
+          sorted_values, sort_order, values));
+  Kokkos::deep_copy(values, sorted_values);
+}
+
+}  // namespace Experimental
+
+//----------------------------------------------------------------------------
+
+namespace Impl {
+
+// Orders key/value pairs by key only, so that a stable sort of the pairs is
+// a stable sort by key.
+template <class Compare>
+struct merge_sort_key_compare {
+  Compare comp;
+
+  explicit merge_sort_key_compare(Compare const& comp_) : comp(comp_) {}
+
+  template <class PairType>
+  bool operator()(PairType const& a, PairType const& b) const {
+    return comp(a.first, b.first);
+  }
+};
+
+// Number of elements taken from the run a before the merge path of the runs
+// a and b crosses diagonal d. Ties are taken from a first, which keeps the
+// merge stable.
+template <class T, class Compare>
+size_t merge_path_split(T const* a, size_t len_a, T const* b, size_t len_b,
+                        size_t d, Compare const& comp) {
+  size_t lo = d > len_b ? d - len_b : 0;
+  size_t hi = d < len_a ? d : len_a;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (comp(b[d - mid - 1], a[mid])) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+// Parallel stable merge sort of a contiguous host array. Every thread first
+// sorts one contiguous run; runs are then merged pairwise, each pass cutting
+// the output into one equal segment per thread by merge path partitioning so
+// that the load is balanced regardless of the key distribution.
+template <class ExecutionSpace, class T, class Compare>
+class MergeSortImpl {
+ public:
+  using execution_space = ExecutionSpace;
+
+  struct run_tag {};
+  struct merge_tag {};
+
+ private:
+  T* m_src;
+  T* m_dst;
+  size_t m_len;
+  size_t m_num_segments;
+  size_t m_segment_size;
+  size_t m_width;
+  Compare m_comp;
+
+ public:
+  MergeSortImpl(T* data, T* scratch, size_t len, Compare const& comp)
+      : m_src(data),
+        m_dst(scratch),
+        m_len(len),
+        m_num_segments(0),
+        m_segment_size(0),
+        m_width(0),
+        m_comp(comp) {
+    // Segments smaller than this are not worth a thread
+    const size_t min_segment_size = 2048;
+    const size_t concurrency      = execution_space().concurrency();
+
+    m_num_segments = (m_len + min_segment_size - 1) / min_segment_size;
+    if (m_num_segments > concurrency) m_num_segments = concurrency;
+    if (m_num_segments < 1) m_num_segments = 1;
+    m_segment_size = (m_len + m_num_segments - 1) / m_num_segments;
+  }
+
+  // Returns the array, data or scratch, holding the sorted sequence
+  T* execute() {
+    using run_policy = Kokkos::RangePolicy<execution_space, run_tag,
+                                           Kokkos::Schedule<Kokkos::Static> >;
+    using merge_policy =
+        Kokkos::RangePolicy<execution_space, merge_tag,
+                            Kokkos::Schedule<Kokkos::Static> >;
+
+    Kokkos::parallel_for("Kokkos::Sort::MergeRuns",
+                         run_policy(0, m_num_segments), *this);
+
+    for (m_width = m_segment_size; m_width < m_len; m_width *= 2) {
+      Kokkos::parallel_for("Kokkos::Sort::MergePass",
+                           merge_policy(0, m_num_segments), *this);
+      std::swap(m_src, m_dst);
+    }
+    execution_space().fence();
+
+    return m_src;
+  }
+
+  void operator()(const run_tag& /*tag*/, const size_t s) const {
+    const size_t begin = s * m_segment_size;
+    const size_t end   = std::min(begin + m_segment_size, m_len);
+    if (begin < end) std::stable_sort(m_src + begin, m_src + end, m_comp);
+  }
+
+  void operator()(const merge_tag& /*tag*/, const size_t s) const {
+    const size_t out_begin = s * m_segment_size;
+    const size_t out_end   = std::min(out_begin + m_segment_size, m_len);
+
+    // Visit every pair of runs overlapping this output segment
+    size_t pair_begin = (out_begin / (2 * m_width)) * (2 * m_width);
+    for (; pair_begin < out_end; pair_begin += 2 * m_width) {
+      const size_t mid      = std::min(pair_begin + m_width, m_len);
+      const size_t pair_end = std::min(pair_begin + 2 * m_width, m_len);
+      const T* a            = m_src + pair_begin;
+      const T* b            = m_src + mid;
+      const size_t len_a    = mid - pair_begin;
+      const size_t len_b    = pair_end - mid;
+      const size_t d_begin  = std::max(out_begin, pair_begin) - pair_begin;
+      const size_t d_end    = std::min(out_end, pair_end) - pair_begin;
+      const size_t ia_begin =
+          merge_path_split(a, len_a, b, len_b, d_begin, m_comp);
+      const size_t ia_end = merge_path_split(a, len_a, b, len_b, d_end, m_comp);
+
+      std::merge(a + ia_begin, a + ia_end, b + (d_begin - ia_begin),
+                 b + (d_end - ia_end), m_dst + pair_begin + d_begin, m_comp);
+    }
+  }
+};
+
+template <class ExecutionSpace, class T, class Compare>
+T* parallel_merge_sort(T* data, T* scratch, size_t len, Compare const& comp) {
+  return MergeSortImpl<ExecutionSpace, T, Compare>(data, scratch, len, comp)
+      .execute();
+}
+
+template <class KeyViewType, class ValuesViewType, class PairViewType>
+struct merge_sort_zip_functor {
+  KeyViewType keys;
+  ValuesViewType values;
+  PairViewType pairs;
+  bool unzip;
+
+  merge_sort_zip_functor(KeyViewType const& keys_,
+                         ValuesViewType const& values_,
+                         PairViewType const& pairs_, bool unzip_)
+      : keys(keys_), values(values_), pairs(pairs_), unzip(unzip_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const {
+    if (unzip) {
+      keys(i)   = pairs(i).first;
+      values(i) = pairs(i).second;
+    } else {
+      pairs(i).first  = keys(i);
+      pairs(i).second = values(i);
+    }
+  }
+};
+
+template <class ViewType>
+void merge_sort_check_view() {
+  static_assert(ViewType::Rank == 1,
+                "Kokkos::Experimental::merge_sort requires rank 1 Views");
+  static_assert(
+      Kokkos::Impl::MemorySpaceAccess<
+          Kokkos::HostSpace, typename ViewType::memory_space>::accessible,
+      "Kokkos::Experimental::merge_sort requires host accessible Views");
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+// Stable sort of view with respect to the strict weak ordering comp, which
+// is called on the host as comp(const value_type&, const value_type&).
+template <class ViewType, class Compare>
+void merge_sort(ViewType const& view, Compare const& comp) {
+  Kokkos::Impl::merge_sort_check_view<ViewType>();
+  using execution_space = typename ViewType::execution_space;
+  using value_type      = typename ViewType::non_const_value_type;
+  using scratch_view_type =
+      Kokkos::View<value_type*, typename ViewType::memory_space>;
+
+  const size_t len = view.extent(0);
+  if (len < 2) return;
+
+  scratch_view_type buffer_a(
+      view_alloc(WithoutInitializing, "Kokkos::SortImpl::MergeSort::buffer_a"),
+      len);
+  scratch_view_type buffer_b(
+      view_alloc(WithoutInitializing, "Kokkos::SortImpl::MergeSort::buffer_b"),
+      len);
+  Kokkos::deep_copy(buffer_a, view);
+
+  value_type* sorted = Kokkos::Impl::parallel_merge_sort<execution_space>(
+      buffer_a.data(), buffer_b.data(), len, comp);
+
+  Kokkos::deep_copy(view, sorted == buffer_a.data() ? buffer_a : buffer_b);
+}
+
+template <class ViewType>
+void merge_sort(ViewType const& view) {
+  merge_sort(view, std::less<typename ViewType::non_const_value_type>());
+}
+
+// Stable sort of keys with respect to comp, applying the same permutation to
+// values.
+template <class KeyViewType, class ValuesViewType, class Compare>
+void sort_by_key(KeyViewType const& keys, ValuesViewType const& values,
+                 Compare const& comp) {
+  Kokkos::Impl::merge_sort_check_view<KeyViewType>();
+  Kokkos::Impl::merge_sort_check_view<ValuesViewType>();
+  using execution_space = typename KeyViewType::execution_space;
+  using pair_type =
+      Kokkos::pair<typename KeyViewType::non_const_value_type,
+                   typename ValuesViewType::non_const_value_type>;
+  using scratch_view_type =
+      Kokkos::View<pair_type*, typename KeyViewType::memory_space>;
+  using zip_functor =
+      Kokkos::Impl::merge_sort_zip_functor<KeyViewType, ValuesViewType,
+                                           scratch_view_type>;
+
+  const size_t len = keys.extent(0);
+  if (values.extent(0) != len) {
+    Kokkos::abort("sort_by_key: values length != keys length");
+  }
+  if (len < 2) return;
+
+  scratch_view_type buffer_a(
+      view_alloc(WithoutInitializing, "Kokkos::SortImpl::MergeSort::buffer_a"),
+      len);
+  scratch_view_type buffer_b(
+      view_alloc(WithoutInitializing, "Kokkos::SortImpl::MergeSort::buffer_b"),
+      len);
+
+  Kokkos::parallel_for("Kokkos::Sort::MergeZip",
+                       Kokkos::RangePolicy<execution_space>(0, len),
+                       zip_functor(keys, values, buffer_a, false));
+
+  pair_type* sorted = Kokkos::Impl::parallel_merge_sort<execution_space>(
+      buffer_a.data(), buffer_b.data(), len,
+      Kokkos::Impl::merge_sort_key_compare<Compare>(comp));
+
+  Kokkos::parallel_for(
+      "Kokkos::Sort::MergeUnzip", Kokkos::RangePolicy<execution_space>(0, len),
+      zip_functor(keys, values,
+                  sorted == buffer_a.data() ? buffer_a : buffer_b, true));
+  execution_space().fence();
+}
+
+template <class KeyViewType, class ValuesViewType>
+void sort_by_key(KeyViewType const& keys, ValuesViewType const& values) {
+  sort_by_key(keys, values,
+              std::less<typename KeyViewType::non_const_value_type>());
+}
+
+}  // namespace Experimental
+
 namespace Impl {
 
 template <class ViewType>
@@ -501,6 +1084,44 @@ bool try_std_sort(ViewType view) {
   return possible;
 }
 
+// Below this length std::sort beats the fixed cost of the histogram passes
+constexpr size_t radix_sort_min_length = 1 << 15;
+
+template <class ViewType>
+bool try_radix_sort(ViewType const& /*view*/, std::false_type) {
+  return false;
+}
+
+template <class ViewType>
+bool try_radix_sort(ViewType const& view, std::true_type) {
+  if (view.extent(0) < radix_sort_min_length) return false;
+  Kokkos::Experimental::radix_sort(view);
+  return true;
+}
+
+// The radix passes run host code (std::memcpy of the keys), so take them
+// only when the View's execution space runs on the host; a host accessible
+// View of a device execution space, e.g. UVM, keeps the BinSort path
+template <class ViewType>
+bool try_radix_sort(ViewType const& view) {
+  using value_type      = typename ViewType::non_const_value_type;
+  using execution_space = typename ViewType::execution_space;
+  return try_radix_sort(
+      view,
+      std::integral_constant<
+          bool,
+          Kokkos::is_view<ViewType>::value && (ViewType::Rank == 1) &&
+              radix_sort_key_traits<value_type>::is_sortable &&
+              Kokkos::Impl::MemorySpaceAccess<
+                  Kokkos::HostSpace,
+                  typename ViewType::memory_space>::accessible &&
+              Kokkos::Impl::SpaceAccessibility<
+                  Kokkos::HostSpace,
+                  typename execution_space::memory_space>::accessible &&
+              Kokkos::Impl::SpaceAccessibility<execution_space,
+                                               Kokkos::HostSpace>::accessible>());
+}
+
 template <class ViewType>
 struct min_max_functor {
   using minmax_scalar =
@@ -521,6 +1142,7 @@ struct min_max_functor {
 template <class ViewType>
 void sort(ViewType const& view, bool const always_use_kokkos_sort = false) {
   if (!always_use_kokkos_sort) {
+    if (Impl::try_radix_sort(view)) return;
     if (Impl::try_std_sort(view)) return;
   }
   using CompType = BinOp1D<ViewType>;
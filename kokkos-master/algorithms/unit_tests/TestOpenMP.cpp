@@ -57,6 +57,10 @@ namespace Test {
 
 TEST(openmp, SortIssue1160) { Impl::test_issue_1160_sort<Kokkos::OpenMP>(); }
 
+TEST(openmp, RadixSort) { Impl::test_radix_sort<Kokkos::OpenMP>(100003); }
+
+TEST(openmp, MergeSort) { Impl::test_merge_sort<Kokkos::OpenMP>(100003); }
+
 }  // namespace Test
 #else
 void KOKKOS_ALGORITHMS_UNITTESTS_TESTOPENMP_PREVENT_LINK_ERROR() {}
@@ -78,6 +78,10 @@ SERIAL_RANDOM_XORSHIFT64(10240000)
 SERIAL_RANDOM_XORSHIFT1024(10130144)
 SERIAL_SORT_UNSIGNED(171)
 
+TEST(serial, RadixSort) { Impl::test_radix_sort<Kokkos::Serial>(100003); }
+
+TEST(serial, MergeSort) { Impl::test_merge_sort<Kokkos::Serial>(100003); }
+
 #undef SERIAL_RANDOM_XORSHIFT64
 #undef SERIAL_RANDOM_XORSHIFT1024
 #undef SERIAL_SORT_UNSIGNED
@@ -345,6 +345,128 @@ void test_issue_1160_impl() {
 
 //----------------------------------------------------------------------------
 
+template <class ExecutionSpace, typename KeyType>
+void test_radix_sort_impl(unsigned int n) {
+  using KeyViewType   = Kokkos::View<KeyType*, ExecutionSpace>;
+  using ValueViewType = Kokkos::View<unsigned int*, ExecutionSpace>;
+
+  KeyViewType keys("Keys", n);
+  KeyViewType keys_orig("KeysOrig", n);
+  ValueViewType values("Values", n);
+
+  // Few distinct keys, including negative ones for signed and floating point
+  // types, so that stability is exercised as well.
+  auto h_keys   = Kokkos::create_mirror_view(keys);
+  auto h_values = Kokkos::create_mirror_view(values);
+  for (unsigned int i = 0; i < n; ++i) {
+    const unsigned int r = (i * 2654435761u) % 1021;
+    h_keys(i) = std::is_signed<KeyType>::value ? KeyType(KeyType(r) - 510)
+                                               : KeyType(r);
+    if (std::is_floating_point<KeyType>::value) h_keys(i) /= KeyType(8);
+    h_values(i) = i;
+  }
+  Kokkos::deep_copy(keys, h_keys);
+  Kokkos::deep_copy(keys_orig, h_keys);
+  Kokkos::deep_copy(values, h_values);
+
+  Kokkos::Experimental::radix_sort(keys, values);
+
+  auto h_keys_orig = Kokkos::create_mirror_view(keys_orig);
+  Kokkos::deep_copy(h_keys_orig, keys_orig);
+  Kokkos::deep_copy(h_keys, keys);
+  Kokkos::deep_copy(h_values, values);
+
+  unsigned int sort_fails = 0;
+  for (unsigned int i = 0; i < n; ++i) {
+    if (h_keys(i) != h_keys_orig(h_values(i))) sort_fails++;
+    if (i + 1 < n) {
+      if (h_keys(i + 1) < h_keys(i)) sort_fails++;
+      if (h_keys(i + 1) == h_keys(i) && h_values(i + 1) < h_values(i))
+        sort_fails++;
+    }
+  }
+  ASSERT_EQ(sort_fails, 0u);
+
+  // Keys only, including the all equal case
+  Kokkos::deep_copy(keys, keys_orig);
+  Kokkos::Experimental::radix_sort(keys);
+  auto h_sorted = Kokkos::create_mirror_view(keys);
+  Kokkos::deep_copy(h_sorted, keys);
+  for (unsigned int i = 0; i < n; ++i) ASSERT_EQ(h_sorted(i), h_keys(i));
+
+  Kokkos::deep_copy(keys, KeyType(3));
+  Kokkos::Experimental::radix_sort(keys);
+  Kokkos::deep_copy(h_sorted, keys);
+  for (unsigned int i = 0; i < n; ++i) ASSERT_EQ(h_sorted(i), KeyType(3));
+}
+
+//----------------------------------------------------------------------------
+
+template <typename KeyType>
+struct descending_bucket_compare {
+  // Compares only the bucket of the key so that ties are frequent
+  bool operator()(KeyType const& a, KeyType const& b) const {
+    return (a / 16) > (b / 16);
+  }
+};
+
+template <class ExecutionSpace, typename KeyType>
+void test_merge_sort_impl(unsigned int n) {
+  using KeyViewType   = Kokkos::View<KeyType*, ExecutionSpace>;
+  using ValueViewType = Kokkos::View<unsigned int*, ExecutionSpace>;
+  using compare_type  = descending_bucket_compare<KeyType>;
+
+  KeyViewType keys("Keys", n);
+  ValueViewType values("Values", n);
+
+  auto h_keys      = Kokkos::create_mirror_view(keys);
+  auto h_values    = Kokkos::create_mirror_view(values);
+  auto h_keys_orig = Kokkos::create_mirror(keys);
+  for (unsigned int i = 0; i < n; ++i) {
+    h_keys(i)      = KeyType((i * 2654435761u) % 4093);
+    h_keys_orig(i) = h_keys(i);
+    h_values(i)    = i;
+  }
+  Kokkos::deep_copy(keys, h_keys);
+  Kokkos::deep_copy(values, h_values);
+
+  Kokkos::Experimental::sort_by_key(keys, values, compare_type());
+
+  Kokkos::deep_copy(h_keys, keys);
+  Kokkos::deep_copy(h_values, values);
+
+  compare_type comp;
+  unsigned int sort_fails = 0;
+  for (unsigned int i = 0; i < n; ++i) {
+    if (h_keys(i) != h_keys_orig(h_values(i))) sort_fails++;
+    if (i + 1 < n) {
+      if (comp(h_keys(i + 1), h_keys(i))) sort_fails++;
+      if (!comp(h_keys(i), h_keys(i + 1)) && h_values(i + 1) < h_values(i))
+        sort_fails++;
+    }
+  }
+  ASSERT_EQ(sort_fails, 0u);
+
+  // Keys only, with the default and a user comparator
+  Kokkos::deep_copy(keys, h_keys_orig);
+  Kokkos::Experimental::merge_sort(keys);
+  Kokkos::deep_copy(h_keys, keys);
+  for (unsigned int i = 0; i + 1 < n; ++i) {
+    if (h_keys(i + 1) < h_keys(i)) sort_fails++;
+  }
+  ASSERT_EQ(sort_fails, 0u);
+
+  Kokkos::deep_copy(keys, h_keys_orig);
+  Kokkos::Experimental::merge_sort(keys, std::greater<KeyType>());
+  Kokkos::deep_copy(h_keys, keys);
+  for (unsigned int i = 0; i + 1 < n; ++i) {
+    if (h_keys(i + 1) > h_keys(i)) sort_fails++;
+  }
+  ASSERT_EQ(sort_fails, 0u);
+}
+
+//----------------------------------------------------------------------------
+
 template <class ExecutionSpace, typename KeyType>
 void test_1D_sort(unsigned int N) {
   test_1D_sort_impl<ExecutionSpace, KeyType>(N * N * N, true);
@@ -366,6 +488,22 @@ void test_issue_1160_sort() {
   test_issue_1160_impl<ExecutionSpace>();
 }
 
+template <class ExecutionSpace>
+void test_radix_sort(unsigned int N) {
+  test_radix_sort_impl<ExecutionSpace, int>(N);
+  test_radix_sort_impl<ExecutionSpace, unsigned>(N);
+  test_radix_sort_impl<ExecutionSpace, int64_t>(N);
+  test_radix_sort_impl<ExecutionSpace, uint64_t>(N);
+  test_radix_sort_impl<ExecutionSpace, float>(N);
+  test_radix_sort_impl<ExecutionSpace, double>(N);
+}
+
+template <class ExecutionSpace>
+void test_merge_sort(unsigned int N) {
+  test_merge_sort_impl<ExecutionSpace, int>(N);
+  test_merge_sort_impl<ExecutionSpace, double>(N);
+}
+
 template <class ExecutionSpace, typename KeyType>
 void test_sort(unsigned int N) {
   test_1D_sort<ExecutionSpace, KeyType>(N);
@@ -78,6 +78,10 @@ THREADS_RANDOM_XORSHIFT64(10240000)
 THREADS_RANDOM_XORSHIFT1024(10130144)
 THREADS_SORT_UNSIGNED(171)
 
+TEST(threads, RadixSort) { Impl::test_radix_sort<Kokkos::Threads>(100003); }
+
+TEST(threads, MergeSort) { Impl::test_merge_sort<Kokkos::Threads>(100003); }
+
 #undef THREADS_RANDOM_XORSHIFT64
 #undef THREADS_RANDOM_XORSHIFT1024
 #undef THREADS_SORT_UNSIGNED
@@ -87,4 +87,8 @@ TEST(TEST_CATEGORY, unordered_map_performance_far) {
   Perf::run_performance_tests<Kokkos::Experimental::HIP, false>("hip-far");
 }
 
+TEST(TEST_CATEGORY, unordered_map_bulk_insert) {
+  Perf::run_bulk_insert_performance_tests<Kokkos::Experimental::HIP>();
+}
+
 }  // namespace Performance
@@ -93,12 +93,20 @@ TEST(TEST_CATEGORY, unordered_map_performance_far) {
       base_file_name.str());
 }
 
+TEST(TEST_CATEGORY, unordered_map_bulk_insert) {
+  Perf::run_bulk_insert_performance_tests<Kokkos::Experimental::HPX>();
+}
+
 TEST(TEST_CATEGORY, scatter_view) {
   std::cout << "ScatterView data-duplicated test:\n";
   Perf::test_scatter_view<Kokkos::Experimental::HPX, Kokkos::LayoutRight,
                           Kokkos::Experimental::ScatterDuplicated,
                           Kokkos::Experimental::ScatterNonAtomic>(10,
                                                                   1000 * 1000);
+  std::cout << "ScatterView write-combining buffers test:\n";
+  Perf::test_scatter_view<Kokkos::Experimental::HPX, Kokkos::LayoutRight,
+                          Kokkos::Experimental::ScatterBuffered,
+                          Kokkos::Experimental::ScatterAtomic>(10, 1000 * 1000);
   // std::cout << "ScatterView atomics test:\n";
   // Perf::test_scatter_view<Kokkos::Experimental::HPX, Kokkos::LayoutRight,
   //  Kokkos::Experimental::ScatterNonDuplicated,
@@ -102,4 +102,8 @@ TEST(threads, unordered_map_performance_far) {
   Perf::run_performance_tests<Kokkos::Threads, false>(base_file_name.str());
 }
 
+TEST(threads, unordered_map_bulk_insert) {
+  Perf::run_bulk_insert_performance_tests<Kokkos::Threads>();
+}
+
 }  // namespace Performance
@@ -251,6 +251,75 @@ void run_performance_tests(std::string const& base_file_name) {
 #endif
 }
 
+// Compare inserting a view of keys with the insert / rehash-on-failure loop
+// against a single bulk_insert call, both starting from an empty map.
+template <typename Device>
+void run_bulk_insert_performance_tests(uint32_t inserts, uint32_t collisions) {
+  using map_type   = Kokkos::UnorderedMap<uint32_t, uint32_t, Device>;
+  using view_type  = Kokkos::View<uint32_t*, Device>;
+  using range_type = Kokkos::RangePolicy<Device>;
+
+  const uint32_t unique = inserts / collisions;
+
+  view_type keys("keys", inserts);
+  view_type values("values", inserts);
+  Kokkos::parallel_for(
+      range_type(0, inserts), KOKKOS_LAMBDA(uint32_t i) {
+        keys(i)   = (i % unique) * 2654435761u;
+        values(i) = i;
+      });
+  Device().fence();
+
+  Kokkos::Timer wall_clock;
+
+  map_type retry_map;
+  int loop_count = 0;
+  wall_clock.reset();
+  uint32_t failed_count = 0;
+  do {
+    ++loop_count;
+    failed_count = 0;
+    Kokkos::parallel_reduce(
+        range_type(0, inserts),
+        KOKKOS_LAMBDA(uint32_t i, uint32_t & failed) {
+          if (retry_map.insert(keys(i), values(i)).failed()) ++failed;
+        },
+        failed_count);
+    if (failed_count > 0u) {
+      const uint32_t new_capacity = retry_map.capacity() +
+                                    ((retry_map.capacity() * 3ull) / 20u) +
+                                    failed_count / collisions;
+      retry_map.rehash(new_capacity);
+    }
+  } while (failed_count > 0u);
+  const double retry_seconds = wall_clock.seconds();
+
+  map_type bulk_map;
+  wall_clock.reset();
+  bulk_map.bulk_insert(keys, values);
+  Device().fence();
+  const double bulk_seconds = wall_clock.seconds();
+
+  std::cout << std::setw(10) << inserts << " , " << std::setw(8) << collisions
+            << " , " << std::setw(3) << loop_count << " , "
+            << std::setprecision(2) << std::fixed << std::setw(8)
+            << (1e9 * retry_seconds / inserts) << " , " << std::setw(8)
+            << (1e9 * bulk_seconds / inserts) << " , "
+            << (bulk_map.size() == retry_map.size() ? "ok" : "MISMATCH")
+            << std::endl;
+}
+
+template <typename Device>
+void run_bulk_insert_performance_tests() {
+  std::cout << "Inserts , Collisions , Retry passes , Retry ns/insert , "
+               "Bulk ns/insert , Sizes match"
+            << std::endl;
+  for (uint32_t inserts = 1u << 16; inserts <= 1u << 22; inserts <<= 2) {
+    run_bulk_insert_performance_tests<Device>(inserts, 1);
+    run_bulk_insert_performance_tests<Device>(inserts, 16);
+  }
+}
+
 }  // namespace Perf
 
 #endif  // KOKKOS_TEST_UNORDERED_MAP_PERFORMANCE_HPP
@@ -0,0 +1,478 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_HostUnorderedMap.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::HostUnorderedMap.
+
+#ifndef KOKKOS_HOST_UNORDERED_MAP_HPP
+#define KOKKOS_HOST_UNORDERED_MAP_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Functional.hpp>
+#include <Kokkos_UnorderedMap.hpp>
+
+#include <impl/Kokkos_HostUnorderedMap_impl.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class HostUnorderedMap
+/// \brief Open-addressing lookup table for host execution spaces.
+///
+/// This class offers the insert / find / erase interface of UnorderedMap
+/// with a layout tuned for CPU caches.  Keys and values live in flat arrays
+/// next to one control byte per slot which holds seven bits of the key's
+/// hash.  Slots are probed linearly in groups of 16 control bytes that are
+/// compared against the hash tag at once (with SSE2 when available), so an
+/// insert or a lookup usually touches one control cache line and one key
+/// cache line instead of walking a linked list.
+///
+/// Slots are claimed by a compare-exchange on their control byte, always
+/// at the first empty slot of the probe sequence.  A thread inserting a key
+/// therefore sees every slot that a concurrent insert of the same key may
+/// have claimed, and no key is ever stored twice.
+///
+/// Unlike UnorderedMap, insert() does not fail when the table is full.  The
+/// first thread which overflows a level allocates a level twice as large
+/// and the insert continues there, inside the running kernel.  rehash()
+/// folds all the levels back into a single one.  erase() may be called at
+/// any time; erased slots are reclaimed by clear() or rehash().
+///
+/// \tparam Key Type of keys of the lookup table; must be trivially copyable.
+///
+/// \tparam Value Type of values stored in the lookup table; must be
+///   trivially copyable.  You may use \c void here, in which case the table
+///   will be a set of keys.
+///
+/// \tparam ExecSpace A host execution space.
+///
+/// \tparam Hasher Definition of the hash function for instances of
+///   <tt>Key</tt>.  The default will calculate a bitwise hash.
+///
+/// \tparam EqualTo Definition of the equality function for instances of
+///   <tt>Key</tt>.  The default will do a bitwise equality comparison.
+///
+template <typename Key, typename Value,
+          typename ExecSpace = Kokkos::DefaultHostExecutionSpace,
+          typename Hasher    = pod_hash<Key>,
+          typename EqualTo   = pod_equal_to<Key> >
+class HostUnorderedMap {
+ public:
+  //! \name Public types and constants
+  //@{
+
+  using key_type        = Key;
+  using value_type      = Value;
+  using execution_space = typename ExecSpace::execution_space;
+  using memory_space    = Kokkos::HostSpace;
+  using hasher_type     = Hasher;
+  using equal_to_type   = EqualTo;
+  using size_type       = uint32_t;
+
+  static const bool is_set = std::is_same<void, value_type>::value;
+
+  using insert_result = UnorderedMapInsertResult;
+
+  //@}
+
+ private:
+  enum : size_type { invalid_index = ~static_cast<size_type>(0) };
+
+  enum : uint8_t {
+    ctrl_empty   = Kokkos::Impl::host_map_ctrl_empty,
+    ctrl_busy    = Kokkos::Impl::host_map_ctrl_busy,
+    ctrl_deleted = Kokkos::Impl::host_map_ctrl_deleted
+  };
+
+  // Number of groups probed in a level before moving to the next one.
+  enum : unsigned { group_width = Kokkos::Impl::host_map_group_width };
+  enum : unsigned { max_probe_groups = 8 };
+
+  using impl_value_type =
+      typename Kokkos::Impl::if_c<is_set, int, value_type>::type;
+
+  using storage_type =
+      Kokkos::Impl::HostUnorderedMapStorage<key_type, impl_value_type, is_set>;
+  using level_type = typename storage_type::level_type;
+
+  static_assert(Kokkos::Impl::SpaceAccessibility<
+                    execution_space, Kokkos::HostSpace>::accessible,
+                "HostUnorderedMap requires a host execution space");
+  static_assert(std::is_trivially_copyable<key_type>::value &&
+                    std::is_trivially_copyable<impl_value_type>::value,
+                "HostUnorderedMap requires trivially copyable keys and values");
+
+ public:
+  //! \name Public member functions
+  //@{
+
+  /// \brief Constructor
+  ///
+  /// \param capacity_hint [in] Initial guess of how many unique keys will be
+  ///   inserted into the map.  The map grows past it as needed.
+  /// \param hasher [in] Hasher function for \c Key instances.
+  /// \param equal_to [in] Equality function for \c Key instances.
+  HostUnorderedMap(size_type capacity_hint = 0,
+                   hasher_type hasher      = hasher_type(),
+                   equal_to_type equal_to  = equal_to_type())
+      : m_hasher(hasher),
+        m_equal_to(equal_to),
+        m_storage_owner(
+            std::make_shared<storage_type>(calculate_capacity(capacity_hint))),
+        m_storage(m_storage_owner.get()) {}
+
+  bool is_allocated() const { return m_storage != nullptr; }
+
+  /// \brief The number of entries in the table.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  size_type size() const {
+    return Kokkos::Impl::HostUnorderedMapCount<HostUnorderedMap>(*this).apply();
+  }
+
+  /// \brief Whether an insert failed because the table could not grow.
+  bool failed_insert() const { return m_storage->failed_insert != 0; }
+
+  void reset_failed_insert_flag() { m_storage->failed_insert = 0; }
+
+  /// \brief The number of levels currently allocated.
+  KOKKOS_INLINE_FUNCTION
+  unsigned num_levels() const {
+    unsigned n = 0;
+    while (m_storage->find_level(n) != nullptr) ++n;
+    return n;
+  }
+
+  //! Clear all entries in the table and release the overflow levels.
+  void clear() {
+    execution_space().fence();
+    for (unsigned L = 1; L < storage_type::max_levels; ++L) {
+      m_storage->release_level(L);
+    }
+    std::memset(m_storage->levels[0].ctrl, ctrl_empty,
+                m_storage->level_capacity(0));
+    m_storage->failed_insert = 0;
+  }
+
+  /// \brief Rebuild the map into a single level of at least
+  ///   \c requested_capacity slots, dropping erased entries.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  bool rehash(size_type requested_capacity = 0) {
+    const size_type curr_size = size();
+    requested_capacity =
+        (requested_capacity < curr_size) ? curr_size : requested_capacity;
+
+    // Double the table until the entries fit without an overflow level.
+    HostUnorderedMap tmp(requested_capacity, m_hasher, m_equal_to);
+    while (curr_size) {
+      Kokkos::Impl::HostUnorderedMapRehash<HostUnorderedMap> f(tmp, *this);
+      f.apply();
+      execution_space().fence();
+      const uint32_t base = tmp.m_storage->base_capacity;
+      if (tmp.num_levels() == 1 || base >= (1u << 31)) break;
+      tmp = HostUnorderedMap(base, m_hasher, m_equal_to);
+    }
+
+    *this = tmp;
+
+    return true;
+  }
+
+  /// \brief The number of slots in the currently allocated levels.
+  ///
+  /// Valid indices are in [0, capacity()).  This <i>is</i> a device
+  /// function; it may be called in a parallel kernel.
+  KOKKOS_INLINE_FUNCTION
+  size_type capacity() const {
+    return m_storage->level_offset(num_levels());
+  }
+
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.  It only fails if the table cannot grow any further.
+  ///
+  /// \param k [in] The key to attempt to insert.
+  /// \param v [in] The corresponding value to attempt to insert.  If
+  ///   using this class as a set (with Value = void), then you need not
+  ///   provide this value.
+  KOKKOS_INLINE_FUNCTION
+  insert_result insert(key_type const &k,
+                       impl_value_type const &v = impl_value_type()) const {
+    insert_result result;
+
+    const uint32_t hash = m_hasher(k);
+
+    for (unsigned L = 0;; ++L) {
+      const level_type *const level = m_storage->acquire_level(L);
+      if (level == nullptr) {
+        m_storage->failed_insert = 1;
+        return result;
+      }
+
+      const uint32_t h          = Kokkos::Impl::host_map_level_hash(hash, L);
+      const uint8_t tag         = static_cast<uint8_t>(h & 0x7Fu);
+      const uint64_t num_groups = m_storage->level_capacity(L) / group_width;
+      const uint32_t offset     = m_storage->level_offset(L);
+      const unsigned probes     = static_cast<unsigned>(
+          num_groups < max_probe_groups ? num_groups : +max_probe_groups);
+
+      uint64_t group = ((h >> 7) | (h << 25)) & (num_groups - 1);
+
+      for (unsigned p = 0; p < probes;
+           ++p, group = (group + 1) & (num_groups - 1)) {
+        result.increment_list_position();
+
+        const uint64_t base = group * group_width;
+        uint8_t *const ctrl = level->ctrl + base;
+
+        KOKKOS_NONTEMPORAL_PREFETCH_LOAD(&level->keys[base]);
+
+        while (true) {
+          // Occupied slots of a group always form a prefix, so only the
+          // slots before the first empty one can hold the key.
+          const unsigned empty = group_match(ctrl, ctrl_empty);
+          const unsigned first_empty =
+              empty ? Kokkos::Impl::bit_scan_forward(empty) : +group_width;
+          const unsigned before = (1u << first_empty) - 1u;
+
+          unsigned candidates =
+              (group_match(ctrl, tag) | group_match(ctrl, ctrl_busy)) & before;
+
+          while (candidates) {
+            const unsigned j = Kokkos::Impl::bit_scan_forward(candidates);
+            candidates &= candidates - 1u;
+
+            // Wait for a concurrent insert to publish its key.
+            uint8_t c = volatile_load(ctrl + j);
+            while (c == ctrl_busy) c = volatile_load(ctrl + j);
+
+            if (c == tag && m_equal_to(level->keys[base + j], k)) {
+              result.set_existing(offset + base + j, false);
+              return result;
+            }
+          }
+
+          if (first_empty == group_width) break;
+
+          const uint64_t slot = base + first_empty;
+          if (ctrl_cas(level->ctrl, slot, ctrl_empty, ctrl_busy)) {
+            level->keys[slot] = k;
+            if (!is_set) level->values[slot] = v;
+
+            // Do not publish the tag until key and value are in memory
+            memory_fence();
+            ctrl_cas(level->ctrl, slot, ctrl_busy, tag);
+
+            result.set_success(offset + slot);
+            return result;
+          }
+          // Lost the slot to another thread; rescan this group.
+        }
+      }
+    }
+  }
+
+  /// \brief Mark the entry of key \c k as erased.
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel, also concurrently with insert() and find().
+  KOKKOS_INLINE_FUNCTION
+  bool erase(key_type const &k) const {
+    const size_type i = find(k);
+    if (i == invalid_index) return false;
+
+    const unsigned L    = level_of(i);
+    const uint64_t slot = i - m_storage->level_offset(L);
+    uint8_t *const ctrl = m_storage->levels[L].ctrl;
+
+    const uint8_t c = volatile_load(ctrl + slot);
+    return c < ctrl_empty && ctrl_cas(ctrl, slot, c, ctrl_deleted);
+  }
+
+  /// \brief Find the given key \c k, if it exists in the table.
+  ///
+  /// \return If the key exists in the table, the index of the
+  ///   value corresponding to that key; otherwise, an invalid index.
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.
+  KOKKOS_INLINE_FUNCTION
+  size_type find(const key_type &k) const {
+    const uint32_t hash = m_hasher(k);
+
+    for (unsigned L = 0;; ++L) {
+      const level_type *const level = m_storage->find_level(L);
+      if (level == nullptr) return invalid_index;
+
+      const uint32_t h          = Kokkos::Impl::host_map_level_hash(hash, L);
+      const uint8_t tag         = static_cast<uint8_t>(h & 0x7Fu);
+      const uint64_t num_groups = m_storage->level_capacity(L) / group_width;
+      const unsigned probes     = static_cast<unsigned>(
+          num_groups < max_probe_groups ? num_groups : +max_probe_groups);
+
+      uint64_t group = ((h >> 7) | (h << 25)) & (num_groups - 1);
+
+      for (unsigned p = 0; p < probes;
+           ++p, group = (group + 1) & (num_groups - 1)) {
+        const uint64_t base       = group * group_width;
+        const uint8_t *const ctrl = level->ctrl + base;
+
+        KOKKOS_NONTEMPORAL_PREFETCH_LOAD(&level->keys[base]);
+
+        const unsigned empty = group_match(ctrl, ctrl_empty);
+        const unsigned first_empty =
+            empty ? Kokkos::Impl::bit_scan_forward(empty) : +group_width;
+
+        unsigned candidates =
+            group_match(ctrl, tag) & ((1u << first_empty) - 1u);
+        while (candidates) {
+          const unsigned j = Kokkos::Impl::bit_scan_forward(candidates);
+          candidates &= candidates - 1u;
+          if (m_equal_to(level->keys[base + j], k)) {
+            return m_storage->level_offset(L) + base + j;
+          }
+        }
+
+        // An empty slot ends the probe sequence in every level.
+        if (first_empty < group_width) return invalid_index;
+      }
+    }
+  }
+
+  /// \brief Does the key exist in the map
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.
+  KOKKOS_INLINE_FUNCTION
+  bool exists(const key_type &k) const { return valid_at(find(k)); }
+
+  /// \brief Get the value with \c i as its direct index.
+  ///
+  /// \param i [in] Index in [0, capacity()) directly into the entries.
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.
+  KOKKOS_FORCEINLINE_FUNCTION
+  typename Kokkos::Impl::if_c<is_set, impl_value_type, impl_value_type &>::type
+  value_at(size_type i) const {
+    return value_at(i, std::integral_constant<bool, is_set>());
+  }
+
+  /// \brief Get the key with \c i as its direct index.
+  ///
+  /// \param i [in] Index in [0, capacity()) directly into the entries.
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.
+  KOKKOS_FORCEINLINE_FUNCTION
+  key_type key_at(size_type i) const {
+    const unsigned L = level_of(i);
+    return m_storage->levels[L].keys[i - m_storage->level_offset(L)];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  bool valid_at(size_type i) const {
+    if (i == invalid_index) return false;
+    const unsigned L              = level_of(i);
+    const level_type *const level = m_storage->find_level(L);
+    return level != nullptr &&
+           volatile_load(level->ctrl + (i - m_storage->level_offset(L))) <
+               ctrl_empty;
+  }
+
+  //@}
+
+ private:  // private member functions
+  KOKKOS_FORCEINLINE_FUNCTION
+  unsigned level_of(size_type i) const {
+    return static_cast<unsigned>(
+        Kokkos::log2(static_cast<unsigned>(i / m_storage->base_capacity + 1u)));
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned group_match(const uint8_t *ctrl, uint8_t value) {
+    return Kokkos::Impl::host_map_group_match(ctrl, value);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static bool ctrl_cas(uint8_t *ctrl, uint64_t i, uint8_t expected,
+                       uint8_t desired) {
+    return Kokkos::Impl::host_map_ctrl_cas(ctrl, i, expected, desired);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  impl_value_type value_at(size_type, std::true_type) const { return 0; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  impl_value_type &value_at(size_type i, std::false_type) const {
+    const unsigned L = level_of(i);
+    return m_storage->levels[L].values[i - m_storage->level_offset(L)];
+  }
+
+  static uint32_t calculate_capacity(uint32_t capacity_hint) {
+    // leave 1/8 of the slots free and round up to a power of two
+    uint64_t n = capacity_hint + capacity_hint / 7u;
+    n          = n < group_width ? +group_width : n;
+    n          = n < (1ull << 31) ? n : (1ull << 31);
+    return 1u << Kokkos::Impl::integral_power_of_two_that_contains(
+                     static_cast<unsigned>(n));
+  }
+
+ private:  // private members
+  hasher_type m_hasher;
+  equal_to_type m_equal_to;
+  std::shared_ptr<storage_type> m_storage_owner;
+  storage_type *m_storage;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_HOST_UNORDERED_MAP_HPP
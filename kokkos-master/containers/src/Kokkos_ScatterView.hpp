@@ -69,6 +69,7 @@ struct ScatterMin {};
 
 struct ScatterNonDuplicated {};
 struct ScatterDuplicated {};
+struct ScatterBuffered {};
 
 struct ScatterNonAtomic {};
 struct ScatterAtomic {};
@@ -86,6 +87,13 @@ struct DefaultDuplication;
 template <typename ExecSpace, typename Duplication>
 struct DefaultContribution;
 
+// the write-combining buffers are thread-private, but flushing them into the
+// shared target races with other threads unless the space runs in serial
+template <typename ExecSpace>
+struct DefaultContribution<ExecSpace, Kokkos::Experimental::ScatterBuffered> {
+  using type = Kokkos::Experimental::ScatterAtomic;
+};
+
 #ifdef KOKKOS_ENABLE_SERIAL
 template <>
 struct DefaultDuplication<Kokkos::Serial> {
@@ -102,6 +110,11 @@ struct DefaultContribution<Kokkos::Serial,
                            Kokkos::Experimental::ScatterDuplicated> {
   using type = Kokkos::Experimental::ScatterNonAtomic;
 };
+template <>
+struct DefaultContribution<Kokkos::Serial,
+                           Kokkos::Experimental::ScatterBuffered> {
+  using type = Kokkos::Experimental::ScatterNonAtomic;
+};
 #endif
 
 #ifdef KOKKOS_ENABLE_OPENMP
@@ -713,6 +726,350 @@ struct ResetDuplicates : public ResetDuplicatesBase<ExecSpace, ValueType, Op> {
   }
 };
 
+/* DirtyBlocks -- Dirty flags for the copies of a ScatterDuplicated
+ * ScatterView, one byte per block of `block_size` entries (a 4 KiB page) of
+ * each copy. A thread only marks blocks of the copy it holds the UniqueToken
+ * id of, so no atomics are needed. Blocks that are not marked still hold the
+ * identity of the operation and are skipped by ReduceDirtyBlocks and
+ * ResetDirtyBlocks. Copy 0 is always treated as dirty, since subview() hands
+ * it out for direct writes. */
+template <typename DeviceType, typename ValueType>
+struct DirtyBlocks {
+  enum : size_t {
+    block_size = sizeof(ValueType) < 4096 ? 4096 / sizeof(ValueType) : 1
+  };
+
+  Kokkos::View<unsigned char*, DeviceType> flags;
+  size_t blocks_per_copy = 0;
+
+  DirtyBlocks() = default;
+
+  DirtyBlocks(std::string const& name, size_t copies, size_t copy_size)
+      : blocks_per_copy((copy_size + size_t(block_size) - 1) /
+                        size_t(block_size)) {
+    flags = Kokkos::View<unsigned char*, DeviceType>(name + "_dirty_blocks",
+                                                     copies * blocks_per_copy);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void mark(size_t copy, size_t offset) const {
+    unsigned char& flag =
+        flags(copy * blocks_per_copy + offset / size_t(block_size));
+    if (flag == 0) flag = 1;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION bool is_dirty(size_t copy, size_t block) const {
+    return copy == 0 || flags(copy * blocks_per_copy + block) != 0;
+  }
+
+  void mark_all() { Kokkos::deep_copy(flags, static_cast<unsigned char>(1)); }
+};
+
+/* ReduceDirtyBlocks -- ReduceDuplicates for copies tracked by DirtyBlocks.
+ * The iterates are blocks rather than entries: each combines the dirty
+ * blocks of copies [start, n) into one block of the destination, which stays
+ * in cache while the copies stream through it, and never reads the blocks a
+ * thread did not write to. */
+template <typename ExecSpace, typename ValueType, typename Op, typename Dirty>
+struct ReduceDirtyBlocks {
+  ValueType const* src;
+  ValueType* dst;
+  size_t stride;
+  size_t start;
+  size_t n;
+  Dirty dirty;
+  ReduceDirtyBlocks(ValueType const* src_in, ValueType* dst_in,
+                    size_t stride_in, size_t start_in, size_t n_in,
+                    Dirty const& dirty_in, std::string const& name)
+      : src(src_in),
+        dst(dst_in),
+        stride(stride_in),
+        start(start_in),
+        n(n_in),
+        dirty(dirty_in) {
+    parallel_for(
+        std::string("Kokkos::ScatterView::ReduceDirtyBlocks [") + name + "]",
+        RangePolicy<ExecSpace, size_t>(0, dirty.blocks_per_copy), *this);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void operator()(size_t block) const {
+    const size_t first = block * size_t(Dirty::block_size);
+    const size_t last  = stride - first < size_t(Dirty::block_size)
+                            ? stride
+                            : first + size_t(Dirty::block_size);
+    for (size_t j = start; j < n; ++j) {
+      if (!dirty.is_dirty(j, block)) continue;
+      ValueType const* const copy = src + stride * j;
+      for (size_t i = first; i < last; ++i) {
+        ScatterValue<ValueType, Op, ExecSpace,
+                     Kokkos::Experimental::ScatterNonAtomic>
+            sv(dst[i]);
+        sv.update(copy[i]);
+      }
+    }
+  }
+};
+
+/* ResetDirtyBlocks -- ResetDuplicates for the dirty blocks of copies
+ * [start, n), which are marked clean again. */
+template <typename ExecSpace, typename ValueType, typename Op, typename Dirty>
+struct ResetDirtyBlocks {
+  ValueType* data;
+  size_t stride;
+  size_t start;
+  Dirty dirty;
+  ResetDirtyBlocks(ValueType* data_in, size_t stride_in, size_t start_in,
+                   size_t n_in, Dirty const& dirty_in, std::string const& name)
+      : data(data_in), stride(stride_in), start(start_in), dirty(dirty_in) {
+    parallel_for(
+        std::string("Kokkos::ScatterView::ResetDirtyBlocks [") + name + "]",
+        RangePolicy<ExecSpace, size_t>(0,
+                                       (n_in - start) * dirty.blocks_per_copy),
+        *this);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void operator()(size_t item) const {
+    const size_t j     = start + item / dirty.blocks_per_copy;
+    const size_t block = item % dirty.blocks_per_copy;
+    if (!dirty.is_dirty(j, block)) return;
+    const size_t first = block * size_t(Dirty::block_size);
+    const size_t last  = stride - first < size_t(Dirty::block_size)
+                            ? stride
+                            : first + size_t(Dirty::block_size);
+    for (size_t i = first; i < last; ++i) {
+      ScatterValue<ValueType, Op, ExecSpace,
+                   Kokkos::Experimental::ScatterNonAtomic>
+          sv(data[stride * j + i]);
+      sv.reset();
+    }
+    dirty.flags(j * dirty.blocks_per_copy + block) = 0;
+  }
+};
+
+/* ScatterFlush -- Combine one entry of a write-combining buffer into the
+ * target array of a ScatterBuffered ScatterView. The atomic variants use the
+ * Kokkos atomic_fetch_* operations directly: the compare-exchange loops of
+ * the atomic ScatterValue<> do not terminate for a zero Min/Max/Prod target
+ * and a zero contribution. */
+template <typename ValueType, typename Op>
+struct ScatterFlush;
+
+template <typename ValueType>
+struct ScatterFlush<ValueType, Kokkos::Experimental::ScatterSum> {
+  KOKKOS_FORCEINLINE_FUNCTION static ValueType identity() {
+    return reduction_identity<ValueType>::sum();
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static void apply(
+      ValueType& dest, ValueType const& src,
+      Kokkos::Experimental::ScatterAtomic) {
+    Kokkos::atomic_add(&dest, src);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static void apply(
+      ValueType& dest, ValueType const& src,
+      Kokkos::Experimental::ScatterNonAtomic) {
+    dest += src;
+  }
+};
+
+template <typename ValueType>
+struct ScatterFlush<ValueType, Kokkos::Experimental::ScatterProd> {
+  KOKKOS_FORCEINLINE_FUNCTION static ValueType identity() {
+    return reduction_identity<ValueType>::prod();
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static void apply(
+      ValueType& dest, ValueType const& src,
+      Kokkos::Experimental::ScatterAtomic) {
+    Kokkos::atomic_mul(&dest, src);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static void apply(
+      ValueType& dest, ValueType const& src,
+      Kokkos::Experimental::ScatterNonAtomic) {
+    dest *= src;
+  }
+};
+
+template <typename ValueType>
+struct ScatterFlush<ValueType, Kokkos::Experimental::ScatterMin> {
+  KOKKOS_FORCEINLINE_FUNCTION static ValueType identity() {
+    return reduction_identity<ValueType>::min();
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static void apply(
+      ValueType& dest, ValueType const& src,
+      Kokkos::Experimental::ScatterAtomic) {
+    Kokkos::atomic_fetch_min(&dest, src);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static void apply(
+      ValueType& dest, ValueType const& src,
+      Kokkos::Experimental::ScatterNonAtomic) {
+    dest = src < dest ? src : dest;
+  }
+};
+
+template <typename ValueType>
+struct ScatterFlush<ValueType, Kokkos::Experimental::ScatterMax> {
+  KOKKOS_FORCEINLINE_FUNCTION static ValueType identity() {
+    return reduction_identity<ValueType>::max();
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static void apply(
+      ValueType& dest, ValueType const& src,
+      Kokkos::Experimental::ScatterAtomic) {
+    Kokkos::atomic_fetch_max(&dest, src);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static void apply(
+      ValueType& dest, ValueType const& src,
+      Kokkos::Experimental::ScatterNonAtomic) {
+    dest = src > dest ? src : dest;
+  }
+};
+
+/* ScatterBuffers -- The per-thread write-combining buffers of a
+ * ScatterBuffered ScatterView. Each UniqueToken id owns `slots`
+ * direct-mapped slots, and a slot caches one aligned block of `block_size`
+ * consecutive entries of the target array (one cache line) together with the
+ * index of that block. Contributions combine into the slot without atomics;
+ * the slot is flushed into the target with the Contribution policy when
+ * another block maps onto it, and all slots are flushed by FlushBuffers.
+ * Entries equal to the identity of Op are skipped when flushing, so a block
+ * that only received a few contributions costs only a few atomics. */
+template <typename DeviceType, typename ValueType, typename Op,
+          typename Contribution>
+struct ScatterBuffers {
+  using flush_type = ScatterFlush<ValueType, Op>;
+
+  enum : size_t {
+    block_size = sizeof(ValueType) < 64 ? 64 / sizeof(ValueType) : 1
+  };
+  enum : size_t { slots = 256 };
+
+  Kokkos::View<ValueType*, DeviceType> values;
+  Kokkos::View<size_t*, DeviceType> tags;  // block index + 1, 0 if unused
+
+  ScatterBuffers() = default;
+
+  ScatterBuffers(std::string const& name, size_t num_tokens)
+      : values(view_alloc(WithoutInitializing, name + "_buffers"),
+               num_tokens * size_t(slots) * size_t(block_size)),
+        tags(name + "_buffer_tags", num_tokens * size_t(slots)) {
+    ResetDuplicates<typename DeviceType::execution_space, ValueType, Op>(
+        values.data(), values.size(), name);
+  }
+
+  KOKKOS_INLINE_FUNCTION bool is_allocated() const {
+    return values.is_allocated();
+  }
+
+  /* Return the buffer entry for `offset` into the target array `data`,
+   * evicting whatever block the slot held before. The entry is only valid
+   * until the next call with the same token. */
+  KOKKOS_FORCEINLINE_FUNCTION static ValueType& get(
+      ValueType* values_ptr, size_t* tags_ptr, size_t token, ValueType* data,
+      size_t span, size_t offset) {
+    const size_t block = offset / size_t(block_size);
+    const size_t slot  = token * size_t(slots) + (block & (size_t(slots) - 1));
+    if (tags_ptr[slot] != block + 1) {
+      if (tags_ptr[slot] != 0) flush(values_ptr, tags_ptr, slot, data, span);
+      tags_ptr[slot] = block + 1;
+    }
+    return values_ptr[slot * size_t(block_size) + offset % size_t(block_size)];
+  }
+
+  KOKKOS_INLINE_FUNCTION static void flush(ValueType* values_ptr,
+                                           size_t* tags_ptr, size_t slot,
+                                           ValueType* data, size_t span) {
+    const size_t first = (tags_ptr[slot] - 1) * size_t(block_size);
+    const size_t count =
+        span - first < size_t(block_size) ? span - first : size_t(block_size);
+    ValueType* const entries  = values_ptr + slot * size_t(block_size);
+    ValueType const identity = flush_type::identity();
+    for (size_t k = 0; k < count; ++k) {
+      if (entries[k] == identity) continue;
+      flush_type::apply(data[first + k], entries[k], Contribution());
+      entries[k] = identity;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void flush(size_t slot, ValueType* data,
+                                    size_t span) const {
+    flush(values.data(), tags.data(), slot, data, span);
+  }
+
+  void reset(std::string const& name) {
+    ResetDuplicates<typename DeviceType::execution_space, ValueType, Op>(
+        values.data(), values.size(), name);
+    Kokkos::deep_copy(tags, size_t(0));
+  }
+};
+
+/* FlushBuffers -- Flush every occupied slot of a set of ScatterBuffers into
+ * the target array and mark the slots unused again. Slots of different
+ * threads may hold the same block, so this goes through the Contribution
+ * policy as well. */
+template <typename ExecSpace, typename Buffers, typename ValueType>
+struct FlushBuffers {
+  Buffers buffers;
+  ValueType* data;
+  size_t span;
+  FlushBuffers(Buffers const& buffers_in, ValueType* data_in, size_t span_in,
+               std::string const& name)
+      : buffers(buffers_in), data(data_in), span(span_in) {
+    parallel_for(
+        std::string("Kokkos::ScatterView::FlushBuffers [") + name + "]",
+        RangePolicy<ExecSpace, size_t>(0, buffers.tags.size()), *this);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void operator()(size_t slot) const {
+    if (buffers.tags(slot) == 0) return;
+    buffers.flush(slot, data, span);
+    buffers.tags(slot) = 0;
+  }
+};
+
+/* ScatterBufferedValue -- The object returned by the access operator() of a
+ * buffered ScatterAccess. It keeps the offset into the target array rather
+ * than a reference to a buffer entry and looks the slot up again for every
+ * update, so keeping it past a later access that evicts the slot cannot
+ * write into a block it no longer belongs to. The updates themselves are
+ * those of the non-atomic ScatterValue, as the slots are private to the
+ * token. */
+template <typename Buffers, typename ValueType, typename Op,
+          typename DeviceType>
+struct ScatterBufferedValue {
+  using entry_type =
+      ScatterValue<ValueType, Op, DeviceType,
+                   Kokkos::Experimental::ScatterNonAtomic>;
+
+  ValueType* values;
+  size_t* tags;
+  size_t token;
+  ValueType* data;
+  size_t span;
+  size_t offset;
+
+  KOKKOS_FORCEINLINE_FUNCTION entry_type entry() const {
+    return entry_type(Buffers::get(values, tags, token, data, span, offset));
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator+=(ValueType const& rhs) const {
+    entry() += rhs;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void operator++() const { ++entry(); }
+  KOKKOS_FORCEINLINE_FUNCTION void operator++(int) const { entry()++; }
+  KOKKOS_FORCEINLINE_FUNCTION void operator-=(ValueType const& rhs) const {
+    entry() -= rhs;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void operator--() const { --entry(); }
+  KOKKOS_FORCEINLINE_FUNCTION void operator--(int) const { entry()--; }
+  KOKKOS_FORCEINLINE_FUNCTION void operator*=(ValueType const& rhs) const {
+    entry() *= rhs;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void operator/=(ValueType const& rhs) const {
+    entry() /= rhs;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void update(ValueType const& rhs) const {
+    entry().update(rhs);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void reset() const { entry().reset(); }
+};
+
+/* Available physical memory of the host in bytes, or 0 when unknown */
+size_t scatter_view_available_memory();
+
 }  // namespace Experimental
 }  // namespace Impl
 }  // namespace Kokkos
@@ -908,6 +1265,9 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
   using internal_data_type = typename data_type_info::value_type;
   using internal_view_type =
       Kokkos::View<internal_data_type, Kokkos::LayoutRight, device_type>;
+  using dirty_type =
+      Kokkos::Impl::Experimental::DirtyBlocks<device_type,
+                                              original_value_type>;
 
   ScatterView() = default;
 
@@ -916,7 +1276,8 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
       const ScatterView<OtherDataType, Kokkos::LayoutRight, OtherDeviceType, Op,
                         ScatterDuplicated, Contribution>& other_view)
       : unique_token(other_view.unique_token),
-        internal_view(other_view.internal_view) {}
+        internal_view(other_view.internal_view),
+        dirty(other_view.dirty) {}
 
   template <typename OtherDataType, typename OtherDeviceType>
   KOKKOS_FUNCTION void operator=(
@@ -924,6 +1285,7 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
                         ScatterDuplicated, Contribution>& other_view) {
     unique_token  = other_view.unique_token;
     internal_view = other_view.internal_view;
+    dirty         = other_view.dirty;
   }
 
   template <typename RT, typename... RP>
@@ -949,14 +1311,14 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
                                            : KOKKOS_IMPL_CTOR_DEFAULT_ARG)
 
   {
-    reset();
+    initialize_duplicates();
   }
 
   template <typename... Dims>
   ScatterView(std::string const& name, Dims... dims)
       : internal_view(view_alloc(WithoutInitializing, name),
                       unique_token.size(), dims...) {
-    reset();
+    initialize_duplicates();
   }
 
   template <typename OverrideContribution = Contribution>
@@ -994,16 +1356,17 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
         "ScatterView deep_copy destination memory space not accessible");
     bool is_equal = (dest.data() == internal_view.data());
     size_t start  = is_equal ? 1 : 0;
-    Kokkos::Impl::Experimental::ReduceDuplicates<execution_space,
-                                                 original_value_type, Op>(
+    Kokkos::Impl::Experimental::ReduceDirtyBlocks<
+        execution_space, original_value_type, Op, dirty_type>(
         internal_view.data(), dest.data(), internal_view.stride(0), start,
-        internal_view.extent(0), internal_view.label());
+        internal_view.extent(0), dirty, internal_view.label());
   }
 
   void reset() {
-    Kokkos::Impl::Experimental::ResetDuplicates<execution_space,
-                                                original_value_type, Op>(
-        internal_view.data(), internal_view.size(), internal_view.label());
+    Kokkos::Impl::Experimental::ResetDirtyBlocks<
+        execution_space, original_value_type, Op, dirty_type>(
+        internal_view.data(), internal_view.stride(0), 0,
+        internal_view.extent(0), dirty, internal_view.label());
   }
   template <typename DT, typename... RP>
   void reset_except(View<DT, RP...> const& view) {
@@ -1011,10 +1374,10 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
       reset();
       return;
     }
-    Kokkos::Impl::Experimental::ResetDuplicates<execution_space,
-                                                original_value_type, Op>(
-        internal_view.data() + view.size(), internal_view.size() - view.size(),
-        internal_view.label());
+    Kokkos::Impl::Experimental::ResetDirtyBlocks<
+        execution_space, original_value_type, Op, dirty_type>(
+        internal_view.data(), internal_view.stride(0), 1,
+        internal_view.extent(0), dirty, internal_view.label());
   }
 
   void resize(const size_t n0 = 0, const size_t n1 = 0, const size_t n2 = 0,
@@ -1022,6 +1385,7 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
               const size_t n6 = 0) {
     ::Kokkos::resize(internal_view, unique_token.size(), n0, n1, n2, n3, n4, n5,
                      n6);
+    mark_all_dirty();
   }
 
   void realloc(const size_t n0 = 0, const size_t n1 = 0, const size_t n2 = 0,
@@ -1029,13 +1393,32 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
                const size_t n6 = 0) {
     ::Kokkos::realloc(internal_view, unique_token.size(), n0, n1, n2, n3, n4,
                       n5, n6);
+    mark_all_dirty();
   }
 
  protected:
   template <typename... Args>
   KOKKOS_FORCEINLINE_FUNCTION original_reference_type at(int rank,
                                                          Args... args) const {
-    return internal_view(rank, args...);
+    original_reference_type ref = internal_view(rank, args...);
+    dirty.mark(rank, size_t(&ref - internal_view.data()) -
+                         size_t(rank) * internal_view.stride(0));
+    return ref;
+  }
+
+  void initialize_duplicates() {
+    Kokkos::Impl::Experimental::ResetDuplicates<execution_space,
+                                                original_value_type, Op>(
+        internal_view.data(), internal_view.size(), internal_view.label());
+    dirty = dirty_type(internal_view.label(), internal_view.extent(0),
+                       internal_view.stride(0));
+  }
+
+  // the copies no longer hold the identity outside of the marked blocks
+  void mark_all_dirty() {
+    dirty = dirty_type(internal_view.label(), internal_view.extent(0),
+                       internal_view.stride(0));
+    dirty.mark_all();
   }
 
  protected:
@@ -1044,6 +1427,7 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
 
   unique_token_type unique_token;
   internal_view_type internal_view;
+  dirty_type dirty;
 };
 
 template <typename DataType, typename Op, typename DeviceType,
@@ -1071,6 +1455,9 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
   using internal_data_type = typename data_type_info::value_type;
   using internal_view_type =
       Kokkos::View<internal_data_type, Kokkos::LayoutLeft, device_type>;
+  using dirty_type =
+      Kokkos::Impl::Experimental::DirtyBlocks<device_type,
+                                              original_value_type>;
 
   ScatterView() = default;
 
@@ -1097,7 +1484,7 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
                    std::string("duplicated_") + original_view.label()),
         arg_N[0], arg_N[1], arg_N[2], arg_N[3], arg_N[4], arg_N[5], arg_N[6],
         arg_N[7]);
-    reset();
+    initialize_duplicates();
   }
 
   template <typename... Dims>
@@ -1123,7 +1510,7 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
     internal_view = internal_view_type(view_alloc(WithoutInitializing, name),
                                        arg_N[0], arg_N[1], arg_N[2], arg_N[3],
                                        arg_N[4], arg_N[5], arg_N[6], arg_N[7]);
-    reset();
+    initialize_duplicates();
   }
 
   template <typename OtherDataType, typename OtherDeviceType>
@@ -1131,7 +1518,8 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
       const ScatterView<OtherDataType, Kokkos::LayoutLeft, OtherDeviceType, Op,
                         ScatterDuplicated, Contribution>& other_view)
       : unique_token(other_view.unique_token),
-        internal_view(other_view.internal_view) {}
+        internal_view(other_view.internal_view),
+        dirty(other_view.dirty) {}
 
   template <typename OtherDataType, typename OtherDeviceType>
   KOKKOS_FUNCTION void operator=(
@@ -1139,6 +1527,7 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
                         ScatterDuplicated, Contribution>& other_view) {
     unique_token  = other_view.unique_token;
     internal_view = other_view.internal_view;
+    dirty         = other_view.dirty;
   }
 
   template <typename OverrideContribution = Contribution>
@@ -1181,17 +1570,18 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
     auto extent   = internal_view.extent(internal_view_type::rank - 1);
     bool is_equal = (dest.data() == internal_view.data());
     size_t start  = is_equal ? 1 : 0;
-    Kokkos::Impl::Experimental::ReduceDuplicates<execution_space,
-                                                 original_value_type, Op>(
-        internal_view.data(), dest.data(),
-        internal_view.stride(internal_view_type::rank - 1), start, extent,
+    Kokkos::Impl::Experimental::ReduceDirtyBlocks<
+        execution_space, original_value_type, Op, dirty_type>(
+        internal_view.data(), dest.data(), copy_stride(), start, extent, dirty,
         internal_view.label());
   }
 
   void reset() {
-    Kokkos::Impl::Experimental::ResetDuplicates<execution_space,
-                                                original_value_type, Op>(
-        internal_view.data(), internal_view.size(), internal_view.label());
+    Kokkos::Impl::Experimental::ResetDirtyBlocks<
+        execution_space, original_value_type, Op, dirty_type>(
+        internal_view.data(), copy_stride(), 0,
+        internal_view.extent(internal_view_type::rank - 1), dirty,
+        internal_view.label());
   }
   template <typename DT, typename... RP>
   void reset_except(View<DT, RP...> const& view) {
@@ -1199,9 +1589,10 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
       reset();
       return;
     }
-    Kokkos::Impl::Experimental::ResetDuplicates<execution_space,
-                                                original_value_type, Op>(
-        internal_view.data() + view.size(), internal_view.size() - view.size(),
+    Kokkos::Impl::Experimental::ResetDirtyBlocks<
+        execution_space, original_value_type, Op, dirty_type>(
+        internal_view.data(), copy_stride(), 1,
+        internal_view.extent(internal_view_type::rank - 1), dirty,
         internal_view.label());
   }
 
@@ -1214,6 +1605,7 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
 
     ::Kokkos::resize(internal_view, arg_N[0], arg_N[1], arg_N[2], arg_N[3],
                      arg_N[4], arg_N[5], arg_N[6], arg_N[7]);
+    mark_all_dirty();
   }
 
   void realloc(const size_t n0 = 0, const size_t n1 = 0, const size_t n2 = 0,
@@ -1225,21 +1617,213 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
 
     ::Kokkos::realloc(internal_view, arg_N[0], arg_N[1], arg_N[2], arg_N[3],
                       arg_N[4], arg_N[5], arg_N[6], arg_N[7]);
+    mark_all_dirty();
   }
 
  protected:
   template <typename... Args>
   KOKKOS_FORCEINLINE_FUNCTION original_reference_type at(int thread_id,
                                                          Args... args) const {
-    return internal_view(args..., thread_id);
+    original_reference_type ref = internal_view(args..., thread_id);
+    dirty.mark(thread_id, size_t(&ref - internal_view.data()) -
+                              size_t(thread_id) * copy_stride());
+    return ref;
+  }
+
+  // the copies are the slices along the last dimension
+  KOKKOS_FORCEINLINE_FUNCTION size_t copy_stride() const {
+    return internal_view.stride(internal_view_type::rank - 1);
+  }
+
+  void initialize_duplicates() {
+    Kokkos::Impl::Experimental::ResetDuplicates<execution_space,
+                                                original_value_type, Op>(
+        internal_view.data(), internal_view.size(), internal_view.label());
+    dirty = dirty_type(internal_view.label(),
+                       internal_view.extent(internal_view_type::rank - 1),
+                       copy_stride());
+  }
+
+  // the copies no longer hold the identity outside of the marked blocks
+  void mark_all_dirty() {
+    dirty = dirty_type(internal_view.label(),
+                       internal_view.extent(internal_view_type::rank - 1),
+                       copy_stride());
+    dirty.mark_all();
+  }
+
+ protected:
+  using unique_token_type = Kokkos::Experimental::UniqueToken<
+      execution_space, Kokkos::Experimental::UniqueTokenScope::Global>;
+
+  unique_token_type unique_token;
+  internal_view_type internal_view;
+  dirty_type dirty;
+};
+
+// buffered implementation
+// updates combine in small per-thread buffers and reach the original view
+// when a buffer slot is evicted or in contribute_into, so the memory overhead
+// is independent of the extent of the view
+template <typename DataType, typename Op, typename DeviceType, typename Layout,
+          typename Contribution>
+class ScatterView<DataType, Layout, DeviceType, Op, ScatterBuffered,
+                  Contribution> {
+ public:
+  using execution_space         = typename DeviceType::execution_space;
+  using memory_space            = typename DeviceType::memory_space;
+  using device_type             = Kokkos::Device<execution_space, memory_space>;
+  using original_view_type      = Kokkos::View<DataType, Layout, device_type>;
+  using original_value_type     = typename original_view_type::value_type;
+  using original_reference_type = typename original_view_type::reference_type;
+  friend class ScatterAccess<DataType, Op, DeviceType, Layout, ScatterBuffered,
+                             Contribution, ScatterNonAtomic>;
+  friend class ScatterAccess<DataType, Op, DeviceType, Layout, ScatterBuffered,
+                             Contribution, ScatterAtomic>;
+  template <class, class, class, class, class, class>
+  friend class ScatterView;
+
+  using buffers_type =
+      Kokkos::Impl::Experimental::ScatterBuffers<device_type,
+                                                 original_value_type, Op,
+                                                 Contribution>;
+  using buffered_value_type =
+      Kokkos::Impl::Experimental::ScatterBufferedValue<
+          buffers_type, original_value_type, Op, DeviceType>;
+
+  // evicted slots of different threads are flushed into the same blocks of
+  // the original view concurrently
+  static_assert(
+      std::is_same<Contribution, ScatterAtomic>::value ||
+          std::is_same<typename Kokkos::Impl::Experimental::DefaultContribution<
+                           execution_space, ScatterBuffered>::type,
+                       ScatterNonAtomic>::value,
+      "ScatterBuffered requires ScatterAtomic contribution on execution "
+      "spaces running more than one thread");
+
+  ScatterView() = default;
+
+  template <typename RT, typename... RP>
+  ScatterView(View<RT, RP...> const& original_view)
+      : unique_token(),
+        internal_view(original_view),
+        buffers(original_view.label(), unique_token.size()) {}
+
+  template <typename... Dims>
+  ScatterView(std::string const& name, Dims... dims)
+      : unique_token(),
+        internal_view(name, dims...),
+        buffers(name, unique_token.size()) {}
+
+  template <typename OtherDataType, typename OtherDeviceType>
+  KOKKOS_FUNCTION ScatterView(
+      const ScatterView<OtherDataType, Layout, OtherDeviceType, Op,
+                        ScatterBuffered, Contribution>& other_view)
+      : unique_token(other_view.unique_token),
+        internal_view(other_view.internal_view),
+        buffers(other_view.buffers) {}
+
+  template <typename OtherDataType, typename OtherDeviceType>
+  KOKKOS_FUNCTION void operator=(
+      const ScatterView<OtherDataType, Layout, OtherDeviceType, Op,
+                        ScatterBuffered, Contribution>& other_view) {
+    unique_token  = other_view.unique_token;
+    internal_view = other_view.internal_view;
+    buffers       = other_view.buffers;
+  }
+
+  template <typename OverrideContribution = Contribution>
+  KOKKOS_FORCEINLINE_FUNCTION
+      ScatterAccess<DataType, Op, DeviceType, Layout, ScatterBuffered,
+                    Contribution, OverrideContribution>
+      access() const {
+    return ScatterAccess<DataType, Op, DeviceType, Layout, ScatterBuffered,
+                         Contribution, OverrideContribution>(*this);
+  }
+
+  // contributions still held in the buffers are not visible here until
+  // contribute_into() has been called
+  original_view_type subview() const { return internal_view; }
+
+  KOKKOS_INLINE_FUNCTION constexpr bool is_allocated() const {
+    return internal_view.is_allocated();
+  }
+
+  template <typename DT, typename... RP>
+  void contribute_into(View<DT, RP...> const& dest) const {
+    using dest_type = View<DT, RP...>;
+    static_assert(std::is_same<typename dest_type::array_layout, Layout>::value,
+                  "ScatterView contribute destination has different layout");
+    static_assert(
+        Kokkos::Impl::VerifyExecutionCanAccessMemorySpace<
+            memory_space, typename dest_type::memory_space>::value,
+        "ScatterView contribute destination memory space not accessible");
+    flush_buffers();
+    if (dest.data() == internal_view.data()) return;
+    Kokkos::Impl::Experimental::ReduceDuplicates<execution_space,
+                                                 original_value_type, Op>(
+        internal_view.data(), dest.data(), internal_view.size(), 0, 1,
+        internal_view.label());
+  }
+
+  void reset() {
+    Kokkos::Impl::Experimental::ResetDuplicates<execution_space,
+                                                original_value_type, Op>(
+        internal_view.data(), internal_view.size(), internal_view.label());
+    buffers.reset(internal_view.label());
+  }
+  template <typename DT, typename... RP>
+  void reset_except(View<DT, RP...> const& view) {
+    if (view.data() != internal_view.data()) {
+      reset();
+      return;
+    }
+    buffers.reset(internal_view.label());
+  }
+
+  void resize(const size_t n0 = 0, const size_t n1 = 0, const size_t n2 = 0,
+              const size_t n3 = 0, const size_t n4 = 0, const size_t n5 = 0,
+              const size_t n6 = 0, const size_t n7 = 0) {
+    // pending contributions refer to offsets of the old extents
+    flush_buffers();
+    ::Kokkos::resize(internal_view, n0, n1, n2, n3, n4, n5, n6, n7);
+  }
+
+  void realloc(const size_t n0 = 0, const size_t n1 = 0, const size_t n2 = 0,
+               const size_t n3 = 0, const size_t n4 = 0, const size_t n5 = 0,
+               const size_t n6 = 0, const size_t n7 = 0) {
+    ::Kokkos::realloc(internal_view, n0, n1, n2, n3, n4, n5, n6, n7);
+    buffers.reset(internal_view.label());
+  }
+
+ protected:
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION buffered_value_type at(int rank,
+                                                     Args... args) const {
+    return buffered_value_type{
+        buffers.values.data(),
+        buffers.tags.data(),
+        size_t(rank),
+        internal_view.data(),
+        internal_view.span(),
+        size_t(&internal_view(args...) - internal_view.data())};
+  }
+
+  void flush_buffers() const {
+    Kokkos::Impl::Experimental::FlushBuffers<execution_space, buffers_type,
+                                             original_value_type>(
+        buffers, internal_view.data(), internal_view.span(),
+        internal_view.label());
   }
 
  protected:
   using unique_token_type = Kokkos::Experimental::UniqueToken<
       execution_space, Kokkos::Experimental::UniqueTokenScope::Global>;
+  using internal_view_type = original_view_type;
 
   unique_token_type unique_token;
   internal_view_type internal_view;
+  buffers_type buffers;
 };
 
 /* This object has to be separate in order to store the thread ID, which cannot
@@ -1310,6 +1894,130 @@ class ScatterAccess<DataType, Op, DeviceType, Layout, ScatterDuplicated,
   thread_id_type thread_id;
 };
 
+/* The buffered ScatterAccess holds a thread ID for the same reason. It keeps
+   its own copy of the ScatterView, so it stays valid when it outlives the
+   view it was created from, and the value_type it returns looks up the
+   thread's buffer slot when it is updated. */
+
+template <typename DataType, typename Op, typename DeviceType, typename Layout,
+          typename Contribution, typename OverrideContribution>
+class ScatterAccess<DataType, Op, DeviceType, Layout, ScatterBuffered,
+                    Contribution, OverrideContribution> {
+ public:
+  using view_type           = ScatterView<DataType, Layout, DeviceType, Op,
+                                ScatterBuffered, Contribution>;
+  using original_value_type = typename view_type::original_value_type;
+  // the buffer entries are private to the thread ID, so they never need
+  // atomics; the contribution policies apply when the buffers are flushed
+  using value_type = typename view_type::buffered_value_type;
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ScatterAccess(view_type const& view_in)
+      : view(view_in), thread_id(view_in.unique_token.acquire()) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ~ScatterAccess() {
+    if (thread_id != ~thread_id_type(0)) view.unique_token.release(thread_id);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION value_type operator()(Args... args) const {
+    return view.at(thread_id, args...);
+  }
+
+  template <typename Arg>
+  KOKKOS_FORCEINLINE_FUNCTION
+      typename std::enable_if<view_type::original_view_type::rank == 1 &&
+                                  std::is_integral<Arg>::value,
+                              value_type>::type
+      operator[](Arg arg) const {
+    return view.at(thread_id, arg);
+  }
+
+ private:
+  view_type view;
+
+  // simplify RAII by disallowing copies
+  ScatterAccess(ScatterAccess const& other) = delete;
+  ScatterAccess& operator=(ScatterAccess const& other) = delete;
+  ScatterAccess& operator=(ScatterAccess&& other) = delete;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION
+  ScatterAccess(ScatterAccess&& other)
+      : view(other.view), thread_id(other.thread_id) {
+    other.thread_id = ~thread_id_type(0);
+  }
+
+ private:
+  using unique_token_type = typename view_type::unique_token_type;
+  using thread_id_type    = typename unique_token_type::size_type;
+  thread_id_type thread_id;
+};
+
+/* ScatterStrategy -- run-time counterpart of the Duplication tags, returned
+   by scatter_strategy() */
+enum class ScatterStrategy { NonDuplicated, Duplicated, Buffered };
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Impl {
+namespace Experimental {
+
+// spaces that cannot reach host memory never consider duplication or
+// buffering, so the memory query below is not instantiated for them
+template <typename ExecSpace>
+Kokkos::Experimental::ScatterStrategy scatter_strategy(size_t, size_t,
+                                                       ExecSpace const&,
+                                                       std::false_type) {
+  return Kokkos::Experimental::ScatterStrategy::NonDuplicated;
+}
+
+template <typename ExecSpace>
+Kokkos::Experimental::ScatterStrategy scatter_strategy(size_t extent,
+                                                       size_t value_size,
+                                                       ExecSpace const& space,
+                                                       std::true_type) {
+  using Kokkos::Experimental::ScatterStrategy;
+  const size_t concurrency = space.concurrency();
+  if (concurrency <= 1) return ScatterStrategy::NonDuplicated;
+  const size_t duplicated_limit = size_t(1) << 30;
+  const size_t available        = scatter_view_available_memory();
+  const size_t limit = available != 0 && available / 8 < duplicated_limit
+                           ? available / 8
+                           : duplicated_limit;
+  if (extent * value_size <= limit / concurrency) {
+    return ScatterStrategy::Duplicated;
+  }
+  return ScatterStrategy::Buffered;
+}
+
+}  // namespace Experimental
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/* Pick a duplication strategy for a ScatterView of `extent` values of
+   `value_size` bytes each. Duplication is preferred while the copies of all
+   threads stay within an eighth of the available host memory and 1 GiB, so
+   that the final reduction over them stays cheap; larger targets use
+   ScatterBuffered. Whether the space can use anything but the original view
+   is decided at compile time from its access to HostSpace; spaces running
+   one thread use the original view as well. */
+template <typename ExecSpace = Kokkos::DefaultExecutionSpace>
+ScatterStrategy scatter_strategy(size_t extent, size_t value_size,
+                                 ExecSpace const& space = ExecSpace()) {
+  return Kokkos::Impl::Experimental::scatter_strategy(
+      extent, value_size, space,
+      std::integral_constant<bool, Kokkos::SpaceAccessibility<
+                                       ExecSpace,
+                                       Kokkos::HostSpace>::accessible>());
+}
+
 template <typename Op          = Kokkos::Experimental::ScatterSum,
           typename Duplication = void, typename Contribution = void,
           typename RT, typename... RP>
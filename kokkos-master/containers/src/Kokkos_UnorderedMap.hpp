@@ -391,6 +391,63 @@ class UnorderedMap {
     return true;
   }
 
+  /// \brief Insert all the keys of \c keys, with the matching entries of
+  ///   \c values, in one parallel pass.
+  ///
+  /// The map is first grown to hold the number of distinct keys, which is
+  /// estimated in parallel with a HyperLogLog sketch, so the inserts
+  /// usually succeed in a single pass.  Keys which still fail are
+  /// inserted again after a parallel rehash to a larger capacity.
+  /// If \c values is empty the default value is inserted with every key.
+  ///
+  /// \return The number of keys which were not already in the map.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  template <typename KeysView, typename ValuesView>
+  size_type bulk_insert(KeysView const &keys, ValuesView const &values) {
+    static_assert(is_insertable_map,
+                  "Cannot bulk_insert into a non-insertable unordered_map");
+
+    if (values.extent(0) != 0 && values.extent(0) != keys.extent(0)) {
+      throw std::runtime_error(
+          "UnorderedMap::bulk_insert: keys and values differ in length");
+    }
+    if (keys.extent(0) == 0) return 0;
+
+    // Allow for the error of the estimate before growing the map
+    Impl::UnorderedMapCardinality<declared_map_type, KeysView> cardinality(
+        m_hasher, keys);
+    const double distinct = cardinality.apply();
+
+    uint64_t required = static_cast<uint64_t>(1.05 * distinct) + 1u;
+    required = required < keys.extent(0) ? required : keys.extent(0);
+    required += size();
+    if (required > capacity()) {
+      rehash(required < invalid_index ? static_cast<size_type>(required)
+                                      : invalid_index - 1u);
+    }
+
+    using bulk_insert_type =
+        Impl::UnorderedMapBulkInsert<declared_map_type, KeysView, ValuesView>;
+
+    size_type insert_count = 0;
+    while (true) {
+      const typename bulk_insert_type::value_type result =
+          bulk_insert_type(*this, keys, values).apply();
+      insert_count += result.insert_count;
+      if (result.failed_count == 0u) break;
+      rehash(capacity() + ((capacity() * 3ull) / 20u) + result.failed_count);
+    }
+    return insert_count;
+  }
+
+  /// \brief Insert all the keys of \c keys with default values.
+  template <typename KeysView>
+  size_type bulk_insert(KeysView const &keys) {
+    return bulk_insert(keys, View<const impl_value_type *, device_type>());
+  }
+
   /// \brief The number of entries in the table.
   ///
   /// This method has undefined behavior when erasable() is true.
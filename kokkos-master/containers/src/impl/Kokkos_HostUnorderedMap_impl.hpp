@@ -0,0 +1,307 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_HOST_UNORDERED_MAP_IMPL_HPP
+#define KOKKOS_HOST_UNORDERED_MAP_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_BitOps.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+/// Control byte states of HostUnorderedMap.  A slot holding a key stores
+/// the low 7 bits of its hash (high bit clear); the other states have the
+/// high bit set so a whole group can be classified with one byte compare.
+enum : uint8_t {
+  host_map_ctrl_empty   = 0x80,
+  host_map_ctrl_busy    = 0xFE,
+  host_map_ctrl_deleted = 0xFF
+};
+
+/// Number of control bytes inspected together; one SSE2 register.
+enum : unsigned { host_map_group_width = 16 };
+
+/// Bitmask of the bytes of the group starting at \c ctrl equal to \c value.
+KOKKOS_FORCEINLINE_FUNCTION
+unsigned host_map_group_match(const uint8_t* ctrl, uint8_t value) {
+#if defined(__SSE2__) && defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+  const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+  return static_cast<unsigned>(_mm_movemask_epi8(
+      _mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(value)))));
+#else
+  unsigned mask = 0;
+  for (unsigned j = 0; j < host_map_group_width; ++j) {
+    mask |= (volatile_load(ctrl + j) == value ? 1u : 0u) << j;
+  }
+  return mask;
+#endif
+}
+
+/// Atomically replace control byte \c i from \c expected to \c desired.
+/// Control bytes are updated through a compare-exchange of the aligned word
+/// containing them, which is lock-free on every host backend.
+KOKKOS_INLINE_FUNCTION
+bool host_map_ctrl_cas(uint8_t* ctrl, uint64_t i, uint8_t expected,
+                       uint8_t desired) {
+  unsigned volatile* const word =
+      reinterpret_cast<unsigned volatile*>(ctrl + (i & ~uint64_t(3)));
+  const unsigned byte = static_cast<unsigned>(i & 3);
+
+  unsigned old_word = *word;
+  while (true) {
+    uint8_t bytes[4];
+    std::memcpy(bytes, &old_word, sizeof(unsigned));
+    if (bytes[byte] != expected) return false;
+    bytes[byte] = desired;
+    unsigned new_word;
+    std::memcpy(&new_word, bytes, sizeof(unsigned));
+    const unsigned prev = atomic_compare_exchange(word, old_word, new_word);
+    if (prev == old_word) return true;
+    old_word = prev;
+  }
+}
+
+/// Mix the 32 bit hash of a key for the given level so that keys which
+/// collided in one level are spread over the next.
+KOKKOS_FORCEINLINE_FUNCTION
+uint32_t host_map_level_hash(uint32_t h, unsigned level) {
+  if (level == 0) return h;
+  h += level * 0x9E3779B9u;
+  h ^= h >> 16;
+  h *= 0x85EBCA6Bu;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35u;
+  h ^= h >> 16;
+  return h;
+}
+
+/// Storage shared by all copies of a HostUnorderedMap.
+///
+/// The table is a sequence of levels, level \c L holding
+/// <tt>base_capacity << L</tt> slots.  Level 0 is allocated up front;
+/// the other levels are allocated by the first thread which overflows the
+/// previous one, inside the running kernel.
+template <typename Key, typename Value, bool IsSet>
+struct HostUnorderedMapStorage {
+  enum : unsigned { max_levels = 16 };
+
+  struct level_type {
+    uint8_t* volatile ctrl;
+    Key* keys;
+    Value* values;
+  };
+
+  uint32_t base_capacity;
+  unsigned num_levels;
+  level_type levels[max_levels];
+  int volatile growing[max_levels];
+  int volatile failed_insert;
+
+  explicit HostUnorderedMapStorage(uint32_t arg_base_capacity)
+      : base_capacity(arg_base_capacity), num_levels(0), failed_insert(0) {
+    // Indices of every level must fit in uint32_t below the invalid index.
+    while (num_levels < max_levels &&
+           ((uint64_t(base_capacity) << (num_levels + 1)) - base_capacity) <
+               uint64_t(~uint32_t(0))) {
+      ++num_levels;
+    }
+    for (unsigned L = 0; L < max_levels; ++L) {
+      levels[L].ctrl   = nullptr;
+      levels[L].keys   = nullptr;
+      levels[L].values = nullptr;
+      growing[L]       = 0;
+    }
+    if (!allocate_level(0)) {
+      throw std::runtime_error("HostUnorderedMap: failed to allocate table");
+    }
+    growing[0] = 1;
+  }
+
+  ~HostUnorderedMapStorage() {
+    for (unsigned L = 0; L < max_levels; ++L) release_level(L);
+  }
+
+  HostUnorderedMapStorage(const HostUnorderedMapStorage&) = delete;
+  HostUnorderedMapStorage& operator=(const HostUnorderedMapStorage&) = delete;
+
+  uint64_t level_capacity(unsigned L) const {
+    return uint64_t(base_capacity) << L;
+  }
+
+  uint32_t level_offset(unsigned L) const {
+    return static_cast<uint32_t>((uint64_t(base_capacity) << L) -
+                                 base_capacity);
+  }
+
+  bool allocate_level(unsigned L) {
+    const uint64_t n = level_capacity(L);
+    Kokkos::HostSpace space;
+    uint8_t* ctrl = nullptr;
+    try {
+      ctrl = static_cast<uint8_t*>(
+          space.allocate("HostUnorderedMap ctrl", n * sizeof(uint8_t)));
+      levels[L].keys = static_cast<Key*>(
+          space.allocate("HostUnorderedMap keys", n * sizeof(Key)));
+      if (!IsSet) {
+        levels[L].values = static_cast<Value*>(
+            space.allocate("HostUnorderedMap values", n * sizeof(Value)));
+      }
+    } catch (...) {
+      if (ctrl) space.deallocate("HostUnorderedMap ctrl", ctrl, n);
+      if (levels[L].keys) {
+        space.deallocate("HostUnorderedMap keys", levels[L].keys,
+                         n * sizeof(Key));
+      }
+      levels[L].keys = nullptr;
+      return false;
+    }
+    std::memset(ctrl, host_map_ctrl_empty, n);
+    memory_fence();
+    levels[L].ctrl = ctrl;
+    return true;
+  }
+
+  void release_level(unsigned L) {
+    if (levels[L].ctrl == nullptr) return;
+    const uint64_t n = level_capacity(L);
+    Kokkos::HostSpace space;
+    space.deallocate("HostUnorderedMap ctrl", levels[L].ctrl, n);
+    space.deallocate("HostUnorderedMap keys", levels[L].keys, n * sizeof(Key));
+    if (!IsSet) {
+      space.deallocate("HostUnorderedMap values", levels[L].values,
+                       n * sizeof(Value));
+    }
+    levels[L].ctrl   = nullptr;
+    levels[L].keys   = nullptr;
+    levels[L].values = nullptr;
+    growing[L]       = 0;
+  }
+
+  /// Level \c L, allocating it if this thread is the first to need it.
+  /// Returns nullptr once the table cannot grow any further.
+  const level_type* acquire_level(unsigned L) {
+    if (L >= num_levels) return nullptr;
+    if (volatile_load(&levels[L].ctrl) == nullptr) {
+      if (atomic_compare_exchange(&growing[L], 0, 1) == 0) {
+        if (!allocate_level(L)) {
+          memory_fence();
+          growing[L] = 2;
+          return nullptr;
+        }
+      } else {
+        while (volatile_load(&levels[L].ctrl) == nullptr) {
+          if (volatile_load(&growing[L]) == 2) return nullptr;
+        }
+      }
+      memory_fence();
+    }
+    return &levels[L];
+  }
+
+  /// Level \c L if it has been allocated, nullptr otherwise.
+  const level_type* find_level(unsigned L) const {
+    if (L >= num_levels || volatile_load(&levels[L].ctrl) == nullptr) {
+      return nullptr;
+    }
+    return &levels[L];
+  }
+};
+
+template <typename Map>
+struct HostUnorderedMapCount {
+  using execution_space = typename Map::execution_space;
+  using size_type       = typename Map::size_type;
+
+  Map m_map;
+
+  HostUnorderedMapCount(Map const& map) : m_map(map) {}
+
+  size_type apply() const {
+    size_type count = 0;
+    parallel_reduce("Kokkos::Impl::HostUnorderedMapCount::apply",
+                    RangePolicy<execution_space>(0, m_map.capacity()), *this,
+                    count);
+    return count;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i, size_type& count) const {
+    if (m_map.valid_at(i)) ++count;
+  }
+};
+
+template <typename Map>
+struct HostUnorderedMapRehash {
+  using execution_space = typename Map::execution_space;
+  using size_type       = typename Map::size_type;
+
+  Map m_dst;
+  Map m_src;
+
+  HostUnorderedMapRehash(Map const& dst, Map const& src)
+      : m_dst(dst), m_src(src) {}
+
+  void apply() const {
+    parallel_for("Kokkos::Impl::HostUnorderedMapRehash::apply",
+                 RangePolicy<execution_space>(0, m_src.capacity()), *this);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i) const {
+    if (m_src.valid_at(i)) m_dst.insert(m_src.key_at(i), m_src.value_at(i));
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // KOKKOS_HOST_UNORDERED_MAP_IMPL_HPP
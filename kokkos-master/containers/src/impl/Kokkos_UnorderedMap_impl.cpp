@@ -44,6 +44,8 @@
 
 #include <Kokkos_UnorderedMap.hpp>
 
+#include <cmath>
+
 namespace Kokkos {
 namespace Impl {
 
@@ -102,5 +104,30 @@ uint32_t find_hash_size(uint32_t size) {
   return hsize;
 }
 
+double hyperloglog_estimate(const uint32_t* registers,
+                            uint32_t num_registers) {
+  const double m     = num_registers;
+  const double two32 = 4294967296.0;
+
+  double sum     = 0.0;
+  uint32_t zeros = 0;
+  for (uint32_t j = 0; j < num_registers; ++j) {
+    sum += std::ldexp(1.0, -static_cast<int>(registers[j]));
+    if (registers[j] == 0u) ++zeros;
+  }
+
+  double estimate = (0.7213 / (1.0 + 1.079 / m)) * m * m / sum;
+
+  if (estimate <= 2.5 * m && zeros != 0u) {
+    // small range correction: linear counting
+    estimate = m * std::log(m / zeros);
+  } else if (estimate > two32 / 30.0) {
+    // large range correction for 32 bit hashes
+    const double ratio = estimate < two32 ? estimate / two32 : 0.999;
+    estimate           = -two32 * std::log(1.0 - ratio);
+  }
+  return estimate;
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
@@ -46,6 +46,7 @@
 #define KOKKOS_UNORDERED_MAP_IMPL_HPP
 
 #include <Kokkos_Core_fwd.hpp>
+#include <impl/Kokkos_BitOps.hpp>
 #include <cstdint>
 
 #include <cstdio>
@@ -58,6 +59,109 @@ namespace Impl {
 
 uint32_t find_hash_size(uint32_t size);
 
+/// Cardinality estimate of a HyperLogLog sketch with the given registers.
+double hyperloglog_estimate(const uint32_t* registers, uint32_t num_registers);
+
+/// Estimate the number of distinct keys of a view in one parallel pass with
+/// a HyperLogLog sketch of 4096 registers (about 1.6% standard error).
+template <typename Map, typename KeysView>
+struct UnorderedMapCardinality {
+  using map_type        = Map;
+  using execution_space = typename map_type::execution_space;
+  using size_type       = typename map_type::size_type;
+  using hasher_type     = typename map_type::hasher_type;
+  using registers_view  = View<uint32_t*, typename map_type::device_type>;
+
+  enum : uint32_t { index_bits = 12, num_registers = 1u << index_bits };
+
+  hasher_type m_hasher;
+  KeysView m_keys;
+  registers_view m_registers;
+
+  UnorderedMapCardinality(hasher_type const& hasher, KeysView const& keys)
+      : m_hasher(hasher),
+        m_keys(keys),
+        m_registers("UnorderedMap cardinality", num_registers) {}
+
+  double apply() const {
+    parallel_for("Kokkos::Impl::UnorderedMapCardinality::apply",
+                 RangePolicy<execution_space>(0, m_keys.extent(0)), *this);
+    auto registers =
+        create_mirror_view_and_copy(Kokkos::HostSpace(), m_registers);
+    return hyperloglog_estimate(registers.data(), num_registers);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i) const {
+    // Finalize the hash so that weak user hashers still fill all the bits
+    uint32_t h = m_hasher(m_keys(i));
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+
+    const uint32_t j = h >> (32 - index_bits);
+    const uint32_t w = h << index_bits;
+    const uint32_t rank = w ? 32u - Kokkos::log2(w) : 33u - index_bits;
+
+    if (rank > m_registers(j)) atomic_fetch_max(&m_registers(j), rank);
+  }
+};
+
+/// Insert every entry of a view of keys (and values) in one parallel pass.
+template <typename Map, typename KeysView, typename ValuesView>
+struct UnorderedMapBulkInsert {
+  using map_type        = Map;
+  using execution_space = typename map_type::execution_space;
+  using size_type       = typename map_type::size_type;
+
+  struct value_type {
+    size_type failed_count;
+    size_type insert_count;
+  };
+
+  map_type m_map;
+  KeysView m_keys;
+  ValuesView m_values;
+
+  UnorderedMapBulkInsert(map_type const& map, KeysView const& keys,
+                         ValuesView const& values)
+      : m_map(map), m_keys(keys), m_values(values) {}
+
+  value_type apply() const {
+    value_type result = {};
+    parallel_reduce("Kokkos::Impl::UnorderedMapBulkInsert::apply",
+                    RangePolicy<execution_space>(0, m_keys.extent(0)), *this,
+                    result);
+    return result;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& v) const {
+    v.failed_count = 0;
+    v.insert_count = 0;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& dst, const volatile value_type& src) const {
+    dst.failed_count += src.failed_count;
+    dst.insert_count += src.insert_count;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i, value_type& v) const {
+    const auto result = m_values.extent(0)
+                            ? m_map.insert(m_keys(i), m_values(i))
+                            : m_map.insert(m_keys(i));
+    if (result.failed()) {
+      ++v.failed_count;
+    } else if (result.success()) {
+      ++v.insert_count;
+    }
+  }
+};
+
 template <typename Map>
 struct UnorderedMapRehash {
   using map_type        = Map;
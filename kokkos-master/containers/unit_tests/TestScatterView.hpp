@@ -47,6 +47,7 @@
 
 #include <Kokkos_ScatterView.hpp>
 #include <gtest/gtest.h>
+#include <vector>
 
 namespace Test {
 
@@ -545,9 +546,67 @@ struct test_scatter_view_config {
   }
 };
 
+// touches every stride-th entry only, so that most blocks of the duplicates
+// stay clean and are skipped by contribute and reset
+template <typename DeviceType, typename Layout>
+struct test_sparse_duplicated_scatter_view {
+  using scatter_view_type =
+      Kokkos::Experimental::ScatterView<double*, Layout, DeviceType,
+                                        Kokkos::Experimental::ScatterSum,
+                                        Kokkos::Experimental::ScatterDuplicated,
+                                        Kokkos::Experimental::ScatterNonAtomic>;
+  using orig_view_type = Kokkos::View<double*, Layout, DeviceType>;
+
+  scatter_view_type scatter_view;
+  int size;
+  int stride;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    auto scatter_access = scatter_view.access();
+    scatter_access((i * stride) % size) += 1.0;
+    scatter_access((i * stride + 1) % size) += 2.0;
+  }
+
+  void run_test(int n) {
+    orig_view_type original_view("original_view", n);
+    scatter_view = Kokkos::Experimental::create_scatter_view<
+        Kokkos::Experimental::ScatterSum,
+        Kokkos::Experimental::ScatterDuplicated,
+        Kokkos::Experimental::ScatterNonAtomic>(original_view);
+    size   = n;
+    stride = 1031;
+    int const count = (n + stride - 1) / stride;
+    for (int pass = 0; pass < 2; ++pass) {
+      Kokkos::parallel_for(
+          Kokkos::RangePolicy<typename DeviceType::execution_space, int>(
+              0, count),
+          *this);
+      Kokkos::Experimental::contribute(original_view, scatter_view);
+      scatter_view.reset_except(original_view);
+    }
+    auto host_view =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), original_view);
+    std::vector<double> expected(n, 0.0);
+    for (int i = 0; i < count; ++i) {
+      expected[(i * stride) % n] += 2.0;
+      expected[(i * stride + 1) % n] += 4.0;
+    }
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(host_view(i), expected[i]);
+    }
+  }
+};
+
 template <typename DeviceType, typename ScatterType, typename NumberType>
 struct TestDuplicatedScatterView {
   TestDuplicatedScatterView(int n) {
+    if (std::is_same<ScatterType, Kokkos::Experimental::ScatterSum>::value) {
+      test_sparse_duplicated_scatter_view<DeviceType, Kokkos::LayoutRight>()
+          .run_test(n);
+      test_sparse_duplicated_scatter_view<DeviceType, Kokkos::LayoutLeft>()
+          .run_test(n);
+    }
     // ScatterSum test
     test_scatter_view_config<DeviceType, Kokkos::LayoutRight,
                              Kokkos::Experimental::ScatterDuplicated,
@@ -563,6 +622,61 @@ struct TestDuplicatedScatterView {
   }
 };
 
+// An update through a value kept past a later access that evicts its buffer
+// slot still reaches the entry it was taken for
+template <typename DeviceType, typename NumberType>
+void test_buffered_scatter_eviction(Kokkos::Experimental::ScatterSum) {
+  using execution_space = typename DeviceType::execution_space;
+  using contribution_type =
+      typename Kokkos::Impl::Experimental::DefaultContribution<
+          execution_space, Kokkos::Experimental::ScatterBuffered>::type;
+  using scatter_view_type = Kokkos::Experimental::ScatterView<
+      NumberType*, Kokkos::LayoutRight, DeviceType,
+      Kokkos::Experimental::ScatterSum, Kokkos::Experimental::ScatterBuffered,
+      contribution_type>;
+  const size_t same_slot = size_t(scatter_view_type::buffers_type::slots) *
+                           size_t(scatter_view_type::buffers_type::block_size);
+
+  Kokkos::View<NumberType*, DeviceType> original("original", same_slot + 1);
+  scatter_view_type scatter(original);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, 1), KOKKOS_LAMBDA(int) {
+        auto access = scatter.access();
+        auto first  = access(0);
+        access(same_slot) += NumberType(1);
+        first += NumberType(2);
+      });
+  Kokkos::Experimental::contribute(original, scatter);
+  auto host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                  original);
+  EXPECT_EQ(host(0), NumberType(2));
+  EXPECT_EQ(host(same_slot), NumberType(1));
+}
+
+template <typename DeviceType, typename NumberType, typename ScatterType>
+void test_buffered_scatter_eviction(ScatterType) {}
+
+template <typename DeviceType, typename ScatterType, typename NumberType>
+struct TestBufferedScatterView {
+  TestBufferedScatterView(int n) {
+    using contribution_type =
+        typename Kokkos::Impl::Experimental::DefaultContribution<
+            typename DeviceType::execution_space,
+            Kokkos::Experimental::ScatterBuffered>::type;
+    test_scatter_view_config<DeviceType, Kokkos::LayoutRight,
+                             Kokkos::Experimental::ScatterBuffered,
+                             contribution_type, ScatterType, NumberType>
+        test_sv_right_config;
+    test_sv_right_config.run_test(n);
+    test_scatter_view_config<DeviceType, Kokkos::LayoutLeft,
+                             Kokkos::Experimental::ScatterBuffered,
+                             contribution_type, ScatterType, NumberType>
+        test_sv_left_config;
+    test_sv_left_config.run_test(n);
+    test_buffered_scatter_eviction<DeviceType, NumberType>(ScatterType());
+  }
+};
+
 #ifdef KOKKOS_ENABLE_CUDA
 // disable duplicated instantiation with CUDA until
 // UniqueToken can support it
@@ -581,6 +695,21 @@ struct TestDuplicatedScatterView<
     NumberType> {
   TestDuplicatedScatterView(int) {}
 };
+template <typename ScatterType, typename NumberType>
+struct TestBufferedScatterView<Kokkos::Cuda, ScatterType, NumberType> {
+  TestBufferedScatterView(int) {}
+};
+template <typename ScatterType, typename NumberType>
+struct TestBufferedScatterView<Kokkos::Device<Kokkos::Cuda, Kokkos::CudaSpace>,
+                               ScatterType, NumberType> {
+  TestBufferedScatterView(int) {}
+};
+template <typename ScatterType, typename NumberType>
+struct TestBufferedScatterView<
+    Kokkos::Device<Kokkos::Cuda, Kokkos::CudaUVMSpace>, ScatterType,
+    NumberType> {
+  TestBufferedScatterView(int) {}
+};
 #endif
 
 template <typename DeviceType, typename ScatterType,
@@ -631,6 +760,7 @@ void test_scatter_view(int64_t n) {
     test_default_sv.run_test(n);
   }
   TestDuplicatedScatterView<DeviceType, ScatterType, NumberType> duptest(n);
+  TestBufferedScatterView<DeviceType, ScatterType, NumberType> buftest(n);
 }
 
 TEST(TEST_CATEGORY, scatterview) {
@@ -663,6 +793,25 @@ TEST(TEST_CATEGORY, scatterview) {
   test_scatter_view<TEST_EXECSPACE, Kokkos::Experimental::ScatterMax>(big_n);
 }
 
+TEST(TEST_CATEGORY, scatterview_strategy) {
+  using Kokkos::Experimental::ScatterStrategy;
+  bool const host_accessible =
+      Kokkos::SpaceAccessibility<TEST_EXECSPACE, Kokkos::HostSpace>::accessible;
+  ScatterStrategy const small =
+      Kokkos::Experimental::scatter_strategy<TEST_EXECSPACE>(100,
+                                                             sizeof(double));
+  ScatterStrategy const large =
+      Kokkos::Experimental::scatter_strategy<TEST_EXECSPACE>(size_t(1) << 32,
+                                                             sizeof(double));
+  if (TEST_EXECSPACE().concurrency() == 1 || !host_accessible) {
+    EXPECT_EQ(small, ScatterStrategy::NonDuplicated);
+    EXPECT_EQ(large, ScatterStrategy::NonDuplicated);
+  } else {
+    EXPECT_EQ(small, ScatterStrategy::Duplicated);
+    EXPECT_EQ(large, ScatterStrategy::Buffered);
+  }
+}
+
 TEST(TEST_CATEGORY, scatterview_devicetype) {
   using device_type =
       Kokkos::Device<TEST_EXECSPACE, typename TEST_EXECSPACE::memory_space>;
@@ -46,6 +46,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <Kokkos_UnorderedMap.hpp>
+#include <Kokkos_HostUnorderedMap.hpp>
 
 namespace Test {
 
@@ -328,6 +329,167 @@ TEST(TEST_CATEGORY, UnorderedMap_valid_empty) {
   ASSERT_TRUE(n.is_allocated());
 }
 
+template <typename Device>
+void test_bulk_insert(uint32_t num_inserts, uint32_t num_duplicates) {
+  using map_type   = Kokkos::UnorderedMap<uint32_t, uint32_t, Device>;
+  using set_type   = Kokkos::UnorderedMap<uint32_t, void, Device>;
+  using view_type  = Kokkos::View<uint32_t *, Device>;
+  using range_type = Kokkos::RangePolicy<typename Device::execution_space>;
+
+  const uint32_t num_keys = (num_inserts + num_duplicates - 1) / num_duplicates;
+
+  view_type keys("keys", num_inserts);
+  view_type values("values", num_inserts);
+  Kokkos::parallel_for(
+      range_type(0, num_inserts), KOKKOS_LAMBDA(uint32_t i) {
+        keys(i)   = i % num_keys;
+        values(i) = i;
+      });
+
+  {
+    Kokkos::Impl::UnorderedMapCardinality<map_type, view_type> cardinality(
+        typename map_type::hasher_type(), keys);
+    const double estimate = cardinality.apply();
+    EXPECT_NEAR(double(num_keys), estimate, 0.05 * num_keys);
+  }
+
+  map_type map;
+  EXPECT_EQ(num_keys, map.bulk_insert(keys, values));
+  ASSERT_FALSE(map.failed_insert());
+  EXPECT_EQ(num_keys, map.size());
+
+  uint32_t find_errors = 0;
+  Kokkos::parallel_reduce(
+      range_type(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t k, uint32_t & errors) {
+        const uint32_t i = map.find(k);
+        if (!map.valid_at(i) || map.value_at(i) % num_keys != k) ++errors;
+      },
+      find_errors);
+  EXPECT_EQ(0u, find_errors);
+
+  // Only the keys which are new are counted
+  view_type more_keys("more_keys", 2 * num_keys);
+  Kokkos::parallel_for(
+      range_type(0, 2 * num_keys), KOKKOS_LAMBDA(uint32_t i) {
+        more_keys(i) = i;
+      });
+  EXPECT_EQ(num_keys, map.bulk_insert(more_keys));
+  EXPECT_EQ(2 * num_keys, map.size());
+
+  set_type set;
+  EXPECT_EQ(num_keys, set.bulk_insert(keys));
+  EXPECT_EQ(num_keys, set.size());
+}
+
+template <typename ExecSpace>
+void test_host_map(uint32_t capacity_hint, uint32_t num_inserts,
+                   uint32_t num_duplicates) {
+  using map_type =
+      Kokkos::Experimental::HostUnorderedMap<uint32_t, uint32_t, ExecSpace>;
+  using policy_type = Kokkos::RangePolicy<ExecSpace>;
+
+  const uint32_t num_keys = (num_inserts + num_duplicates - 1) / num_duplicates;
+
+  map_type map(capacity_hint);
+
+  uint32_t failed_count = 0;
+  Kokkos::parallel_reduce(
+      policy_type(0, num_inserts),
+      KOKKOS_LAMBDA(uint32_t i, uint32_t & failed) {
+        if (map.insert(i / num_duplicates, i).failed()) ++failed;
+      },
+      failed_count);
+
+  ASSERT_EQ(0u, failed_count);
+  ASSERT_FALSE(map.failed_insert());
+  EXPECT_EQ(num_keys, map.size());
+  if (capacity_hint < num_keys) {
+    EXPECT_LT(1u, map.num_levels());
+  }
+
+  // Every key maps to one of the values inserted with it
+  uint32_t find_errors = 0;
+  Kokkos::parallel_reduce(
+      policy_type(0, 2 * num_keys),
+      KOKKOS_LAMBDA(uint32_t k, uint32_t & errors) {
+        const uint32_t i = map.find(k);
+        if (k < num_keys) {
+          if (!map.valid_at(i) || map.key_at(i) != k ||
+              map.value_at(i) / num_duplicates != k) {
+            ++errors;
+          }
+        } else if (map.valid_at(i)) {
+          ++errors;
+        }
+      },
+      find_errors);
+  EXPECT_EQ(0u, find_errors);
+
+  Kokkos::parallel_for(
+      policy_type(0, num_keys), KOKKOS_LAMBDA(uint32_t k) {
+        if (k % 2 == 0) map.erase(k);
+      });
+  ExecSpace().fence();
+  EXPECT_EQ(num_keys / 2, map.size());
+
+  map.rehash();
+  EXPECT_EQ(1u, map.num_levels());
+  EXPECT_EQ(num_keys / 2, map.size());
+
+  find_errors = 0;
+  Kokkos::parallel_reduce(
+      policy_type(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t k, uint32_t & errors) {
+        if (map.exists(k) != (k % 2 == 1)) ++errors;
+      },
+      find_errors);
+  EXPECT_EQ(0u, find_errors);
+
+  map.clear();
+  EXPECT_EQ(0u, map.size());
+  EXPECT_FALSE(map.exists(1));
+}
+
+TEST(TEST_CATEGORY, UnorderedMap_bulk_insert) {
+  test_bulk_insert<TEST_EXECSPACE>(100000, 4);
+  test_bulk_insert<TEST_EXECSPACE>(1000, 1);
+}
+
+TEST(TEST_CATEGORY, HostUnorderedMap_insert) {
+  using host_exec_space = typename std::conditional<
+      Kokkos::Impl::SpaceAccessibility<TEST_EXECSPACE,
+                                       Kokkos::HostSpace>::accessible,
+      TEST_EXECSPACE, Kokkos::DefaultHostExecutionSpace>::type;
+
+  test_host_map<host_exec_space>(100000, 90000, 100);
+  test_host_map<host_exec_space>(1000, 300000, 3);
+  test_host_map<host_exec_space>(0, 1000, 1);
+}
+
+TEST(TEST_CATEGORY, HostUnorderedMap_set) {
+  using host_exec_space = typename std::conditional<
+      Kokkos::Impl::SpaceAccessibility<TEST_EXECSPACE,
+                                       Kokkos::HostSpace>::accessible,
+      TEST_EXECSPACE, Kokkos::DefaultHostExecutionSpace>::type;
+  using set_type =
+      Kokkos::Experimental::HostUnorderedMap<int, void, host_exec_space>;
+
+  set_type set;
+  int num_existing = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<host_exec_space>(0, 10000),
+      KOKKOS_LAMBDA(int i, int &existing) {
+        if (set.insert(i % 2500).existing()) ++existing;
+      },
+      num_existing);
+
+  EXPECT_EQ(7500, num_existing);
+  EXPECT_EQ(2500u, set.size());
+  EXPECT_TRUE(set.exists(2499));
+  EXPECT_FALSE(set.exists(2500));
+}
+
 }  // namespace Test
 
 #endif  // KOKKOS_TEST_UNORDERED_MAP_HPP
@@ -0,0 +1,124 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <PerfTest_Category.hpp>
+
+namespace Test {
+
+namespace {
+
+struct EmptyForFunctor {
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int) const {}
+};
+
+struct CountReduceFunctor {
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int, int& update) const { update += 1; }
+};
+
+// Time per launch of kernels doing (almost) nothing, which is what bounds
+// the rate at which an application can issue small kernels.  With OpenMP
+// only single thread pools, nested launches and empty ranges skip the
+// parallel region; the multi-thread numbers are those of the OpenMP runtime.
+template <class ExecSpace>
+void run_kernel_launch_latency(const char* name, const int R) {
+  using policy_type = Kokkos::RangePolicy<ExecSpace>;
+
+  ExecSpace space;
+
+  for (int n : {0, 1, 64, 4096}) {
+    double time_for, time_reduce;
+    {
+      Kokkos::Timer timer;
+      for (int r = 0; r < R; r++) {
+        Kokkos::parallel_for("EmptyFor", policy_type(space, 0, n),
+                             EmptyForFunctor());
+      }
+      space.fence();
+      time_for = timer.seconds() / R;
+    }
+    {
+      int result = 0;
+      Kokkos::Timer timer;
+      for (int r = 0; r < R; r++) {
+        Kokkos::parallel_reduce("EmptyReduce", policy_type(space, 0, n),
+                                CountReduceFunctor(), result);
+      }
+      time_reduce = timer.seconds() / R;
+      ASSERT_EQ(result, n);
+    }
+    printf("   %-8s n = %4d:   parallel_for %lf us   parallel_reduce %lf us\n",
+           name, n, time_for * 1.0e6, time_reduce * 1.0e6);
+  }
+}
+
+}  // namespace
+
+TEST(default_exec, kernel_launch_latency) {
+  printf("Kernel launch latency:\n");
+#if defined(KOKKOS_ENABLE_SERIAL)
+  run_kernel_launch_latency<Kokkos::Serial>("Serial", 100000);
+#endif
+#if defined(KOKKOS_ENABLE_OPENMP)
+  run_kernel_launch_latency<Kokkos::OpenMP>("OpenMP", 100000);
+#endif
+#if defined(KOKKOS_ENABLE_THREADS)
+  run_kernel_launch_latency<Kokkos::Threads>("Threads", 100000);
+#endif
+#if defined(KOKKOS_ENABLE_HPX)
+  run_kernel_launch_latency<Kokkos::Experimental::HPX>("HPX", 10000);
+#endif
+#if defined(KOKKOS_ENABLE_CUDA)
+  run_kernel_launch_latency<Kokkos::Cuda>("Cuda", 10000);
+#endif
+#if defined(KOKKOS_ENABLE_HIP)
+  run_kernel_launch_latency<Kokkos::Experimental::HIP>("HIP", 10000);
+#endif
+}
+
+}  // namespace Test
@@ -43,6 +43,7 @@
 */
 
 #include <Kokkos_Core.hpp>
+#include <impl/Kokkos_HostSpace_cache.hpp>
 #include <gtest/gtest.h>
 #include <cstdio>
 #include <PerfTest_Category.hpp>
@@ -157,4 +158,50 @@ TEST(default_exec, ViewCreate) {
   run_allocateview_tests<Kokkos::LayoutRight>(10, 1);
 }
 
+void run_allocateview_small_tests(int R) {
+  using view_type = Kokkos::View<char*, Kokkos::HostSpace>;
+
+  const size_t saved = Kokkos::Impl::host_space_cache_threshold();
+  Kokkos::Impl::host_space_cache_set_threshold(size_t(1) << 16);
+  Kokkos::HostSpace cached_space;
+  Kokkos::Impl::host_space_cache_set_threshold(0);
+  Kokkos::HostSpace uncached_space;
+  Kokkos::Impl::host_space_cache_set_threshold(saved);
+
+  for (size_t n = 64; n <= (size_t(1) << 16); n *= 4) {
+    double time_uncached, time_cached;
+    {
+      Kokkos::Timer timer;
+      for (int r = 0; r < R; r++) {
+        view_type a(Kokkos::view_alloc("S", uncached_space,
+                                       Kokkos::WithoutInitializing),
+                    n);
+      }
+      time_uncached = timer.seconds() / R;
+    }
+    {
+      Kokkos::Timer timer;
+      for (int r = 0; r < R; r++) {
+        view_type a(
+            Kokkos::view_alloc("S", cached_space, Kokkos::WithoutInitializing),
+            n);
+      }
+      time_cached = timer.seconds() / R;
+    }
+    printf("   %6d B:   uncached %lf us   cached %lf us\n", int(n),
+           time_uncached * 1.0e6, time_cached * 1.0e6);
+  }
+
+  const Kokkos::Experimental::HostSpaceCacheStats stats =
+      Kokkos::Experimental::host_space_cache_stats();
+  printf("   cache: %lu allocations   %lu hits   %lu bytes cached\n",
+         (unsigned long)stats.allocations, (unsigned long)stats.hits,
+         (unsigned long)stats.cached_bytes);
+}
+
+TEST(default_exec, ViewCreateSmall) {
+  printf("Create small View Performance with the HostSpace cache:\n");
+  run_allocateview_small_tests(10000);
+}
+
 }  // namespace Test
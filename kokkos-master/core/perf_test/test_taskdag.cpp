@@ -180,7 +180,7 @@ int main(int argc, char* argv[]) {
     return -1;
   }
 
-  using Scheduler = Kokkos::TaskSchedulerMultiple<ExecSpace>;
+  using Scheduler = Kokkos::ChaseLevTaskScheduler<ExecSpace>;
 
   using Functor = TestFib<Scheduler>;
 
@@ -52,7 +52,9 @@
 #include <impl/KokkosExp_Host_IterateTile.hpp>
 #include <Kokkos_ExecPolicy.hpp>
 #include <Kokkos_Parallel.hpp>
+#include <cstdint>
 #include <type_traits>
+#include <vector>
 
 #if defined(KOKKOS_ENABLE_CUDA) || \
     (defined(__HIPCC__) && defined(KOKKOS_ENABLE_HIP))
@@ -137,6 +139,19 @@ constexpr To checked_narrow_cast(From arg) {
   }
   return ret;
 }
+
+/* Tile of a host MDRangePolicy for the dimensions whose tile is not set
+ * (tile <= 0).  The innermost of these gets up to 'budget' points divided
+ * by the set tiles, the others share the rest evenly.  Tiles are then
+ * halved, outer dimensions first, until there are enough of them for
+ * 'concurrency' threads. */
+void host_mdrange_default_tile(int rank, bool inner_is_right,
+                               std::int64_t const* span, std::int64_t* tile,
+                               std::int64_t concurrency, std::int64_t budget);
+
+// Points per tile such that a few arrays of doubles fit in the level 2 cache
+std::int64_t host_mdrange_tile_budget();
+
 // NOTE prefer C array U[M] to std::initalizer_list<U> so that the number of
 // elements can be deduced (https://stackoverflow.com/q/40241370)
 // NOTE for some unfortunate reason the policy bounds are stored as signed
@@ -231,6 +246,9 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
   point_type m_tile_end       = {};
   index_type m_num_tiles      = 1;
   index_type m_prod_tile_dims = 1;
+  TileOrder m_tile_order      = TileOrder::Lexicographic;
+  // Dimensions whose tile was chosen by the policy rather than the user
+  Kokkos::Array<bool, rank> m_auto_tile = {};
 
   /*
     // NDE enum impl definition alternative - replace static constexpr int ?
@@ -354,9 +372,70 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
         m_tile(p.m_tile),
         m_tile_end(p.m_tile_end),
         m_num_tiles(p.m_num_tiles),
-        m_prod_tile_dims(p.m_prod_tile_dims) {}
+        m_prod_tile_dims(p.m_prod_tile_dims),
+        m_tile_order(p.m_tile_order),
+        m_auto_tile(p.m_auto_tile) {}
+
+  /** \brief Set the order in which host execution spaces run the tiles */
+  MDRangePolicy& set_tile_order(TileOrder order) {
+    m_tile_order = order;
+    return *this;
+  }
+
+  TileOrder tile_order() const { return m_tile_order; }
+
+  // Whether some tile sizes were chosen by the policy, and may be tuned
+  bool impl_tune_tile_size() const {
+    for (int i = 0; i < rank; ++i) {
+      if (m_auto_tile[i]) return true;
+    }
+    return false;
+  }
+
+  // Tiles to choose from when tuning: the default with a range of budgets
+  std::vector<tile_type> impl_tile_size_candidates() const {
+    std::vector<tile_type> candidates;
+    const std::int64_t base = Impl::host_mdrange_tile_budget();
+    for (std::int64_t budget :
+         {base / 16, base / 4, base, base * 4, base * 16}) {
+      tile_type tile;
+      point_type span;
+      for (int i = 0; i < rank; ++i) {
+        tile[i] = m_auto_tile[i] ? 0 : m_tile[i];
+        span[i] = m_upper[i] - m_lower[i];
+      }
+      Impl::host_mdrange_default_tile(
+          rank, (int)inner_direction == (int)Right, span.data(), tile.data(),
+          m_space.concurrency(), budget);
+      bool is_new = true;
+      for (auto const& candidate : candidates) {
+        bool same = true;
+        for (int i = 0; i < rank; ++i) same = same && candidate[i] == tile[i];
+        is_new = is_new && !same;
+      }
+      if (is_new) candidates.push_back(tile);
+    }
+    return candidates;
+  }
+
+  void impl_change_tile_size(tile_type const& tile) {
+    m_tile = tile;
+    init_tile_counts();
+  }
 
  private:
+  void init_tile_counts() {
+    m_num_tiles      = 1;
+    m_prod_tile_dims = 1;
+    for (int i = 0; i < rank; ++i) {
+      const index_type span = m_upper[i] - m_lower[i];
+      m_tile_end[i] =
+          static_cast<index_type>((span + m_tile[i] - 1) / m_tile[i]);
+      m_num_tiles *= m_tile_end[i];
+      m_prod_tile_dims *= m_tile[i];
+    }
+  }
+
   void init() {
     // Host
     if (true
@@ -368,22 +447,35 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
                          Kokkos::Experimental::HIP>::value
 #endif
     ) {
-      index_type span;
-      for (int i = 0; i < rank; ++i) {
-        span = m_upper[i] - m_lower[i];
-        if (m_tile[i] <= 0) {
-          if (((int)inner_direction == (int)Right && (i < rank - 1)) ||
-              ((int)inner_direction == (int)Left && (i > 0))) {
-            m_tile[i] = 2;
-          } else {
-            m_tile[i] = (span == 0 ? 1 : span);
+      // Spaces running the tiles through HostIterateTile get cache sized
+      // tiles, the others keep full inner rows of two
+      if (std::is_same<typename traits::execution_space::memory_space,
+                       Kokkos::HostSpace>::value) {
+        point_type span;
+        for (int i = 0; i < rank; ++i) {
+          span[i]        = m_upper[i] - m_lower[i];
+          m_auto_tile[i] = m_tile[i] <= 0;
+        }
+        if (impl_tune_tile_size()) {
+          Impl::host_mdrange_default_tile(
+              rank, (int)inner_direction == (int)Right, span.data(),
+              m_tile.data(), m_space.concurrency(),
+              Impl::host_mdrange_tile_budget());
+        }
+      } else {
+        for (int i = 0; i < rank; ++i) {
+          const index_type span = m_upper[i] - m_lower[i];
+          if (m_tile[i] <= 0) {
+            if (((int)inner_direction == (int)Right && (i < rank - 1)) ||
+                ((int)inner_direction == (int)Left && (i > 0))) {
+              m_tile[i] = 2;
+            } else {
+              m_tile[i] = (span == 0 ? 1 : span);
+            }
           }
         }
-        m_tile_end[i] =
-            static_cast<index_type>((span + m_tile[i] - 1) / m_tile[i]);
-        m_num_tiles *= m_tile_end[i];
-        m_prod_tile_dims *= m_tile[i];
       }
+      init_tile_counts();
     }
 #if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP)
     else  // Cuda or HIP
@@ -95,11 +95,16 @@ struct WorkItemProperty {
       ImplWorkItemProperty<4>();
   constexpr static const ImplWorkItemProperty<8> HintIrregular =
       ImplWorkItemProperty<8>();
+  // Each work item only accesses data at its own index, so a graph may fuse
+  // the kernel with adjacent ones over the same range.
+  constexpr static const ImplWorkItemProperty<16> HintFusable =
+      ImplWorkItemProperty<16>();
   using None_t            = ImplWorkItemProperty<0>;
   using HintLightWeight_t = ImplWorkItemProperty<1>;
   using HintHeavyWeight_t = ImplWorkItemProperty<2>;
   using HintRegular_t     = ImplWorkItemProperty<4>;
   using HintIrregular_t   = ImplWorkItemProperty<8>;
+  using HintFusable_t     = ImplWorkItemProperty<16>;
 };
 
 template <unsigned long pv1, unsigned long pv2>
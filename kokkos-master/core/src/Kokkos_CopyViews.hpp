@@ -44,9 +44,12 @@
 
 #ifndef KOKKOS_COPYVIEWS_HPP_
 #define KOKKOS_COPYVIEWS_HPP_
+#include <memory>
 #include <string>
+#include <utility>
 #include <Kokkos_Parallel.hpp>
 #include <KokkosExp_MDRangePolicy.hpp>
+#include <impl/Kokkos_HostCopyEngine.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -1298,6 +1301,27 @@ inline void deep_copy(
                            Kokkos::AnonymousSpace>::type>,
         Kokkos::MemoryTraits<0>>;
 
+    using value_type = typename ViewType::value_type;
+
+    // Large fills of host memory bypass the caches
+    constexpr bool host_streaming_fill =
+        std::is_same<typename ViewType::memory_space,
+                     Kokkos::HostSpace>::value &&
+        std::is_trivially_copyable<value_type>::value &&
+        (64 % sizeof(value_type) == 0);
+
+    const ptrdiff_t fill_bytes = dst.span() * sizeof(value_type);
+    if (host_streaming_fill &&
+        fill_bytes >= Kokkos::Impl::hostspace_streaming_limit()) {
+      Kokkos::Impl::hostspace_stream_fill(dst.data(), &value,
+                                          sizeof(value_type), fill_bytes);
+      if (Kokkos::Tools::Experimental::get_callbacks().end_deep_copy !=
+          nullptr) {
+        Kokkos::Profiling::endDeepCopy();
+      }
+      return;
+    }
+
     ViewTypeFlat dst_flat(dst.data(), dst.size());
     if (dst.span() < static_cast<size_t>(std::numeric_limits<int>::max())) {
       Kokkos::Impl::ViewFill<ViewTypeFlat, Kokkos::LayoutRight, exec_space_type,
@@ -2770,6 +2794,116 @@ inline void deep_copy(
   }
 }
 
+namespace Experimental {
+
+/** \brief  Completion event of a deep_copy_async.
+ *
+ *  A default constructed future is ready.  Waiting releases the Views
+ *  the completed copies kept alive.
+ */
+class HostCopyFuture {
+ public:
+  HostCopyFuture() = default;
+  explicit HostCopyFuture(uint64_t arg_ticket) : m_ticket(arg_ticket) {}
+
+  bool is_ready() const {
+    return Kokkos::Impl::host_copy_engine_is_complete(m_ticket);
+  }
+
+  void wait() const { Kokkos::Impl::host_copy_engine_wait(m_ticket); }
+
+ private:
+  uint64_t m_ticket = 0;
+};
+
+/** \brief  A deep copy between contiguous host Views enqueued on the host
+ *  copy engine.
+ *
+ *  Returns before the copy completes, wait on the returned future or fence
+ *  a host execution space before accessing dst or modifying src.  Kernels
+ *  dispatched to exec_space later are not ordered after the copy.  Copies
+ *  which are not a byte-wise copy of host memory fall back to
+ *  deep_copy(exec_space, dst, src) and return a ready future.
+ */
+template <class ExecSpace, class DT, class... DP, class ST, class... SP>
+inline HostCopyFuture deep_copy_async(
+    const ExecSpace& exec_space, const View<DT, DP...>& dst,
+    const View<ST, SP...>& src,
+    typename std::enable_if<(
+        Kokkos::Impl::is_execution_space<ExecSpace>::value &&
+        std::is_same<typename ViewTraits<DT, DP...>::specialize, void>::value &&
+        std::is_same<typename ViewTraits<ST, SP...>::specialize,
+                     void>::value)>::type* = nullptr) {
+  using dst_type         = View<DT, DP...>;
+  using src_type         = View<ST, SP...>;
+  using dst_memory_space = typename dst_type::memory_space;
+  using src_memory_space = typename src_type::memory_space;
+
+  static_assert((unsigned(dst_type::rank) == unsigned(src_type::rank)),
+                "deep_copy_async requires Views of equal rank");
+
+  enum {
+    HostByteCopy =
+        Kokkos::Impl::SpaceAccessibility<ExecSpace,
+                                         Kokkos::HostSpace>::accessible &&
+        Kokkos::Impl::MemorySpaceAccess<Kokkos::HostSpace,
+                                        dst_memory_space>::accessible &&
+        Kokkos::Impl::MemorySpaceAccess<Kokkos::HostSpace,
+                                        src_memory_space>::accessible &&
+        std::is_same<typename dst_type::value_type,
+                     typename src_type::non_const_value_type>::value &&
+        (std::is_same<typename dst_type::array_layout,
+                      typename src_type::array_layout>::value ||
+         dst_type::rank <= 1)
+  };
+
+  const size_t nbytes = sizeof(typename dst_type::value_type) * dst.span();
+  const char* dst_c   = reinterpret_cast<const char*>(dst.data());
+  const char* src_c   = reinterpret_cast<const char*>(src.data());
+
+  bool byte_copy = HostByteCopy && dst.data() != nullptr &&
+                   src.data() != nullptr && dst.span_is_contiguous() &&
+                   src.span_is_contiguous() && dst.span() == src.span() &&
+                   (dst_c + nbytes <= src_c || src_c + nbytes <= dst_c);
+  for (unsigned r = 0; byte_copy && r < dst_type::rank; ++r) {
+    byte_copy = dst.extent(r) == src.extent(r) &&
+                dst.stride(r) == src.stride(r);
+  }
+
+  if (!byte_copy) {
+    Kokkos::deep_copy(exec_space, dst, src);
+    return HostCopyFuture();
+  }
+
+  if (Kokkos::Tools::Experimental::get_callbacks().begin_deep_copy != nullptr) {
+    Kokkos::Profiling::beginDeepCopy(
+        Kokkos::Profiling::make_space_handle(dst_memory_space::name()),
+        dst.label(), dst.data(),
+        Kokkos::Profiling::make_space_handle(src_memory_space::name()),
+        src.label(), src.data(), nbytes);
+  }
+
+  // Host kernels complete before their dispatch returns, except with
+  // asynchronous HPX dispatch
+#if defined(KOKKOS_ENABLE_HPX_ASYNC_DISPATCH)
+  exec_space.fence();
+#else
+  (void)exec_space;
+#endif
+
+  // The copy keeps both allocations alive until it is waited for
+  const uint64_t ticket = Kokkos::Impl::host_copy_engine_submit(
+      dst.data(), src.data(), nbytes,
+      std::make_shared<std::pair<dst_type, src_type>>(dst, src));
+
+  if (Kokkos::Tools::Experimental::get_callbacks().end_deep_copy != nullptr) {
+    Kokkos::Profiling::endDeepCopy();
+  }
+  return HostCopyFuture(ticket);
+}
+
+}  // namespace Experimental
+
 } /* namespace Kokkos */
 
 //----------------------------------------------------------------------------
@@ -86,6 +86,10 @@ struct InitArguments {
   int skip_device;
   bool disable_warnings;
   bool tune_internals;
+  HostSpace::HugePages huge_pages;
+  int host_alloc_cache;
+  int host_barrier_group;
+  int host_spin_limit;
   InitArguments(int nt = -1, int nn = -1, int dv = -1, bool dw = false,
                 bool ti = false)
       : num_threads{nt},
@@ -94,7 +98,11 @@ struct InitArguments {
         ndevices{-1},
         skip_device{9999},
         disable_warnings{dw},
-        tune_internals{ti} {}
+        tune_internals{ti},
+        huge_pages{HostSpace::HUGE_PAGES_DEFAULT},
+        host_alloc_cache{-1},
+        host_barrier_group{-1},
+        host_spin_limit{-1} {}
 };
 
 namespace Impl {
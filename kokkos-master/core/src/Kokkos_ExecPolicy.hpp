@@ -98,6 +98,7 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
   typename traits::index_type m_end;
   typename traits::index_type m_granularity;
   typename traits::index_type m_granularity_mask;
+  bool m_auto_chunk_size = true;
 
   template <class... OtherProperties>
   friend class RangePolicy;
@@ -128,7 +129,8 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
         m_begin(p.m_begin),
         m_end(p.m_end),
         m_granularity(p.m_granularity),
-        m_granularity_mask(p.m_granularity_mask) {}
+        m_granularity_mask(p.m_granularity_mask),
+        m_auto_chunk_size(p.m_auto_chunk_size) {}
 
   inline RangePolicy()
       : m_space(),
@@ -192,6 +194,7 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
   inline void set(const ChunkSize& chunksize, Args... args) {
     m_granularity      = chunksize.value;
     m_granularity_mask = m_granularity - 1;
+    m_auto_chunk_size  = false;
     set(args...);
   }
 
@@ -204,9 +207,20 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
     RangePolicy p        = *this;
     p.m_granularity      = chunk_size_;
     p.m_granularity_mask = p.m_granularity - 1;
+    p.m_auto_chunk_size  = false;
     return p;
   }
 
+  /** \brief whether the chunk size was chosen by Kokkos */
+  inline bool impl_auto_chunk_size() const { return m_auto_chunk_size; }
+
+  /** \brief change the chunk size while keeping it marked as automatic,
+   *  used by the tuning interface */
+  inline void impl_set_chunk_size(int chunk_size_) {
+    m_granularity      = chunk_size_;
+    m_granularity_mask = m_granularity - 1;
+  }
+
  private:
   /** \brief finalize chunk_size if it was set to AUTO*/
   inline void set_auto_chunk_size() {
@@ -72,6 +72,7 @@
 #include <impl/Kokkos_Tags.hpp>
 #include <impl/Kokkos_TaskQueue.hpp>
 #include <impl/Kokkos_ExecSpaceInitializer.hpp>
+#include <impl/Kokkos_HostCopyEngine.hpp>
 
 #include <KokkosExp_MDRangePolicy.hpp>
 
@@ -339,6 +340,7 @@ class HPX {
       impl_fence_instance();
     }
 #endif
+    Impl::host_copy_engine_fence();
   }
 
   static bool is_asynchronous(HPX const & = HPX()) noexcept {
@@ -154,6 +154,56 @@ class HostSpace {
 
   explicit HostSpace(const AllocationMechanism&);
 
+  /**\brief  Non-default memory space instance to choose the NUMA placement
+   * of the allocated pages.
+   *
+   * NUMA_FIRST_TOUCH: pages are touched in parallel by the host thread pool
+   *                   with a static schedule, placing them close to the
+   *                   threads a static RangePolicy assigns them to.
+   * NUMA_INTERLEAVE:  pages are interleaved round robin across NUMA nodes.
+   * NUMA_BIND:        pages are bound to NUMA node arg_numa_node.
+   *
+   * Pass the instance to view_alloc to select the policy for a View.
+   */
+  enum NumaPolicy {
+    NUMA_DEFAULT,
+    NUMA_FIRST_TOUCH,
+    NUMA_INTERLEAVE,
+    NUMA_BIND
+  };
+
+  explicit HostSpace(const NumaPolicy& arg_numa_policy,
+                     const int arg_numa_node = 0);
+
+  NumaPolicy numa_policy() const { return m_numa_policy; }
+  int numa_node() const { return m_numa_node; }
+
+  /**\brief  Non-default memory space instance to choose the page size
+   * backing large allocations.
+   *
+   * HUGE_PAGES_DEFAULT: use the --kokkos-huge-pages runtime setting.
+   * HUGE_PAGES_OFF:     use base pages.
+   * HUGE_PAGES_THP:     advise the kernel to back the pages with
+   *                     transparent huge pages.
+   * HUGE_PAGES_2M/1G:   map explicit hugetlbfs pages of the given size,
+   *                     falling back to transparent huge pages when the
+   *                     huge page pool cannot satisfy the request.
+   *
+   * Allocations smaller than one huge page always use base pages.
+   * Pass the instance to view_alloc to select the page size for a View.
+   */
+  enum HugePages {
+    HUGE_PAGES_DEFAULT,
+    HUGE_PAGES_OFF,
+    HUGE_PAGES_THP,
+    HUGE_PAGES_2M,
+    HUGE_PAGES_1G
+  };
+
+  explicit HostSpace(const HugePages& arg_huge_pages);
+
+  HugePages huge_pages() const { return m_huge_pages; }
+
   /**\brief  Allocate untracked memory in the space */
   void* allocate(const size_t arg_alloc_size) const;
   void* allocate(const char* arg_label, const size_t arg_alloc_size,
@@ -185,6 +235,10 @@ class HostSpace {
 
  private:
   AllocationMechanism m_alloc_mech;
+  NumaPolicy m_numa_policy;
+  int m_numa_node;
+  HugePages m_huge_pages;
+  size_t m_cache_threshold;
   static constexpr const char* m_name = "Host";
   friend class Kokkos::Impl::SharedAllocationRecord<Kokkos::HostSpace, void>;
 };
@@ -195,8 +249,31 @@ class HostSpace {
 
 namespace Kokkos {
 
+namespace Experimental {
+
+/** \brief  Counters of the caching allocator serving HostSpace allocations
+ *          of at most 'threshold' bytes, see --kokkos-host-alloc-cache.
+ */
+struct HostSpaceCacheStats {
+  size_t threshold;      // current threshold, zero if the cache is off
+  size_t allocations;    // allocations served by the cache
+  size_t hits;           // allocations reusing a cached block
+  size_t deallocations;  // deallocations returned to the cache
+  size_t cached_bytes;   // bytes held in free blocks
+};
+
+HostSpaceCacheStats host_space_cache_stats();
+
+}  // namespace Experimental
+
 namespace Impl {
 
+/** \brief  Runtime page size used by HostSpace instances constructed
+ *          without an explicit HugePages hint.
+ */
+void host_space_set_huge_pages(const HostSpace::HugePages arg_huge_pages);
+HostSpace::HugePages host_space_huge_pages();
+
 static_assert(Kokkos::Impl::MemorySpaceAccess<Kokkos::HostSpace,
                                               Kokkos::HostSpace>::assignable,
               "");
@@ -196,6 +196,12 @@ enum class Iterate {
   Right  // Right indices stride fastest
 };
 
+// Order in which the host execution spaces enumerate the tiles of an
+// MDRangePolicy.  Lexicographic follows the outer iteration direction,
+// Morton follows a Z-order curve over the tiles so that the consecutive
+// tiles run by one thread are close to each other in every dimension.
+enum class TileOrder { Lexicographic, Morton };
+
 // To check for LayoutTiled
 // This is to hide extra compile-time 'identifier' info within the LayoutTiled
 // class by not relying on template specialization to include the ArgN*'s
@@ -0,0 +1,735 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_SIMD.hpp
+/// \brief Portable SIMD pack types Kokkos::Experimental::simd<T, Abi>.
+///
+/// simd<T, Abi> holds simd<T, Abi>::size() values of type T and maps the
+/// arithmetic, comparison, masked load/store, gather/scatter and reduction
+/// operations onto vector instructions. The ABI tags select the instruction
+/// set: scalar and fixed_size<N> work everywhere (including device code),
+/// while avx2_fixed_size, avx512_fixed_size and neon_fixed_size are host-only
+/// and use intrinsics for float and double. simd_abi::ForSpace<Space> picks
+/// the best ABI for code running in an execution space.
+
+#ifndef KOKKOS_SIMD_HPP
+#define KOKKOS_SIMD_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__) && \
+    !defined(__SYCL_DEVICE_ONLY__)
+#if defined(__AVX512F__)
+#define KOKKOS_IMPL_SIMD_AVX512
+#endif
+#if defined(__AVX2__)
+#define KOKKOS_IMPL_SIMD_AVX2
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define KOKKOS_IMPL_SIMD_NEON
+#endif
+#endif
+
+namespace Kokkos {
+namespace Experimental {
+
+/// Tags for copy_from/copy_to: element_aligned_tag only requires alignment
+/// of T, vector_aligned_tag requires alignment of the whole pack.
+struct element_aligned_tag {};
+struct vector_aligned_tag {};
+
+namespace simd_abi {
+
+class scalar {};
+
+template <int N>
+class fixed_size {};
+
+template <int N>
+class avx2_fixed_size {};
+
+template <int N>
+class avx512_fixed_size {};
+
+template <int N>
+class neon_fixed_size {};
+
+}  // namespace simd_abi
+
+template <class T, class Abi>
+class simd;
+
+template <class T, class Abi>
+class simd_mask;
+
+}  // namespace Experimental
+
+namespace Impl {
+
+template <class T, class Abi>
+struct SIMDSize;
+
+template <class T>
+struct SIMDSize<T, Kokkos::Experimental::simd_abi::scalar>
+    : std::integral_constant<int, 1> {};
+
+template <class T, int N>
+struct SIMDSize<T, Kokkos::Experimental::simd_abi::fixed_size<N>>
+    : std::integral_constant<int, N> {};
+
+template <class T, int N>
+struct SIMDSize<T, Kokkos::Experimental::simd_abi::avx2_fixed_size<N>>
+    : std::integral_constant<int, N> {};
+
+template <class T, int N>
+struct SIMDSize<T, Kokkos::Experimental::simd_abi::avx512_fixed_size<N>>
+    : std::integral_constant<int, N> {};
+
+template <class T, int N>
+struct SIMDSize<T, Kokkos::Experimental::simd_abi::neon_fixed_size<N>>
+    : std::integral_constant<int, N> {};
+
+/* SIMDOps<T, Abi> -- storage and lane-wise operations behind simd<T, Abi>
+ * and simd_mask<T, Abi>. The primary template stores one T (and one bool
+ * per mask lane) and loops over the lanes, which is what the scalar and
+ * fixed_size ABIs use, and what the compiler auto-vectorizes at best for
+ * the other ABIs. The specializations in impl/Kokkos_SIMD_AVX2.hpp,
+ * impl/Kokkos_SIMD_AVX512.hpp and impl/Kokkos_SIMD_NEON.hpp map the same
+ * interface onto intrinsics. Masked loads, stores and gathers never touch
+ * memory of inactive lanes. */
+template <class T, class Abi>
+struct SIMDOps {
+  enum : int { size = SIMDSize<T, Abi>::value };
+
+  struct reg {
+    T lane[size];
+  };
+  struct mask {
+    bool lane[size];
+  };
+
+  static KOKKOS_FORCEINLINE_FUNCTION reg broadcast(T a) {
+    reg r;
+    for (int i = 0; i < size; ++i) r.lane[i] = a;
+    return r;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION reg load(T const* ptr) {
+    reg r;
+    for (int i = 0; i < size; ++i) r.lane[i] = ptr[i];
+    return r;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION reg load_aligned(T const* ptr) {
+    return load(ptr);
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION void store(T* ptr, reg const& a) {
+    for (int i = 0; i < size; ++i) ptr[i] = a.lane[i];
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION void store_aligned(T* ptr, reg const& a) {
+    store(ptr, a);
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION T get(reg const& a, int i) {
+    return a.lane[i];
+  }
+
+#define KOKKOS_IMPL_SIMD_GENERIC_BINARY_OP(NAME, EXPR)                       \
+  static KOKKOS_FORCEINLINE_FUNCTION reg NAME(reg const& a, reg const& b) {  \
+    reg r;                                                                   \
+    for (int i = 0; i < size; ++i) {                                         \
+      T const x = a.lane[i];                                                 \
+      T const y = b.lane[i];                                                 \
+      r.lane[i] = EXPR;                                                      \
+    }                                                                        \
+    return r;                                                                \
+  }
+  KOKKOS_IMPL_SIMD_GENERIC_BINARY_OP(add, x + y)
+  KOKKOS_IMPL_SIMD_GENERIC_BINARY_OP(sub, x - y)
+  KOKKOS_IMPL_SIMD_GENERIC_BINARY_OP(mul, x * y)
+  KOKKOS_IMPL_SIMD_GENERIC_BINARY_OP(div, x / y)
+  KOKKOS_IMPL_SIMD_GENERIC_BINARY_OP(min, y < x ? y : x)
+  KOKKOS_IMPL_SIMD_GENERIC_BINARY_OP(max, x < y ? y : x)
+#undef KOKKOS_IMPL_SIMD_GENERIC_BINARY_OP
+
+  static KOKKOS_FORCEINLINE_FUNCTION reg neg(reg const& a) {
+    reg r;
+    for (int i = 0; i < size; ++i) r.lane[i] = -a.lane[i];
+    return r;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION reg abs(reg const& a) {
+    reg r;
+    for (int i = 0; i < size; ++i)
+      r.lane[i] = a.lane[i] < T(0) ? -a.lane[i] : a.lane[i];
+    return r;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION reg sqrt(reg const& a) {
+    reg r;
+    for (int i = 0; i < size; ++i) r.lane[i] = std::sqrt(a.lane[i]);
+    return r;
+  }
+  // a * b + c
+  static KOKKOS_FORCEINLINE_FUNCTION reg fma(reg const& a, reg const& b,
+                                             reg const& c) {
+    reg r;
+    for (int i = 0; i < size; ++i)
+      r.lane[i] = a.lane[i] * b.lane[i] + c.lane[i];
+    return r;
+  }
+
+#define KOKKOS_IMPL_SIMD_GENERIC_COMPARE(NAME, OP)                           \
+  static KOKKOS_FORCEINLINE_FUNCTION mask NAME(reg const& a, reg const& b) { \
+    mask m;                                                                  \
+    for (int i = 0; i < size; ++i) m.lane[i] = a.lane[i] OP b.lane[i];       \
+    return m;                                                                \
+  }
+  KOKKOS_IMPL_SIMD_GENERIC_COMPARE(cmp_eq, ==)
+  KOKKOS_IMPL_SIMD_GENERIC_COMPARE(cmp_ne, !=)
+  KOKKOS_IMPL_SIMD_GENERIC_COMPARE(cmp_lt, <)
+  KOKKOS_IMPL_SIMD_GENERIC_COMPARE(cmp_le, <=)
+  KOKKOS_IMPL_SIMD_GENERIC_COMPARE(cmp_gt, >)
+  KOKKOS_IMPL_SIMD_GENERIC_COMPARE(cmp_ge, >=)
+#undef KOKKOS_IMPL_SIMD_GENERIC_COMPARE
+
+  static KOKKOS_FORCEINLINE_FUNCTION mask mask_broadcast(bool a) {
+    mask m;
+    for (int i = 0; i < size; ++i) m.lane[i] = a;
+    return m;
+  }
+  // lanes [0, n) active
+  static KOKKOS_FORCEINLINE_FUNCTION mask mask_first(int n) {
+    mask m;
+    for (int i = 0; i < size; ++i) m.lane[i] = i < n;
+    return m;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION bool mask_get(mask const& m, int i) {
+    return m.lane[i];
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION mask mask_and(mask const& a,
+                                                   mask const& b) {
+    mask m;
+    for (int i = 0; i < size; ++i) m.lane[i] = a.lane[i] && b.lane[i];
+    return m;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION mask mask_or(mask const& a,
+                                                  mask const& b) {
+    mask m;
+    for (int i = 0; i < size; ++i) m.lane[i] = a.lane[i] || b.lane[i];
+    return m;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION mask mask_not(mask const& a) {
+    mask m;
+    for (int i = 0; i < size; ++i) m.lane[i] = !a.lane[i];
+    return m;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION int popcount(mask const& a) {
+    int n = 0;
+    for (int i = 0; i < size; ++i) n += a.lane[i] ? 1 : 0;
+    return n;
+  }
+
+  // lane-wise m ? b : a
+  static KOKKOS_FORCEINLINE_FUNCTION reg blend(mask const& m, reg const& a,
+                                               reg const& b) {
+    reg r;
+    for (int i = 0; i < size; ++i)
+      r.lane[i] = m.lane[i] ? b.lane[i] : a.lane[i];
+    return r;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION reg masked_load(mask const& m,
+                                                     reg const& a,
+                                                     T const* ptr) {
+    reg r;
+    for (int i = 0; i < size; ++i) r.lane[i] = m.lane[i] ? ptr[i] : a.lane[i];
+    return r;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION void masked_store(mask const& m,
+                                                       reg const& a, T* ptr) {
+    for (int i = 0; i < size; ++i)
+      if (m.lane[i]) ptr[i] = a.lane[i];
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION reg gather(mask const& m, reg const& a,
+                                                T const* ptr,
+                                                std::int32_t const* index) {
+    reg r;
+    for (int i = 0; i < size; ++i)
+      r.lane[i] = m.lane[i] ? ptr[index[i]] : a.lane[i];
+    return r;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION void scatter(mask const& m, reg const& a,
+                                                  T* ptr,
+                                                  std::int32_t const* index) {
+    for (int i = 0; i < size; ++i)
+      if (m.lane[i]) ptr[index[i]] = a.lane[i];
+  }
+
+  static KOKKOS_FORCEINLINE_FUNCTION T reduce_sum(reg const& a) {
+    T r = a.lane[0];
+    for (int i = 1; i < size; ++i) r += a.lane[i];
+    return r;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION T reduce_min(reg const& a) {
+    T r = a.lane[0];
+    for (int i = 1; i < size; ++i) r = a.lane[i] < r ? a.lane[i] : r;
+    return r;
+  }
+  static KOKKOS_FORCEINLINE_FUNCTION T reduce_max(reg const& a) {
+    T r = a.lane[0];
+    for (int i = 1; i < size; ++i) r = r < a.lane[i] ? a.lane[i] : r;
+    return r;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_SIMD_AVX2
+#include <impl/Kokkos_SIMD_AVX2.hpp>
+#endif
+#ifdef KOKKOS_IMPL_SIMD_AVX512
+#include <impl/Kokkos_SIMD_AVX512.hpp>
+#endif
+#ifdef KOKKOS_IMPL_SIMD_NEON
+#include <impl/Kokkos_SIMD_NEON.hpp>
+#endif
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace simd_abi {
+
+// the widest ABI with intrinsics for the host, for elements of type T
+#if defined(KOKKOS_IMPL_SIMD_AVX512)
+template <class T>
+using host_native = avx512_fixed_size<64 / sizeof(T)>;
+#elif defined(KOKKOS_IMPL_SIMD_AVX2)
+template <class T>
+using host_native = avx2_fixed_size<32 / sizeof(T)>;
+#elif defined(KOKKOS_IMPL_SIMD_NEON)
+template <class T>
+using host_native = neon_fixed_size<16 / sizeof(T)>;
+#else
+template <class T>
+using host_native = scalar;
+#endif
+
+template <class T>
+using native = host_native<T>;
+
+template <class Space, class T, class Enable = void>
+struct ForSpaceType {
+  using type = scalar;
+};
+
+template <class Space, class T>
+struct ForSpaceType<
+    Space, T,
+    typename std::enable_if<
+        Kokkos::SpaceAccessibility<typename Space::execution_space,
+                                   Kokkos::HostSpace>::accessible>::type> {
+  using type = host_native<T>;
+};
+
+/// The ABI to use for simd<T> in code running in the execution space Space:
+/// host_native<T> for host spaces, scalar for device spaces.
+template <class Space, class T = double>
+using ForSpace = typename ForSpaceType<Space, T>::type;
+
+}  // namespace simd_abi
+
+template <class T, class Abi = simd_abi::native<T>>
+class simd_mask {
+  using ops = Kokkos::Impl::SIMDOps<T, Abi>;
+  typename ops::mask m_mask;
+
+ public:
+  using value_type   = bool;
+  using abi_type     = Abi;
+  using simd_type    = simd<T, Abi>;
+  using storage_type = typename ops::mask;
+
+  static constexpr int size() { return ops::size; }
+
+  KOKKOS_DEFAULTED_FUNCTION simd_mask() = default;
+  KOKKOS_FORCEINLINE_FUNCTION explicit simd_mask(bool value)
+      : m_mask(ops::mask_broadcast(value)) {}
+  KOKKOS_FORCEINLINE_FUNCTION explicit simd_mask(storage_type const& m)
+      : m_mask(m) {}
+
+  /// Mask with the first n lanes active, for the remainder of a loop
+  static KOKKOS_FORCEINLINE_FUNCTION simd_mask first_n(int n) {
+    return simd_mask(ops::mask_first(n));
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION bool operator[](int i) const {
+    return ops::mask_get(m_mask, i);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION storage_type const& storage() const {
+    return m_mask;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd_mask operator&&(simd_mask const& a,
+                                                          simd_mask const& b) {
+    return simd_mask(ops::mask_and(a.m_mask, b.m_mask));
+  }
+  KOKKOS_FORCEINLINE_FUNCTION friend simd_mask operator||(simd_mask const& a,
+                                                          simd_mask const& b) {
+    return simd_mask(ops::mask_or(a.m_mask, b.m_mask));
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    return simd_mask(ops::mask_not(m_mask));
+  }
+};
+
+template <class T, class Abi = simd_abi::native<T>>
+class simd {
+  using ops = Kokkos::Impl::SIMDOps<T, Abi>;
+  typename ops::reg m_reg;
+
+ public:
+  using value_type   = T;
+  using abi_type     = Abi;
+  using mask_type    = simd_mask<T, Abi>;
+  using storage_type = typename ops::reg;
+
+  static constexpr int size() { return ops::size; }
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_FORCEINLINE_FUNCTION simd(T value) : m_reg(ops::broadcast(value)) {}
+  KOKKOS_FORCEINLINE_FUNCTION explicit simd(storage_type const& r)
+      : m_reg(r) {}
+  KOKKOS_FORCEINLINE_FUNCTION simd(T const* ptr, element_aligned_tag)
+      : m_reg(ops::load(ptr)) {}
+  KOKKOS_FORCEINLINE_FUNCTION simd(T const* ptr, vector_aligned_tag)
+      : m_reg(ops::load_aligned(ptr)) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(T const* ptr,
+                                             element_aligned_tag) {
+    m_reg = ops::load(ptr);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(T const* ptr, vector_aligned_tag) {
+    m_reg = ops::load_aligned(ptr);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(T* ptr, element_aligned_tag) const {
+    ops::store(ptr, m_reg);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(T* ptr, vector_aligned_tag) const {
+    ops::store_aligned(ptr, m_reg);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION T operator[](int i) const {
+    return ops::get(m_reg, i);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION storage_type const& storage() const {
+    return m_reg;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(ops::neg(m_reg));
+  }
+
+#define KOKKOS_IMPL_SIMD_BINARY_OPERATOR(OP, NAME)                           \
+  KOKKOS_FORCEINLINE_FUNCTION friend simd operator OP(simd const& a,         \
+                                                      simd const& b) {       \
+    return simd(ops::NAME(a.m_reg, b.m_reg));                                \
+  }                                                                          \
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator OP##=(simd const& b) {          \
+    m_reg = ops::NAME(m_reg, b.m_reg);                                       \
+    return *this;                                                            \
+  }                                                                          \
+  KOKKOS_FORCEINLINE_FUNCTION void operator OP##=(simd const volatile& b)    \
+      volatile {                                                             \
+    simd& self = const_cast<simd&>(*this);                                   \
+    self.m_reg = ops::NAME(self.m_reg, const_cast<simd const&>(b).m_reg);    \
+  }
+  KOKKOS_IMPL_SIMD_BINARY_OPERATOR(+, add)
+  KOKKOS_IMPL_SIMD_BINARY_OPERATOR(-, sub)
+  KOKKOS_IMPL_SIMD_BINARY_OPERATOR(*, mul)
+  KOKKOS_IMPL_SIMD_BINARY_OPERATOR(/, div)
+#undef KOKKOS_IMPL_SIMD_BINARY_OPERATOR
+
+#define KOKKOS_IMPL_SIMD_COMPARE_OPERATOR(OP, NAME)                          \
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator OP(simd const& a,    \
+                                                           simd const& b) {  \
+    return mask_type(ops::NAME(a.m_reg, b.m_reg));                           \
+  }
+  KOKKOS_IMPL_SIMD_COMPARE_OPERATOR(==, cmp_eq)
+  KOKKOS_IMPL_SIMD_COMPARE_OPERATOR(!=, cmp_ne)
+  KOKKOS_IMPL_SIMD_COMPARE_OPERATOR(<, cmp_lt)
+  KOKKOS_IMPL_SIMD_COMPARE_OPERATOR(<=, cmp_le)
+  KOKKOS_IMPL_SIMD_COMPARE_OPERATOR(>, cmp_gt)
+  KOKKOS_IMPL_SIMD_COMPARE_OPERATOR(>=, cmp_ge)
+#undef KOKKOS_IMPL_SIMD_COMPARE_OPERATOR
+};
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> min(simd<T, Abi> const& a,
+                                             simd<T, Abi> const& b) {
+  return simd<T, Abi>(
+      Kokkos::Impl::SIMDOps<T, Abi>::min(a.storage(), b.storage()));
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> max(simd<T, Abi> const& a,
+                                             simd<T, Abi> const& b) {
+  return simd<T, Abi>(
+      Kokkos::Impl::SIMDOps<T, Abi>::max(a.storage(), b.storage()));
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> abs(simd<T, Abi> const& a) {
+  return simd<T, Abi>(Kokkos::Impl::SIMDOps<T, Abi>::abs(a.storage()));
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> sqrt(simd<T, Abi> const& a) {
+  return simd<T, Abi>(Kokkos::Impl::SIMDOps<T, Abi>::sqrt(a.storage()));
+}
+
+/// a * b + c, fused where the ABI supports it
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> fma(simd<T, Abi> const& a,
+                                             simd<T, Abi> const& b,
+                                             simd<T, Abi> const& c) {
+  return simd<T, Abi>(Kokkos::Impl::SIMDOps<T, Abi>::fma(
+      a.storage(), b.storage(), c.storage()));
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION bool all_of(simd_mask<T, Abi> const& m) {
+  return Kokkos::Impl::SIMDOps<T, Abi>::popcount(m.storage()) ==
+         simd_mask<T, Abi>::size();
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION bool any_of(simd_mask<T, Abi> const& m) {
+  return Kokkos::Impl::SIMDOps<T, Abi>::popcount(m.storage()) != 0;
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION bool none_of(simd_mask<T, Abi> const& m) {
+  return Kokkos::Impl::SIMDOps<T, Abi>::popcount(m.storage()) == 0;
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION int popcount(simd_mask<T, Abi> const& m) {
+  return Kokkos::Impl::SIMDOps<T, Abi>::popcount(m.storage());
+}
+
+/// Lane-wise selection m ? b : a
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> choose(simd_mask<T, Abi> const& m,
+                                                simd<T, Abi> const& b,
+                                                simd<T, Abi> const& a) {
+  return simd<T, Abi>(Kokkos::Impl::SIMDOps<T, Abi>::blend(
+      m.storage(), a.storage(), b.storage()));
+}
+
+/// Index vector for gather_from/scatter_to: one 32-bit offset per lane
+template <class T, class Abi>
+using simd_index =
+    simd<std::int32_t, simd_abi::fixed_size<simd<T, Abi>::size()>>;
+
+/* const_where_expression and where_expression are returned by where(mask, v)
+ * and apply an operation to the lanes of v selected by the mask only:
+ *   where(m, v) = x;                    // masked assignment
+ *   where(m, v).copy_from(ptr, tag);    // masked load
+ *   where(m, v).copy_to(ptr, tag);      // masked store
+ *   where(m, v).gather_from(ptr, idx);  // masked gather of ptr[idx[i]]
+ *   where(m, v).scatter_to(ptr, idx);   // masked scatter to ptr[idx[i]]
+ * Inactive lanes of ptr are never read or written. */
+template <class T, class Abi>
+class const_where_expression {
+ protected:
+  using ops = Kokkos::Impl::SIMDOps<T, Abi>;
+  simd_mask<T, Abi> const m_mask;
+  simd<T, Abi> const& m_value;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION const_where_expression(
+      simd_mask<T, Abi> const& m, simd<T, Abi> const& v)
+      : m_mask(m), m_value(v) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION simd_mask<T, Abi> const& mask() const {
+    return m_mask;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> const& value() const {
+    return m_value;
+  }
+
+  template <class Tag>
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(T* ptr, Tag) const {
+    ops::masked_store(m_mask.storage(), m_value.storage(), ptr);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void scatter_to(
+      T* ptr, simd_index<T, Abi> const& index) const {
+    ops::scatter(m_mask.storage(), m_value.storage(), ptr,
+                 index.storage().lane);
+  }
+};
+
+template <class T, class Abi>
+class where_expression : public const_where_expression<T, Abi> {
+  using base = const_where_expression<T, Abi>;
+  using ops  = typename base::ops;
+  simd<T, Abi>& m_target;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION where_expression(simd_mask<T, Abi> const& m,
+                                               simd<T, Abi>& v)
+      : base(m, v), m_target(v) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator=(simd<T, Abi> const& x) {
+    m_target = simd<T, Abi>(
+        ops::blend(this->m_mask.storage(), m_target.storage(), x.storage()));
+  }
+  template <class Tag>
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(T const* ptr, Tag) {
+    m_target = simd<T, Abi>(
+        ops::masked_load(this->m_mask.storage(), m_target.storage(), ptr));
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void gather_from(
+      T const* ptr, simd_index<T, Abi> const& index) {
+    m_target = simd<T, Abi>(ops::gather(this->m_mask.storage(),
+                                        m_target.storage(), ptr,
+                                        index.storage().lane));
+  }
+};
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION where_expression<T, Abi> where(
+    simd_mask<T, Abi> const& m, simd<T, Abi>& v) {
+  return where_expression<T, Abi>(m, v);
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION const_where_expression<T, Abi> where(
+    simd_mask<T, Abi> const& m, simd<T, Abi> const& v) {
+  return const_where_expression<T, Abi>(m, v);
+}
+
+/// Horizontal reductions over all lanes, or over the lanes selected by a
+/// where expression (at least one lane must be selected for hmin/hmax).
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION T reduce(simd<T, Abi> const& a) {
+  return Kokkos::Impl::SIMDOps<T, Abi>::reduce_sum(a.storage());
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION T hmin(simd<T, Abi> const& a) {
+  return Kokkos::Impl::SIMDOps<T, Abi>::reduce_min(a.storage());
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION T hmax(simd<T, Abi> const& a) {
+  return Kokkos::Impl::SIMDOps<T, Abi>::reduce_max(a.storage());
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION T reduce(const_where_expression<T, Abi> const& x) {
+  return reduce(choose(x.mask(), x.value(),
+                       simd<T, Abi>(Kokkos::reduction_identity<T>::sum())));
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION T hmin(const_where_expression<T, Abi> const& x) {
+  return hmin(choose(x.mask(), x.value(),
+                     simd<T, Abi>(Kokkos::reduction_identity<T>::min())));
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION T hmax(const_where_expression<T, Abi> const& x) {
+  return hmax(choose(x.mask(), x.value(),
+                     simd<T, Abi>(Kokkos::reduction_identity<T>::max())));
+}
+
+/// Run f(i, mask) for i = start, start + size, ... over a ThreadVectorRange
+/// of a host team, where mask selects the lanes i + l < end. Every call but
+/// the last sees a full mask, so the body can be written for whole packs
+/// and the remainder is handled by masked loads and stores:
+///
+///   simd_for<double>(ThreadVectorRange(member, n),
+///                    [&](int i, simd_mask<double> const& m) {
+///     simd<double> x;
+///     where(m, x).copy_from(&a(i), element_aligned_tag());
+///     where(m, x * x).copy_to(&b(i), element_aligned_tag());
+///   });
+template <class T, class Abi = simd_abi::native<T>, class iType,
+          class TeamMemberType, class Lambda>
+KOKKOS_INLINE_FUNCTION void simd_for(
+    Kokkos::Impl::ThreadVectorRangeBoundariesStruct<
+        iType, TeamMemberType> const& range,
+    Lambda const& lambda) {
+  static_assert(
+      Kokkos::SpaceAccessibility<typename TeamMemberType::execution_space,
+                                 Kokkos::HostSpace>::accessible,
+      "Kokkos::Experimental::simd_for requires a host execution space");
+  using mask_type  = simd_mask<T, Abi>;
+  constexpr int n  = mask_type::size();
+  mask_type const full(true);
+  iType i = range.start;
+  for (; i + n <= range.end; i += n) lambda(i, full);
+  if (i < range.end) lambda(i, mask_type::first_n(int(range.end - i)));
+}
+
+}  // namespace Experimental
+
+/// Lane-wise reduction identities, so that simd can be the value type of
+/// Kokkos::Sum and Kokkos::Prod. The volatile compound assignments of simd
+/// serve the volatile join of those reducers.
+template <class T, class Abi>
+struct reduction_identity<Kokkos::Experimental::simd<T, Abi>> {
+  using simd_type = Kokkos::Experimental::simd<T, Abi>;
+  KOKKOS_FORCEINLINE_FUNCTION static simd_type sum() {
+    return simd_type(reduction_identity<T>::sum());
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static simd_type prod() {
+    return simd_type(reduction_identity<T>::prod());
+  }
+};
+
+}  // namespace Kokkos
+
+#endif
@@ -66,6 +66,8 @@
 #include <impl/Kokkos_FunctorAdapter.hpp>
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_ExecSpaceInitializer.hpp>
+#include <impl/Kokkos_HostCopyEngine.hpp>
+#include <impl/Kokkos_HostReduceLanes.hpp>
 
 #include <KokkosExp_MDRangePolicy.hpp>
 
@@ -121,9 +123,9 @@ class Serial {
   /// return asynchronously, before the functor completes.  This
   /// method does not return until all dispatched functors on this
   /// device have completed.
-  static void impl_static_fence() {}
+  static void impl_static_fence() { Impl::host_copy_engine_fence(); }
 
-  void fence() const {}
+  void fence() const { Impl::host_copy_engine_fence(); }
 
   /** \brief  Return the maximum amount of concurrency.  */
   static int concurrency() { return 1; }
@@ -485,30 +487,17 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
   using pointer_type   = typename Analysis::pointer_type;
   using reference_type = typename Analysis::reference_type;
 
+  static_assert(alignof(typename Analysis::value_type) <=
+                    HostThreadTeamData::max_reduce_alignment,
+                "Kokkos::Serial reduction value type is over-aligned for the reduce "
+                "scratch");
+
   const FunctorType m_functor;
   const Policy m_policy;
   const ReducerType m_reducer;
   const pointer_type m_result_ptr;
 
-  template <class TagType>
-  inline typename std::enable_if<std::is_same<TagType, void>::value>::type exec(
-      reference_type update) const {
-    const typename Policy::member_type e = m_policy.end();
-    for (typename Policy::member_type i = m_policy.begin(); i < e; ++i) {
-      m_functor(i, update);
-    }
-  }
-
-  template <class TagType>
-  inline typename std::enable_if<!std::is_same<TagType, void>::value>::type
-  exec(reference_type update) const {
-    const TagType t{};
-
-    const typename Policy::member_type e = m_policy.end();
-    for (typename Policy::member_type i = m_policy.begin(); i < e; ++i) {
-      m_functor(t, i, update);
-    }
-  }
+  using Lanes = HostReduceLanes<Policy, FunctorType, ReducerType>;
 
  public:
   inline void execute() const {
@@ -529,7 +518,9 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
     reference_type update =
         ValueInit::init(ReducerConditional::select(m_functor, m_reducer), ptr);
 
-    this->template exec<WorkTag>(update);
+    Lanes::exec_range(m_functor,
+                      ReducerConditional::select(m_functor, m_reducer),
+                      m_policy.begin(), m_policy.end(), update);
 
     Kokkos::Impl::FunctorFinal<ReducerTypeFwd, WorkTagFwd>::final(
         ReducerConditional::select(m_functor, m_reducer), ptr);
@@ -763,6 +754,11 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
   using value_type     = typename Analysis::value_type;
   using reference_type = typename Analysis::reference_type;
 
+  static_assert(alignof(typename Analysis::value_type) <=
+                    HostThreadTeamData::max_reduce_alignment,
+                "Kokkos::Serial reduction value type is over-aligned for the reduce "
+                "scratch");
+
   using iterate_type =
       typename Kokkos::Impl::HostIterateTile<MDRangePolicy, FunctorType,
                                              WorkTag, reference_type>;
@@ -931,6 +927,11 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
   using pointer_type   = typename Analysis::pointer_type;
   using reference_type = typename Analysis::reference_type;
 
+  static_assert(alignof(typename Analysis::value_type) <=
+                    HostThreadTeamData::max_reduce_alignment,
+                "Kokkos::Serial reduction value type is over-aligned for the reduce "
+                "scratch");
+
   const FunctorType m_functor;
   const int m_league;
   const ReducerType m_reducer;
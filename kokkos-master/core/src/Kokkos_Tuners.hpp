@@ -59,6 +59,11 @@
 #include <cassert>
 
 namespace Kokkos {
+
+// forward declaration
+template <typename... Properties>
+struct MDRangePolicy;
+
 namespace Tools {
 
 namespace Experimental {
@@ -77,6 +82,8 @@ SetOrRange make_candidate_range(double lower, double upper, double step,
 size_t get_new_context_id();
 void begin_context(size_t context_id);
 void end_context(size_t context_id);
+void set_input_values(size_t contextId, size_t count, VariableValue* values);
+size_t get_problem_size_context_variable_id();
 namespace Impl {
 
 /** We're going to take in search space descriptions
@@ -106,6 +113,7 @@ struct ValueHierarchyNode {
 template <typename ValueType>
 struct ValueHierarchyNode<ValueType, void> {
   std::vector<ValueType> root_values;
+  ValueHierarchyNode() = default;
   explicit ValueHierarchyNode(std::vector<ValueType> rv)
       : root_values(std::move(rv)) {}
   void add_root_value(const ValueType& in) noexcept {
@@ -326,15 +334,22 @@ class MultidimensionalSparseTuningProblem {
     }
   }
 
-  auto begin() {
+  // Returns value-initialized values when nobody answered the request
+  auto begin(size_t num_inputs = 0, VariableValue* inputs = nullptr) {
     context = Kokkos::Tools::Experimental::get_new_context_id();
     ValueArray values;
     for (int x = 0; x < space_dimensionality; ++x) {
       values[x] = Kokkos::Tools::Experimental::make_variable_value(
-          variable_ids[x], 0.0);
+          variable_ids[x], -1.0);
     }
     begin_context(context);
+    if (num_inputs > 0) set_input_values(context, num_inputs, inputs);
     request_output_values(context, space_dimensionality, values.data());
+    for (int x = 0; x < space_dimensionality; ++x) {
+      if (!(values[x].value.double_value >= tuning_min)) {
+        return decltype(get_point(m_space, values)){};
+      }
+    }
     return get_point(m_space, values);
   }
 
@@ -452,7 +467,10 @@ class TeamSizeTuner {
   template <typename... Properties>
   void tune(Kokkos::TeamPolicy<Properties...>& policy) {
     if (Kokkos::Tools::Experimental::have_tuning_tool()) {
-      auto configuration = tuner.begin();
+      auto problem_size  =
+          make_variable_value(get_problem_size_context_variable_id(),
+                              int64_t(policy.league_size()));
+      auto configuration = tuner.begin(1, &problem_size);
       auto team_size     = std::get<1>(configuration);
       auto vector_length = std::get<0>(configuration);
       if (vector_length > 0) {
@@ -470,6 +488,159 @@ class TeamSizeTuner {
  private:
 };
 
+/* CandidateSetTuningProblem - a single integer output variable chosen among
+ * a set of candidate values, so that a tool searches exactly those. */
+class CandidateSetTuningProblem {
+ private:
+  size_t variable_id = 0;
+  size_t context     = 0;
+
+ public:
+  CandidateSetTuningProblem() = default;
+  CandidateSetTuningProblem(const std::string& name,
+                            std::vector<int64_t> candidates) {
+    VariableInfo info;
+    info.type     = Kokkos::Tools::Experimental::ValueType::kokkos_value_int64;
+    info.category = Kokkos::Tools::Experimental::StatisticalCategory::
+        kokkos_value_ordinal;
+    info.valueQuantity =
+        Kokkos::Tools::Experimental::CandidateValueType::kokkos_value_set;
+    info.candidates = Kokkos::Tools::Experimental::make_candidate_set(
+        candidates.size(), candidates.data());
+    variable_id = declare_output_type(name, info);
+  }
+
+  // Returns zero when nobody answered the request
+  int64_t begin(size_t num_inputs = 0, VariableValue* inputs = nullptr) {
+    context = Kokkos::Tools::Experimental::get_new_context_id();
+    VariableValue value = Kokkos::Tools::Experimental::make_variable_value(
+        variable_id, int64_t(0));
+    begin_context(context);
+    if (num_inputs > 0) set_input_values(context, num_inputs, inputs);
+    request_output_values(context, 1, &value);
+    return value.value.int_value;
+  }
+
+  void end() { end_context(context); }
+};
+
+/* ChunkSizeTuner - chooses the chunk size of a RangePolicy among the powers
+ * of two within a factor 64 of the automatic one.  The candidates depend on
+ * the length of the range, so each power of two of the length is a
+ * separate problem, named <name>_chunk_size_log2_<floor(log2(length))>. */
+class ChunkSizeTuner {
+ private:
+  std::string m_name;
+  std::map<int, CandidateSetTuningProblem> m_problems;
+  CandidateSetTuningProblem* m_active = nullptr;
+
+  template <typename... Properties>
+  static std::vector<int64_t> candidates(
+      const Kokkos::RangePolicy<Properties...>& policy) {
+    using PolicyType    = Kokkos::RangePolicy<Properties...>;
+    int64_t concurrency = PolicyType::execution_space::concurrency();
+    if (concurrency < 1) concurrency = 1;
+    const int64_t work_per_thread =
+        (int64_t(policy.end() - policy.begin()) + concurrency - 1) /
+        concurrency;
+    const int64_t automatic = policy.chunk_size();
+    std::vector<int64_t> chunks;
+    for (int64_t chunk = 1; chunk <= 64 * automatic; chunk *= 2) {
+      if (64 * chunk < automatic) continue;
+      if (chunk > automatic && chunk > work_per_thread) break;
+      chunks.push_back(chunk);
+    }
+    return chunks;
+  }
+
+ public:
+  ChunkSizeTuner() = default;
+  explicit ChunkSizeTuner(const std::string& name) : m_name(name) {}
+
+  template <typename... Properties>
+  void tune(Kokkos::RangePolicy<Properties...>& policy) {
+    m_active = nullptr;
+    const int64_t length = int64_t(policy.end() - policy.begin());
+    if (length < 1 || !Kokkos::Tools::Experimental::have_tuning_tool()) {
+      return;
+    }
+    int log2_length = -1;
+    for (int64_t n = length; n > 0; n >>= 1) ++log2_length;
+    auto problem = m_problems.find(log2_length);
+    if (problem == m_problems.end()) {
+      problem = m_problems
+                    .emplace(log2_length,
+                             CandidateSetTuningProblem(
+                                 m_name + "_chunk_size_log2_" +
+                                     std::to_string(log2_length),
+                                 candidates(policy)))
+                    .first;
+    }
+    m_active          = &problem->second;
+    auto problem_size = make_variable_value(
+        get_problem_size_context_variable_id(), length);
+    const int64_t chunk_size = m_active->begin(1, &problem_size);
+    if (chunk_size > 0) {
+      policy.impl_set_chunk_size(chunk_size);
+    }
+  }
+  void end() {
+    if (m_active != nullptr) {
+      m_active->end();
+      m_active = nullptr;
+    }
+  }
+};
+
+/* MDRangeTuner - chooses among the tile shapes of a host MDRangePolicy
+ * computed for a range of cache budgets around the default one. */
+class MDRangeTuner {
+ private:
+  CandidateSetTuningProblem tuner;
+  std::vector<std::vector<int64_t>> candidates;
+
+ public:
+  MDRangeTuner() = default;
+  template <typename... Properties>
+  MDRangeTuner(const std::string& name,
+               const Kokkos::MDRangePolicy<Properties...>& policy) {
+    std::vector<int64_t> indices;
+    // Candidates are numbered from 1, 0 means no choice was made
+    for (auto const& tile : policy.impl_tile_size_candidates()) {
+      candidates.emplace_back(tile.data(), tile.data() + tile.size());
+      indices.push_back(candidates.size());
+    }
+    tuner = CandidateSetTuningProblem(name + "_tile_shape", indices);
+  }
+
+  template <typename... Properties>
+  void tune(Kokkos::MDRangePolicy<Properties...>& policy) {
+    using PolicyType = Kokkos::MDRangePolicy<Properties...>;
+    if (Kokkos::Tools::Experimental::have_tuning_tool()) {
+      int64_t size = 1;
+      for (int i = 0; i < PolicyType::rank; ++i) {
+        size *= int64_t(policy.m_upper[i] - policy.m_lower[i]);
+      }
+      auto problem_size  = make_variable_value(
+          get_problem_size_context_variable_id(), size);
+      const int64_t index = tuner.begin(1, &problem_size);
+      if (1 <= index && size_t(index) <= candidates.size() &&
+          candidates[index - 1].size() == size_t(PolicyType::rank)) {
+        typename PolicyType::tile_type tile;
+        for (int i = 0; i < PolicyType::rank; ++i) {
+          tile[i] = candidates[index - 1][i];
+        }
+        policy.impl_change_tile_size(tile);
+      }
+    }
+  }
+  void end() {
+    if (Kokkos::Tools::Experimental::have_tuning_tool()) {
+      tuner.end();
+    }
+  }
+};
+
 }  // namespace Experimental
 }  // namespace Tools
 }  // namespace Kokkos
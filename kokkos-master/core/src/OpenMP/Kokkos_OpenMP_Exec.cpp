@@ -447,7 +447,7 @@ OpenMP OpenMP::create_instance(...) { return OpenMP(); }
 
 int OpenMP::concurrency() { return Impl::g_openmp_hardware_max_threads; }
 
-void OpenMP::fence() const {}
+void OpenMP::fence() const { Impl::host_copy_engine_fence(); }
 
 namespace Impl {
 
@@ -51,6 +51,7 @@
 #include <omp.h>
 #include <OpenMP/Kokkos_OpenMP_Exec.hpp>
 #include <impl/Kokkos_FunctorAdapter.hpp>
+#include <impl/Kokkos_HostReduceLanes.hpp>
 
 #include <KokkosExp_MDRangePolicy.hpp>
 
@@ -110,9 +111,17 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
                                 Kokkos::Dynamic>::value
     };
 
-    if (OpenMP::in_parallel()) {
+    if (m_policy.end() <= m_policy.begin()) return;
+
+    // Without threads to share the work with, entering a parallel region
+    // only adds latency to the launch.
+    if (OpenMP::in_parallel() || OpenMP::impl_thread_pool_size() == 1) {
       exec_range<WorkTag>(m_functor, m_policy.begin(), m_policy.end());
     } else {
+      // A launch on several threads still opens a parallel region: the pool
+      // threads belong to the OpenMP runtime, which parks them between
+      // regions, and functors may rely on omp_get_thread_num().  The
+      // Threads backend is the one dispatching to a persistent pool.
       OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_for");
 
 #pragma omp parallel num_threads(OpenMP::impl_thread_pool_size())
@@ -130,7 +139,7 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
         std::pair<int64_t, int64_t> range(0, 0);
 
         do {
-          range = is_dynamic ? data.get_work_stealing_chunk()
+          range = is_dynamic ? data.get_work_deque_chunk()
                              : data.get_work_partition();
 
           ParallelFor::template exec_range<WorkTag>(
@@ -189,7 +198,9 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
                                 Kokkos::Dynamic>::value
     };
 
-    if (OpenMP::in_parallel()) {
+    if (m_policy.end() <= m_policy.begin()) return;
+
+    if (OpenMP::in_parallel() || OpenMP::impl_thread_pool_size() == 1) {
       ParallelFor::exec_range(m_mdr_policy, m_functor, m_policy.begin(),
                               m_policy.end());
     } else {
@@ -210,7 +221,7 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
         std::pair<int64_t, int64_t> range(0, 0);
 
         do {
-          range = is_dynamic ? data.get_work_stealing_chunk()
+          range = is_dynamic ? data.get_work_deque_chunk()
                              : data.get_work_partition();
 
           ParallelFor::exec_range(m_mdr_policy, m_functor,
@@ -268,33 +279,19 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
   using pointer_type   = typename Analysis::pointer_type;
   using reference_type = typename Analysis::reference_type;
 
+  static_assert(alignof(typename Analysis::value_type) <=
+                    HostThreadTeamData::max_reduce_alignment,
+                "Kokkos::OpenMP reduction value type is over-aligned for the reduce "
+                "scratch");
+
+  using Lanes = HostReduceLanes<Policy, FunctorType, ReducerType>;
+
   OpenMPExec* m_instance;
   const FunctorType m_functor;
   const Policy m_policy;
   const ReducerType m_reducer;
   const pointer_type m_result_ptr;
 
-  template <class TagType>
-  inline static
-      typename std::enable_if<std::is_same<TagType, void>::value>::type
-      exec_range(const FunctorType& functor, const Member ibeg,
-                 const Member iend, reference_type update) {
-    for (Member iwork = ibeg; iwork < iend; ++iwork) {
-      functor(iwork, update);
-    }
-  }
-
-  template <class TagType>
-  inline static
-      typename std::enable_if<!std::is_same<TagType, void>::value>::type
-      exec_range(const FunctorType& functor, const Member ibeg,
-                 const Member iend, reference_type update) {
-    const TagType t{};
-    for (Member iwork = ibeg; iwork < iend; ++iwork) {
-      functor(t, iwork, update);
-    }
-  }
-
  public:
   inline void execute() const {
     if (m_policy.end() <= m_policy.begin()) {
@@ -324,41 +321,65 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
     );
 
     const int pool_size = OpenMP::impl_thread_pool_size();
-#pragma omp parallel num_threads(pool_size)
-    {
-      HostThreadTeamData& data = *(m_instance->get_thread_data());
-
-      data.set_work_partition(m_policy.end() - m_policy.begin(),
-                              m_policy.chunk_size());
 
-      if (is_dynamic) {
-        // Make sure work partition is set before stealing
-        if (data.pool_rendezvous()) data.pool_rendezvous_release();
-      }
+    if (pool_size == 1) {
+      // As for parallel_for, skip the parallel region when the master
+      // thread would be the only one in it.
+      HostThreadTeamData& data = *(m_instance->get_thread_data(0));
 
       reference_type update =
           ValueInit::init(ReducerConditional::select(m_functor, m_reducer),
                           data.pool_reduce_local());
 
-      std::pair<int64_t, int64_t> range(0, 0);
+      Lanes::exec_range(m_functor,
+                        ReducerConditional::select(m_functor, m_reducer),
+                        m_policy.begin(), m_policy.end(), update);
+    } else {
+#pragma omp parallel num_threads(pool_size)
+      {
+        HostThreadTeamData& data = *(m_instance->get_thread_data());
 
-      do {
-        range = is_dynamic ? data.get_work_stealing_chunk()
-                           : data.get_work_partition();
+        data.set_work_partition(m_policy.end() - m_policy.begin(),
+                                m_policy.chunk_size());
 
-        ParallelReduce::template exec_range<WorkTag>(
-            m_functor, range.first + m_policy.begin(),
-            range.second + m_policy.begin(), update);
+        if (is_dynamic) {
+          // Make sure work partition is set before stealing
+          if (data.pool_rendezvous()) data.pool_rendezvous_release();
+        }
 
-      } while (is_dynamic && 0 <= range.first);
+        reference_type update =
+            ValueInit::init(ReducerConditional::select(m_functor, m_reducer),
+                            data.pool_reduce_local());
+
+        std::pair<int64_t, int64_t> range(0, 0);
+
+        do {
+          range = is_dynamic ? data.get_work_deque_chunk()
+                             : data.get_work_partition();
+
+          Lanes::exec_range(m_functor,
+                            ReducerConditional::select(m_functor, m_reducer),
+                            range.first + m_policy.begin(),
+                            range.second + m_policy.begin(), update);
+
+        } while (is_dynamic && 0 <= range.first);
+
+        // Group leaders join the values of their group while the other
+        // threads leave the parallel region.
+        data.pool_reduce_group([&](int64_t* dst, const int64_t* src) {
+          ValueJoin::join(ReducerConditional::select(m_functor, m_reducer),
+                          dst, src);
+        });
+      }
     }
 
     // Reduction:
 
-    const pointer_type ptr =
-        pointer_type(m_instance->get_thread_data(0)->pool_reduce_local());
+    HostThreadTeamData& root = *(m_instance->get_thread_data(0));
+    const pointer_type ptr   = pointer_type(root.pool_reduce_local());
+    const int group_size     = root.pool_group_size();
 
-    for (int i = 1; i < pool_size; ++i) {
+    for (int i = group_size; i < pool_size; i += group_size) {
       ValueJoin::join(ReducerConditional::select(m_functor, m_reducer), ptr,
                       m_instance->get_thread_data(i)->pool_reduce_local());
     }
@@ -440,6 +461,11 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
   using value_type     = typename Analysis::value_type;
   using reference_type = typename Analysis::reference_type;
 
+  static_assert(alignof(typename Analysis::value_type) <=
+                    HostThreadTeamData::max_reduce_alignment,
+                "Kokkos::OpenMP reduction value type is over-aligned for the reduce "
+                "scratch");
+
   using iterate_type =
       typename Kokkos::Impl::HostIterateTile<MDRangePolicy, FunctorType,
                                              WorkTag, reference_type>;
@@ -499,7 +525,7 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
       std::pair<int64_t, int64_t> range(0, 0);
 
       do {
-        range = is_dynamic ? data.get_work_stealing_chunk()
+        range = is_dynamic ? data.get_work_deque_chunk()
                            : data.get_work_partition();
 
         ParallelReduce::exec_range(m_mdr_policy, m_functor,
@@ -507,15 +533,23 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
                                    range.second + m_policy.begin(), update);
 
       } while (is_dynamic && 0 <= range.first);
+
+      // Group leaders join the values of their group while the other
+      // threads leave the parallel region.
+      data.pool_reduce_group([&](int64_t* dst, const int64_t* src) {
+        ValueJoin::join(ReducerConditional::select(m_functor, m_reducer), dst,
+                        src);
+      });
     }
     // END #pragma omp parallel
 
     // Reduction:
 
-    const pointer_type ptr =
-        pointer_type(m_instance->get_thread_data(0)->pool_reduce_local());
+    HostThreadTeamData& root = *(m_instance->get_thread_data(0));
+    const pointer_type ptr   = pointer_type(root.pool_reduce_local());
+    const int group_size     = root.pool_group_size();
 
-    for (int i = 1; i < pool_size; ++i) {
+    for (int i = group_size; i < pool_size; i += group_size) {
       ValueJoin::join(ReducerConditional::select(m_functor, m_reducer), ptr,
                       m_instance->get_thread_data(i)->pool_reduce_local());
     }
@@ -972,6 +1006,11 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
   using pointer_type   = typename Analysis::pointer_type;
   using reference_type = typename Analysis::reference_type;
 
+  static_assert(alignof(typename Analysis::value_type) <=
+                    HostThreadTeamData::max_reduce_alignment,
+                "Kokkos::OpenMP reduction value type is over-aligned for the reduce "
+                "scratch");
+
   OpenMPExec* m_instance;
   const FunctorType m_functor;
   const Policy m_policy;
@@ -1089,21 +1128,30 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
 
       //  This thread has updated 'pool_reduce_local()' with its
       //  contributions to the reduction.  The parallel region is
-      //  about to terminate and the master thread will load and
-      //  reduce each 'pool_reduce_local()' contribution.
+      //  about to terminate and the group leaders and the master
+      //  thread will load and reduce each 'pool_reduce_local()'
+      //  contribution.
       //  Must 'memory_fence()' to guarantee that storing the update to
       //  'pool_reduce_local()' will complete before this thread
       //  exits the parallel region.
 
       memory_fence();
+
+      // Group leaders join the values of their group while the other
+      // threads leave the parallel region.
+      data.pool_reduce_group([&](int64_t* dst, const int64_t* src) {
+        ValueJoin::join(ReducerConditional::select(m_functor, m_reducer), dst,
+                        src);
+      });
     }
 
     // Reduction:
 
-    const pointer_type ptr =
-        pointer_type(m_instance->get_thread_data(0)->pool_reduce_local());
+    HostThreadTeamData& root = *(m_instance->get_thread_data(0));
+    const pointer_type ptr   = pointer_type(root.pool_reduce_local());
+    const int group_size     = root.pool_group_size();
 
-    for (int i = 1; i < pool_size; ++i) {
+    for (int i = group_size; i < pool_size; i += group_size) {
       ValueJoin::join(ReducerConditional::select(m_functor, m_reducer), ptr,
                       m_instance->get_thread_data(i)->pool_reduce_local());
     }
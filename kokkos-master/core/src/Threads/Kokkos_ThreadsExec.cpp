@@ -121,6 +121,7 @@ void ThreadsExec::driver(void) {
 
     // Deactivate thread and wait for reactivation
     this_thread.m_pool_state = ThreadsExec::Inactive;
+    host_thread_wake(this_thread.m_pool_state);
 
     wait_yield(this_thread.m_pool_state, ThreadsExec::Inactive);
   }
@@ -172,6 +173,7 @@ ThreadsExec::ThreadsExec()
       // Inform spawning process that the threads_exec entry could not be set.
       s_threads_process.m_pool_state = ThreadsExec::Terminating;
     }
+    host_thread_wake(s_threads_process.m_pool_state);
   } else {
     // Enables 'parallel_for' to execute on unitialized Threads device
     m_pool_rank  = 0;
@@ -212,6 +214,7 @@ ThreadsExec::~ThreadsExec() {
     atomic_compare_exchange(s_threads_exec + entry, this, nil);
 
     s_threads_process.m_pool_state = ThreadsExec::Terminating;
+    host_thread_wake(s_threads_process.m_pool_state);
   }
 }
 
@@ -324,6 +327,7 @@ void ThreadsExec::start(void (*func)(ThreadsExec &, const void *),
   // Activate threads:
   for (int i = s_thread_pool_size[0]; 0 < i--;) {
     s_threads_exec[i]->m_pool_state = ThreadsExec::Active;
+    host_thread_wake(s_threads_exec[i]->m_pool_state);
   }
 
   if (s_threads_process.m_pool_size) {
@@ -349,6 +353,7 @@ bool ThreadsExec::sleep() {
   // Activate threads:
   for (unsigned i = s_thread_pool_size[0]; 0 < i;) {
     s_threads_exec[--i]->m_pool_state = ThreadsExec::Active;
+    host_thread_wake(s_threads_exec[i]->m_pool_state);
   }
 
   return true;
@@ -386,6 +391,7 @@ void ThreadsExec::execute_serial(void (*func)(ThreadsExec &, const void *)) {
     ThreadsExec &th = *s_threads_exec[--i];
 
     th.m_pool_state = ThreadsExec::Active;
+    host_thread_wake(th.m_pool_state);
 
     wait_yield(th.m_pool_state, ThreadsExec::Active);
   }
@@ -724,6 +730,7 @@ void ThreadsExec::finalize() {
   for (unsigned i = s_thread_pool_size[0]; begin < i--;) {
     if (s_threads_exec[i]) {
       s_threads_exec[i]->m_pool_state = ThreadsExec::Terminating;
+      host_thread_wake(s_threads_exec[i]->m_pool_state);
 
       wait_yield(s_threads_process.m_pool_state, ThreadsExec::Inactive);
 
@@ -769,7 +776,10 @@ void ThreadsExec::finalize() {
 namespace Kokkos {
 
 int Threads::concurrency() { return impl_thread_pool_size(0); }
-void Threads::fence() const { Impl::ThreadsExec::fence(); }
+void Threads::fence() const {
+  Impl::ThreadsExec::fence();
+  Impl::host_copy_engine_fence();
+}
 
 Threads &Threads::impl_instance(int) {
   static Threads t;
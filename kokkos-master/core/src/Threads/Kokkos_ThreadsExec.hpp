@@ -53,6 +53,7 @@
 #include <utility>
 #include <impl/Kokkos_Spinwait.hpp>
 #include <impl/Kokkos_FunctorAdapter.hpp>
+#include <impl/Kokkos_HostCopyEngine.hpp>
 
 #include <Kokkos_Atomic.hpp>
 
@@ -635,7 +636,10 @@ inline void Threads::print_configuration(std::ostream &s, const bool detail) {
   Impl::ThreadsExec::print_configuration(s, detail);
 }
 
-inline void Threads::impl_static_fence() { Impl::ThreadsExec::fence(); }
+inline void Threads::impl_static_fence() {
+  Impl::ThreadsExec::fence();
+  Impl::host_copy_engine_fence();
+}
 } /* namespace Kokkos */
 
 //----------------------------------------------------------------------------
@@ -46,6 +46,7 @@
 #if defined(KOKKOS_ENABLE_THREADS)
 
 #include <Kokkos_Core_fwd.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
 /* Standard 'C' Linux libraries */
 
 #include <pthread.h>
@@ -132,9 +133,7 @@ void ThreadsExec::global_unlock() {
 //----------------------------------------------------------------------------
 
 void ThreadsExec::wait_yield(volatile int& flag, const int value) {
-  while (value == flag) {
-    sched_yield();
-  }
+  Impl::host_thread_wait_while_equal(flag, value);
 }
 
 }  // namespace Impl
@@ -51,6 +51,7 @@
 #include <Kokkos_Parallel.hpp>
 
 #include <impl/Kokkos_FunctorAdapter.hpp>
+#include <impl/Kokkos_HostReduceLanes.hpp>
 
 #include <KokkosExp_MDRangePolicy.hpp>
 
@@ -387,34 +388,7 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
   const ReducerType m_reducer;
   const pointer_type m_result_ptr;
 
-  template <class TagType>
-  inline static
-      typename std::enable_if<std::is_same<TagType, void>::value>::type
-      exec_range(const FunctorType &functor, const Member &ibeg,
-                 const Member &iend, reference_type update) {
-#if defined(KOKKOS_ENABLE_AGGRESSIVE_VECTORIZATION) && \
-    defined(KOKKOS_ENABLE_PRAGMA_IVDEP)
-#pragma ivdep
-#endif
-    for (Member i = ibeg; i < iend; ++i) {
-      functor(i, update);
-    }
-  }
-
-  template <class TagType>
-  inline static
-      typename std::enable_if<!std::is_same<TagType, void>::value>::type
-      exec_range(const FunctorType &functor, const Member &ibeg,
-                 const Member &iend, reference_type update) {
-    const TagType t{};
-#if defined(KOKKOS_ENABLE_AGGRESSIVE_VECTORIZATION) && \
-    defined(KOKKOS_ENABLE_PRAGMA_IVDEP)
-#pragma ivdep
-#endif
-    for (Member i = ibeg; i < iend; ++i) {
-      functor(t, i, update);
-    }
-  }
+  using Lanes = HostReduceLanes<Policy, FunctorType, ReducerType>;
 
   static void exec(ThreadsExec &exec, const void *arg) {
     exec_schedule<typename Policy::schedule_type::type>(exec, arg);
@@ -427,8 +401,10 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
     const ParallelReduce &self = *((const ParallelReduce *)arg);
     const WorkRange range(self.m_policy, exec.pool_rank(), exec.pool_size());
 
-    ParallelReduce::template exec_range<WorkTag>(
-        self.m_functor, range.begin(), range.end(),
+    Lanes::exec_range(
+        self.m_functor,
+        ReducerConditional::select(self.m_functor, self.m_reducer),
+        range.begin(), range.end(),
         ValueInit::init(
             ReducerConditional::select(self.m_functor, self.m_reducer),
             exec.reduce_memory()));
@@ -462,8 +438,10 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
           begin + self.m_policy.chunk_size() < self.m_policy.end()
               ? begin + self.m_policy.chunk_size()
               : self.m_policy.end();
-      ParallelReduce::template exec_range<WorkTag>(self.m_functor, begin, end,
-                                                   update);
+      Lanes::exec_range(
+          self.m_functor,
+          ReducerConditional::select(self.m_functor, self.m_reducer), begin,
+          end, update);
       work_index = exec.get_work_index();
     }
 
@@ -57,7 +57,10 @@
 #define KOKKOS_ENABLE_IVDEP_MDRANGE
 #endif
 
+#include <Kokkos_Layout.hpp>
+
 #include <algorithm>
+#include <cstdint>
 
 namespace Kokkos {
 namespace Impl {
@@ -1531,6 +1534,57 @@ struct is_type_array<T[]> : std::true_type {
   using value_type = T;
 };
 
+// Offset of the tile with index tile_idx of an MDRangePolicy.  Morton
+// order bisects the grid of tiles along its largest extent, the outer
+// dimension first on ties, down to a single tile.  On a grid with equal
+// power of two extents this is the Z-order curve, on others it keeps the
+// property that consecutive indices are close in every dimension.
+template <typename RP, typename IType>
+inline void host_tile_offset(RP const& rp, IType tile_idx,
+                             typename RP::point_type& offset) {
+  if (rp.m_tile_order == TileOrder::Morton) {
+    typename RP::point_type first;
+    typename RP::point_type count;
+    for (int i = 0; i < RP::rank; ++i) {
+      first[i] = 0;
+      count[i] = rp.m_tile_end[i];
+    }
+    std::int64_t index = tile_idx;
+    std::int64_t total = rp.m_num_tiles;
+    while (total > 1) {
+      int split = -1;
+      for (int n = 0; n < RP::rank; ++n) {
+        const int i = RP::outer_direction == RP::Left ? RP::rank - 1 - n : n;
+        if (split < 0 || count[i] > count[split]) split = i;
+      }
+      const std::int64_t half       = (count[split] + 1) / 2;
+      const std::int64_t half_total = total / count[split] * half;
+      if (index < half_total) {
+        count[split] = half;
+        total        = half_total;
+      } else {
+        index -= half_total;
+        first[split] += half;
+        count[split] -= half;
+        total -= half_total;
+      }
+    }
+    for (int i = 0; i < RP::rank; ++i) {
+      offset[i] = first[i] * rp.m_tile[i] + rp.m_lower[i];
+    }
+  } else if (RP::outer_direction == RP::Left) {
+    for (int i = 0; i < RP::rank; ++i) {
+      offset[i] = (tile_idx % rp.m_tile_end[i]) * rp.m_tile[i] + rp.m_lower[i];
+      tile_idx /= rp.m_tile_end[i];
+    }
+  } else {
+    for (int i = RP::rank - 1; i >= 0; --i) {
+      offset[i] = (tile_idx % rp.m_tile_end[i]) * rp.m_tile[i] + rp.m_lower[i];
+      tile_idx /= rp.m_tile_end[i];
+    }
+  }
+}
+
 template <typename RP, typename Functor, typename Tag = void,
           typename ValueType = void, typename Enable = void>
 struct HostIterateTile;
@@ -1557,13 +1611,8 @@ struct HostIterateTile<
         partial_tile[i] = m_rp.m_tile[i];
       } else {
         is_full_tile = false;
-        partial_tile[i] =
-            (m_rp.m_upper[i] - 1 - offset[i]) == 0
-                ? 1
-                : (m_rp.m_upper[i] - m_rp.m_tile[i]) > 0
-                      ? (m_rp.m_upper[i] - offset[i])
-                      : (m_rp.m_upper[i] -
-                         m_rp.m_lower[i]);  // when single tile encloses range
+        // The tile starts inside the range, possibly below zero
+        partial_tile[i] = m_rp.m_upper[i] - offset[i];
       }
     }
 
@@ -1582,19 +1631,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1978,13 +2015,8 @@ struct HostIterateTile<
         partial_tile[i] = m_rp.m_tile[i];
       } else {
         is_full_tile = false;
-        partial_tile[i] =
-            (m_rp.m_upper[i] - 1 - offset[i]) == 0
-                ? 1
-                : (m_rp.m_upper[i] - m_rp.m_tile[i]) > 0
-                      ? (m_rp.m_upper[i] - offset[i])
-                      : (m_rp.m_upper[i] -
-                         m_rp.m_lower[i]);  // when single tile encloses range
+        // The tile starts inside the range, possibly below zero
+        partial_tile[i] = m_rp.m_upper[i] - offset[i];
       }
     }
 
@@ -2003,19 +2035,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2401,13 +2421,8 @@ struct HostIterateTile<
         partial_tile[i] = m_rp.m_tile[i];
       } else {
         is_full_tile = false;
-        partial_tile[i] =
-            (m_rp.m_upper[i] - 1 - offset[i]) == 0
-                ? 1
-                : (m_rp.m_upper[i] - m_rp.m_tile[i]) > 0
-                      ? (m_rp.m_upper[i] - offset[i])
-                      : (m_rp.m_upper[i] -
-                         m_rp.m_lower[i]);  // when single tile encloses range
+        // The tile starts inside the range, possibly below zero
+        partial_tile[i] = m_rp.m_upper[i] - offset[i];
       }
     }
 
@@ -2426,19 +2441,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -52,6 +52,7 @@
 #include <unistd.h>
 #endif
 #include <cstdio>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <cerrno>
@@ -116,5 +117,56 @@ int mpi_local_rank_on_node() {
   return local_rank;
 }
 
+long host_cache_size(int level) {
+  long size = 0;
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+  switch (level) {
+    case 1: size = sysconf(_SC_LEVEL1_DCACHE_SIZE); break;
+    case 2: size = sysconf(_SC_LEVEL2_CACHE_SIZE); break;
+    case 3: size = sysconf(_SC_LEVEL3_CACHE_SIZE); break;
+  }
+#elif defined(__APPLE__)
+  char const *names[] = {"hw.l1dcachesize", "hw.l2cachesize",
+                         "hw.l3cachesize"};
+  if (1 <= level && level <= 3) {
+    int64_t value     = 0;
+    size_t value_size = sizeof(value);
+    if (sysctlbyname(names[level - 1], &value, &value_size, nullptr, 0) == 0)
+      size = static_cast<long>(value);
+  }
+#else
+  (void)level;
+#endif
+  return size < 0 ? 0 : size;
+}
+
+std::string host_cpu_model() {
+  std::string model;
+#if defined(__APPLE__)
+  char buffer[256];
+  size_t size = sizeof(buffer);
+  if (sysctlbyname("machdep.cpu.brand_string", buffer, &size, nullptr, 0) ==
+      0)
+    model.assign(buffer, strnlen(buffer, size));
+#elif defined(__linux__)
+  if (FILE *cpuinfo = fopen("/proc/cpuinfo", "r")) {
+    char line[512];
+    while (fgets(line, sizeof(line), cpuinfo) != nullptr) {
+      if (strncmp(line, "model name", 10) == 0) {
+        char const *value = strchr(line, ':');
+        if (value != nullptr) {
+          model = value + 1;
+          model.erase(0, model.find_first_not_of(" \t"));
+          model.erase(model.find_last_not_of(" \t\n") + 1);
+        }
+        break;
+      }
+    }
+    fclose(cpuinfo);
+  }
+#endif
+  return model;
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
@@ -41,6 +41,8 @@
 // ************************************************************************
 //@HEADER
 */
+#include <string>
+
 namespace Kokkos {
 namespace Impl {
 
@@ -48,5 +50,11 @@ int processors_per_node();
 int mpi_ranks_per_node();
 int mpi_local_rank_on_node();
 
+// Size in bytes of the level 1, 2 or 3 data cache of a core, 0 if unknown
+long host_cache_size(int level);
+
+// Model name of the processor as reported by the OS, empty if unknown
+std::string host_cpu_model();
+
 }  // namespace Impl
 }  // namespace Kokkos
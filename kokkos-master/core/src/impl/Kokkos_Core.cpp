@@ -45,6 +45,11 @@
 #include <Kokkos_Core.hpp>
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_ExecSpaceInitializer.hpp>
+#include <impl/Kokkos_HostCopyEngine.hpp>
+#include <impl/Kokkos_HostSpace_cache.hpp>
+#include <impl/Kokkos_HostThreadTeam.hpp>
+#include <impl/Kokkos_Profiling_Counters.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
 #include <cctype>
 #include <cstring>
 #include <iostream>
@@ -277,6 +282,14 @@ void initialize_profiling(const InitArguments&) {
 void pre_initialize_internal(const InitArguments& args) {
   if (args.disable_warnings) g_show_warnings = false;
   if (args.tune_internals) g_tune_internals = true;
+  if (args.huge_pages != HostSpace::HUGE_PAGES_DEFAULT)
+    host_space_set_huge_pages(args.huge_pages);
+  if (args.host_alloc_cache >= 0)
+    host_space_cache_set_threshold(args.host_alloc_cache);
+  host_thread_team_set_pool_group(args.host_barrier_group);
+  host_thread_set_spin_limit(args.host_spin_limit);
+  // Before the backends start their threads, which inherit the counters
+  Kokkos::Tools::Impl::counters_tool_pre_initialize();
 }
 
 void post_initialize_internal(const InitArguments& args) {
@@ -318,6 +331,8 @@ void finalize_internal(const bool all_spaces = false) {
     ++numSuccessfulCalls;
   }
 
+  host_copy_engine_finalize();
+
   Kokkos::Profiling::finalize();
 
   Impl::ExecSpaceManager::get_instance().finalize_spaces(all_spaces);
@@ -325,9 +340,17 @@ void finalize_internal(const bool all_spaces = false) {
   g_is_initialized = false;
   g_show_warnings  = true;
   g_tune_internals = false;
+  host_space_set_huge_pages(HostSpace::HUGE_PAGES_OFF);
+  host_space_cache_set_threshold(0);
+  host_space_cache_release();
+  host_thread_team_set_pool_group(-1);
+  host_thread_set_spin_limit(-1);
 }
 
-void fence_internal() { Impl::ExecSpaceManager::get_instance().static_fence(); }
+void fence_internal() {
+  Impl::ExecSpaceManager::get_instance().static_fence();
+  host_copy_engine_fence();
+}
 
 bool check_arg(char const* arg, char const* expected) {
   std::size_t arg_len = std::strlen(arg);
@@ -381,6 +404,45 @@ unsigned get_process_id() {
 #endif
 }
 
+bool parse_huge_pages(char const* str, HostSpace::HugePages* value) {
+  std::string mode(str);
+  for (char& c : mode) {
+    c = toupper(c);
+  }
+  if (mode == "OFF")
+    *value = HostSpace::HUGE_PAGES_OFF;
+  else if (mode == "THP")
+    *value = HostSpace::HUGE_PAGES_THP;
+  else if (mode == "2M")
+    *value = HostSpace::HUGE_PAGES_2M;
+  else if (mode == "1G")
+    *value = HostSpace::HUGE_PAGES_1G;
+  else
+    return false;
+  return true;
+}
+
+bool parse_host_barrier(char const* str, int* value) {
+  std::string mode(str);
+  for (char& c : mode) {
+    c = toupper(c);
+  }
+  if (mode == "FLAT") {
+    *value = 1;
+  } else if (mode == "TREE") {
+    *value = 0;
+  } else {
+    char* end;
+    errno            = 0;
+    const long group = std::strtol(str, &end, 10);
+    if (end == str || *end != '\0' || errno == ERANGE || group < 1 ||
+        group > HostThreadTeamData::max_pool_members)
+      return false;
+    *value = int(group);
+  }
+  return true;
+}
+
 void parse_command_line_arguments(int& narg, char* arg[],
                                   InitArguments& arguments) {
   auto& num_threads      = arguments.num_threads;
@@ -390,6 +452,10 @@ void parse_command_line_arguments(int& narg, char* arg[],
   auto& skip_device      = arguments.skip_device;
   auto& disable_warnings = arguments.disable_warnings;
   auto& tune_internals   = arguments.tune_internals;
+  auto& huge_pages       = arguments.huge_pages;
+  auto& host_alloc_cache = arguments.host_alloc_cache;
+  auto& host_barrier     = arguments.host_barrier_group;
+  auto& host_spin_limit  = arguments.host_spin_limit;
 
   bool kokkos_threads_found  = false;
   bool kokkos_numa_found     = false;
@@ -510,6 +576,40 @@ void parse_command_line_arguments(int& narg, char* arg[],
         arg[k] = arg[k + 1];
       }
       narg--;
+    } else if (check_arg(arg[iarg], "--kokkos-huge-pages")) {
+      if (strncmp(arg[iarg], "--kokkos-huge-pages=", 20) != 0 ||
+          !parse_huge_pages(arg[iarg] + 20, &huge_pages))
+        throw_runtime_exception(
+            "Error: expecting one of '=thp', '=2M', '=1G' or '=off' after "
+            "command line argument '--kokkos-huge-pages'. Raised by "
+            "Kokkos::initialize(int narg, char* argc[]).");
+      for (int k = iarg; k < narg - 1; k++) {
+        arg[k] = arg[k + 1];
+      }
+      narg--;
+    } else if (check_int_arg(arg[iarg], "--kokkos-host-alloc-cache",
+                             &host_alloc_cache)) {
+      for (int k = iarg; k < narg - 1; k++) {
+        arg[k] = arg[k + 1];
+      }
+      narg--;
+    } else if (check_arg(arg[iarg], "--kokkos-host-barrier")) {
+      if (strncmp(arg[iarg], "--kokkos-host-barrier=", 22) != 0 ||
+          !parse_host_barrier(arg[iarg] + 22, &host_barrier))
+        throw_runtime_exception(
+            "Error: expecting one of '=flat', '=tree' or '=INT' after command "
+            "line argument '--kokkos-host-barrier'. Raised by "
+            "Kokkos::initialize(int narg, char* argc[]).");
+      for (int k = iarg; k < narg - 1; k++) {
+        arg[k] = arg[k + 1];
+      }
+      narg--;
+    } else if (check_int_arg(arg[iarg], "--kokkos-spin-limit",
+                             &host_spin_limit)) {
+      for (int k = iarg; k < narg - 1; k++) {
+        arg[k] = arg[k + 1];
+      }
+      narg--;
     } else if (check_arg(arg[iarg], "--kokkos-help") ||
                check_arg(arg[iarg], "--help")) {
       auto const help_message = R"(
@@ -531,6 +631,20 @@ void parse_command_line_arguments(int& narg, char* arg[],
                                        number of threads per NUMA region if
                                        used in conjunction with '--numa' option.
       --kokkos-numa=INT              : specify number of NUMA regions used by process.
+      --kokkos-huge-pages=MODE       : page size backing large host allocations,
+                                       one of thp (transparent huge pages), 2M or
+                                       1G (hugetlbfs pages, falling back to thp)
+                                       and off (the default).
+      --kokkos-host-alloc-cache=INT  : serve host allocations of at most INT bytes
+                                       (up to 1 MiB) from a thread caching allocator.
+      --kokkos-host-barrier=MODE     : shape of the host thread pool barrier and
+                                       reductions, one of flat, tree (one group per
+                                       NUMA domain, or about sqrt(threads) threads
+                                       without hwloc) or INT (groups of INT threads).
+                                       Defaults to tree on multi-NUMA nodes.
+      --kokkos-spin-limit=INT        : spin at most INT iterations before an idle
+                                       host thread goes to sleep, 0 to sleep right
+                                       away.
       --kokkos-device-id=INT         : specify device id to be used by Kokkos.
       --kokkos-num-devices=INT[,INT] : used when running MPI jobs. Specify number of
                                        devices per node to be used. Process to device
@@ -566,6 +680,10 @@ void parse_environment_variables(InitArguments& arguments) {
   auto& skip_device      = arguments.skip_device;
   auto& disable_warnings = arguments.disable_warnings;
   auto& tune_internals   = arguments.tune_internals;
+  auto& huge_pages       = arguments.huge_pages;
+  auto& host_alloc_cache = arguments.host_alloc_cache;
+  auto& host_barrier     = arguments.host_barrier_group;
+  auto& host_spin_limit  = arguments.host_spin_limit;
   char* endptr;
   auto env_num_threads_str = std::getenv("KOKKOS_NUM_THREADS");
   if (env_num_threads_str != nullptr) {
@@ -733,6 +851,80 @@ void parse_environment_variables(InitArguments& arguments) {
           "KOKKOS_TUNE_INTERNALS if both are set. Raised by "
           "Kokkos::initialize(int narg, char* argc[]).");
   }
+  char* env_hugepages_str = std::getenv("KOKKOS_HUGE_PAGES");
+  if (env_hugepages_str != nullptr) {
+    HostSpace::HugePages env_huge_pages = HostSpace::HUGE_PAGES_DEFAULT;
+    if (!parse_huge_pages(env_hugepages_str, &env_huge_pages))
+      Impl::throw_runtime_exception(
+          "Error: expecting one of 'thp', '2M', '1G' or 'off' for "
+          "KOKKOS_HUGE_PAGES. Raised by Kokkos::initialize(int narg, char* "
+          "argc[]).");
+    if ((huge_pages != HostSpace::HUGE_PAGES_DEFAULT) &&
+        (env_huge_pages != huge_pages))
+      Impl::throw_runtime_exception(
+          "Error: expecting a match between --kokkos-huge-pages and "
+          "KOKKOS_HUGE_PAGES if both are set. Raised by "
+          "Kokkos::initialize(int narg, char* argc[]).");
+    else
+      huge_pages = env_huge_pages;
+  }
+  auto env_alloc_cache_str = std::getenv("KOKKOS_HOST_ALLOC_CACHE");
+  if (env_alloc_cache_str != nullptr) {
+    errno                = 0;
+    auto env_alloc_cache = std::strtol(env_alloc_cache_str, &endptr, 10);
+    if (endptr == env_alloc_cache_str)
+      Impl::throw_runtime_exception(
+          "Error: cannot convert KOKKOS_HOST_ALLOC_CACHE to an integer. Raised "
+          "by Kokkos::initialize(int narg, char* argc[]).");
+    if (errno == ERANGE)
+      Impl::throw_runtime_exception(
+          "Error: KOKKOS_HOST_ALLOC_CACHE out of range of representable values "
+          "by an integer. Raised by Kokkos::initialize(int narg, char* "
+          "argc[]).");
+    if ((host_alloc_cache != -1) && (env_alloc_cache != host_alloc_cache))
+      Impl::throw_runtime_exception(
+          "Error: expecting a match between --kokkos-host-alloc-cache and "
+          "KOKKOS_HOST_ALLOC_CACHE if both are set. Raised by "
+          "Kokkos::initialize(int narg, char* argc[]).");
+    else
+      host_alloc_cache = env_alloc_cache;
+  }
+  char* env_host_barrier_str = std::getenv("KOKKOS_HOST_BARRIER");
+  if (env_host_barrier_str != nullptr) {
+    int env_host_barrier = -1;
+    if (!parse_host_barrier(env_host_barrier_str, &env_host_barrier))
+      Impl::throw_runtime_exception(
+          "Error: expecting one of 'flat', 'tree' or an integer for "
+          "KOKKOS_HOST_BARRIER. Raised by Kokkos::initialize(int narg, char* "
+          "argc[]).");
+    if ((host_barrier != -1) && (env_host_barrier != host_barrier))
+      Impl::throw_runtime_exception(
+          "Error: expecting a match between --kokkos-host-barrier and "
+          "KOKKOS_HOST_BARRIER if both are set. Raised by "
+          "Kokkos::initialize(int narg, char* argc[]).");
+    else
+      host_barrier = env_host_barrier;
+  }
+  auto env_spin_limit_str = std::getenv("KOKKOS_SPIN_LIMIT");
+  if (env_spin_limit_str != nullptr) {
+    errno               = 0;
+    auto env_spin_limit = std::strtol(env_spin_limit_str, &endptr, 10);
+    if (endptr == env_spin_limit_str)
+      Impl::throw_runtime_exception(
+          "Error: cannot convert KOKKOS_SPIN_LIMIT to an integer. Raised by "
+          "Kokkos::initialize(int narg, char* argc[]).");
+    if (errno == ERANGE)
+      Impl::throw_runtime_exception(
+          "Error: KOKKOS_SPIN_LIMIT out of range of representable values by "
+          "an integer. Raised by Kokkos::initialize(int narg, char* argc[]).");
+    if ((host_spin_limit != -1) && (env_spin_limit != host_spin_limit))
+      Impl::throw_runtime_exception(
+          "Error: expecting a match between --kokkos-spin-limit and "
+          "KOKKOS_SPIN_LIMIT if both are set. Raised by "
+          "Kokkos::initialize(int narg, char* argc[]).");
+    else
+      host_spin_limit = env_spin_limit;
+  }
 }
 
 }  // namespace
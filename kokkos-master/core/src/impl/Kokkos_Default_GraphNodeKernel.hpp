@@ -53,6 +53,8 @@
 #include <Kokkos_Parallel.hpp>
 #include <Kokkos_Parallel_Reduce.hpp>
 
+#include <functional>
+
 namespace Kokkos {
 namespace Impl {
 
@@ -64,15 +66,19 @@ struct GraphNodeKernelDefaultImpl {
   // TODO @graphs decide if this should use vtable or intrusive erasure via
   //      function pointers like in the rest of the graph interface
   virtual void execute_kernel() = 0;
+
+  // Fusable kernels (parallel_for over a RangePolicy hinted with
+  // WorkItemProperty::HintFusable) report their range and run any part of it
+  // on the calling thread, so that the graph can fuse them with adjacent
+  // kernels over the same range.
+  virtual bool get_fusable_range(int64_t&, int64_t&) const { return false; }
+  virtual void execute_range(int64_t, int64_t) {}
 };
 
 // TODO Indicate that this kernel specialization is only for the Host somehow?
 template <class ExecutionSpace, class PolicyType, class Functor,
           class PatternTag, class... Args>
-class GraphNodeKernelImpl
-    : public PatternImplSpecializationFromTag<PatternTag, Functor, PolicyType,
-                                              Args..., ExecutionSpace>::type,
-      public GraphNodeKernelDefaultImpl<ExecutionSpace> {
+class GraphNodeKernelImpl : public GraphNodeKernelDefaultImpl<ExecutionSpace> {
  public:
   using base_t =
       typename PatternImplSpecializationFromTag<PatternTag, Functor, PolicyType,
@@ -84,14 +90,75 @@ class GraphNodeKernelImpl
   using Policy       = PolicyType;
   using graph_kernel = GraphNodeKernelImpl;
 
+  enum : bool {
+    is_fusable =
+        std::is_same<PatternTag, Kokkos::ParallelForTag>::value &&
+        is_specialization_of<Policy, Kokkos::RangePolicy>::value &&
+        (Policy::work_item_property::value &
+         Kokkos::Experimental::WorkItemProperty::HintFusable_t::value) != 0
+  };
+
+ private:
+  using member_type = typename Policy::member_type;
+  using work_tag    = typename Policy::work_tag;
+
+  // The backend closure is only created when the kernel is launched, so that
+  // it binds to the thread pool (or partition of it) that launches it rather
+  // than to the one that built the graph.
+  std::function<void()> m_launch;
+
+  // Only set for fusable kernels
+  std::function<void(int64_t, int64_t)> m_execute_range;
+  int64_t m_range_begin = 0;
+  int64_t m_range_end   = 0;
+
+  template <class Tag = work_tag>
+  static typename std::enable_if<std::is_same<Tag, void>::value>::type
+  apply_range(Functor const& functor, const member_type ibeg,
+              const member_type iend) {
+    for (member_type i = ibeg; i < iend; ++i) {
+      functor(i);
+    }
+  }
+
+  template <class Tag = work_tag>
+  static typename std::enable_if<!std::is_same<Tag, void>::value>::type
+  apply_range(Functor const& functor, const member_type ibeg,
+              const member_type iend) {
+    const Tag t{};
+    for (member_type i = ibeg; i < iend; ++i) {
+      functor(t, i);
+    }
+  }
+
+  template <bool Fusable = is_fusable>
+  typename std::enable_if<Fusable>::type set_fusable(Functor const& functor,
+                                                     Policy const& policy) {
+    m_range_begin   = policy.begin();
+    m_range_end     = policy.end();
+    m_execute_range = [functor](int64_t ibeg, int64_t iend) {
+      apply_range(functor, member_type(ibeg), member_type(iend));
+    };
+  }
+
+  template <bool Fusable = is_fusable>
+  typename std::enable_if<!Fusable>::type set_fusable(Functor const&,
+                                                      Policy const&) {}
+
+ public:
   // TODO @graph kernel name info propagation
   template <class PolicyDeduced, class... ArgsDeduced>
   GraphNodeKernelImpl(std::string const&, ExecutionSpace const&,
                       Functor arg_functor, PolicyDeduced&& arg_policy,
                       ArgsDeduced&&... args)
-      : base_t(std::move(arg_functor), (PolicyDeduced &&) arg_policy,
-               (ArgsDeduced &&) args...),
-        execute_kernel_vtable_base_t() {}
+      : execute_kernel_vtable_base_t() {
+    Policy policy((PolicyDeduced &&) arg_policy);
+    set_fusable(arg_functor, policy);
+    m_launch = [functor = std::move(arg_functor), policy, args...]() {
+      base_t closure(functor, policy, args...);
+      closure.execute();
+    };
+  }
 
   // FIXME @graph Forward through the instance once that works in the backends
   template <class PolicyDeduced, class... ArgsDeduced>
@@ -101,7 +168,17 @@ class GraphNodeKernelImpl
                             (PolicyDeduced &&) arg_policy,
                             (ArgsDeduced &&) args...) {}
 
-  void execute_kernel() final { this->base_t::execute(); }
+  void execute_kernel() final { m_launch(); }
+
+  bool get_fusable_range(int64_t& begin, int64_t& end) const final {
+    begin = m_range_begin;
+    end   = m_range_end;
+    return is_fusable;
+  }
+
+  void execute_range(int64_t begin, int64_t end) final {
+    m_execute_range(begin, end);
+  }
 };
 
 // </editor-fold> end GraphNodeKernelImpl }}}1
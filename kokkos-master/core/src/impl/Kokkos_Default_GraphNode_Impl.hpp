@@ -74,12 +74,11 @@ struct GraphNodeBackendSpecificDetails {
 
   Kokkos::ObservingRawPtr<default_kernel_impl_t> m_kernel_ptr = nullptr;
 
-  bool m_has_executed = false;
   bool m_is_aggregate = false;
   bool m_is_root      = false;
 
   template <class>
-  friend struct HostGraphImpl;
+  friend struct GraphImpl;
 
  protected:
   //----------------------------------------------------------------------------
@@ -89,7 +88,7 @@ struct GraphNodeBackendSpecificDetails {
 
   explicit GraphNodeBackendSpecificDetails(
       _graph_node_is_root_ctor_tag) noexcept
-      : m_has_executed(true), m_is_root(true) {}
+      : m_is_root(true) {}
 
   GraphNodeBackendSpecificDetails(GraphNodeBackendSpecificDetails const&) =
       delete;
@@ -123,42 +122,13 @@ struct GraphNodeBackendSpecificDetails {
   void set_predecessor(
       std::shared_ptr<GraphNodeBackendSpecificDetails<ExecutionSpace>>
           arg_pred_impl) {
-    // This method delegates responsibility for executing the predecessor to
-    // this node.  Each node can have at most one predecessor (which may be an
-    // aggregate).
+    // This method records that this node runs after the predecessor, which is
+    // what GraphImpl schedules the graph from.  Each node can have at most one
+    // predecessor (which may be an aggregate).
     KOKKOS_EXPECTS(m_predecessors.empty() || m_is_aggregate)
     KOKKOS_EXPECTS(bool(arg_pred_impl))
-    KOKKOS_EXPECTS(!m_has_executed)
     m_predecessors.push_back(std::move(arg_pred_impl));
   }
-
-  void execute_node() {
-    // This node could have already been executed as the predecessor of some
-    // other
-    KOKKOS_EXPECTS(bool(m_kernel_ptr) || m_has_executed)
-    // Just execute the predecessor here, since calling set_predecessor()
-    // delegates the responsibility for running it to us.
-    if (!m_has_executed) {
-      // I'm pretty sure this doesn't need to be atomic under our current
-      // supported semantics, but instinct I have feels like it should be...
-      m_has_executed = true;
-      for (auto const& predecessor : m_predecessors) {
-        predecessor->execute_node();
-      }
-      m_kernel_ptr->execute_kernel();
-    }
-    KOKKOS_ENSURES(m_has_executed)
-  }
-
-  // This is gross, but for the purposes of our simple default implementation...
-  void reset_has_executed() {
-    for (auto const& predecessor : m_predecessors) {
-      predecessor->reset_has_executed();
-    }
-    // more readable, probably:
-    //   if(!m_is_root) m_has_executed = false;
-    m_has_executed = m_is_root;
-  }
 };
 
 // </editor-fold> end GraphNodeBackendSpecificDetails }}}1
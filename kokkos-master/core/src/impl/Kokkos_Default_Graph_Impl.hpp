@@ -58,11 +58,129 @@
 #include <impl/Kokkos_OptionalRef.hpp>
 #include <impl/Kokkos_EBO.hpp>
 
+#include <algorithm>
+#include <map>
+#include <memory>
 #include <set>
+#include <vector>
 
 namespace Kokkos {
 namespace Impl {
 
+//==============================================================================
+// <editor-fold desc="GraphNodeFusedKernelDefaultImpl"> {{{1
+
+// A chain of fusable kernels over the same range, each only depending on the
+// previous one, executed as a single kernel. The range is cut into blocks and
+// every kernel of the chain runs over a block before the next block starts,
+// so the data a kernel leaves behind is still in cache for its successor.
+template <class ExecutionSpace>
+struct GraphNodeFusedKernelDefaultImpl
+    : GraphNodeKernelDefaultImpl<ExecutionSpace> {
+  using kernel_ptr_t =
+      Kokkos::ObservingRawPtr<GraphNodeKernelDefaultImpl<ExecutionSpace>>;
+
+  // Upper bound of the indices in a block, small enough for a block of a
+  // few arrays of doubles to stay in the L1 or L2 cache
+  enum : int64_t { max_block_size = 2048 };
+
+  struct BlockFunctor {
+    GraphNodeFusedKernelDefaultImpl const* m_fused;
+    int64_t m_block_size;
+
+    void operator()(const int64_t block) const {
+      const int64_t begin = m_fused->m_begin + block * m_block_size;
+      const int64_t end   = std::min(begin + m_block_size, m_fused->m_end);
+      for (auto const& kernel : m_fused->m_kernels) {
+        kernel->execute_range(begin, end);
+      }
+    }
+  };
+
+  std::vector<kernel_ptr_t> m_kernels;
+  int64_t m_begin;
+  int64_t m_end;
+
+  GraphNodeFusedKernelDefaultImpl(kernel_ptr_t arg_first, int64_t arg_begin,
+                                  int64_t arg_end)
+      : m_kernels{arg_first}, m_begin(arg_begin), m_end(arg_end) {}
+
+  void execute_kernel() final {
+    using policy_t =
+        Kokkos::RangePolicy<ExecutionSpace, Kokkos::IndexType<int64_t>>;
+
+    const int64_t n           = m_end - m_begin;
+    const int64_t concurrency = ExecutionSpace::concurrency();
+    const int64_t block_size  = std::max<int64_t>(
+        1, std::min<int64_t>(max_block_size,
+                             (n + concurrency - 1) / concurrency));
+
+    ParallelFor<BlockFunctor, policy_t, ExecutionSpace> closure(
+        BlockFunctor{this, block_size},
+        policy_t(0, (n + block_size - 1) / block_size));
+    closure.execute();
+  }
+};
+
+// </editor-fold> end GraphNodeFusedKernelDefaultImpl }}}1
+//==============================================================================
+
+//==============================================================================
+// <editor-fold desc="GraphLevelExecutor"> {{{1
+
+// Runs the kernels of one level of a graph schedule. They don't depend on
+// each other, so backends with a thread pool may run them concurrently.
+template <class ExecutionSpace>
+struct GraphLevelExecutor {
+  using kernel_ptr_t =
+      Kokkos::ObservingRawPtr<GraphNodeKernelDefaultImpl<ExecutionSpace>>;
+
+  template <class KernelPtrs>
+  static void execute(ExecutionSpace const&, KernelPtrs const& kernels) {
+    for (auto const& kernel : kernels) {
+      kernel->execute_kernel();
+    }
+  }
+};
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+template <>
+struct GraphLevelExecutor<Kokkos::OpenMP> {
+  using kernel_ptr_t =
+      Kokkos::ObservingRawPtr<GraphNodeKernelDefaultImpl<Kokkos::OpenMP>>;
+
+  // A template only so that the kernel type is complete when instantiated
+  template <class KernelPtrs>
+  static void execute(Kokkos::OpenMP const&, KernelPtrs const& kernels) {
+    const int num_kernels = kernels.size();
+    const int pool_size   = Kokkos::OpenMP::impl_thread_pool_size();
+
+    if (num_kernels < 2 || pool_size < 2 || Kokkos::OpenMP::in_parallel()) {
+      for (auto const& kernel : kernels) {
+        kernel->execute_kernel();
+      }
+      return;
+    }
+
+    // One partition of the pool per kernel, as far as the pool allows. The
+    // kernels are launched on the partition's master thread, so they only
+    // use the threads of their partition.
+    const int num_partitions = std::min(num_kernels, pool_size);
+
+    Kokkos::OpenMP::partition_master(
+        [&](int partition_id, int partition_count) {
+          for (int i = partition_id; i < num_kernels; i += partition_count) {
+            kernels[i]->execute_kernel();
+          }
+        },
+        num_partitions, pool_size / num_partitions);
+  }
+};
+#endif
+
+// </editor-fold> end GraphLevelExecutor }}}1
+//==============================================================================
+
 //==============================================================================
 // <editor-fold desc="GraphImpl default implementation"> {{{1
 
@@ -80,6 +198,112 @@ struct GraphImpl : private ExecutionSpaceInstanceStorage<ExecutionSpace> {
   using node_details_t = GraphNodeBackendSpecificDetails<ExecutionSpace>;
   std::set<std::shared_ptr<node_details_t>> m_sinks;
 
+  // The kernels grouped by depth in the graph, built on the first submit()
+  // and reused by the following ones. Kernels of a level only depend on
+  // kernels of earlier levels.
+  using level_executor_t = GraphLevelExecutor<ExecutionSpace>;
+  using kernel_ptr_t     = typename level_executor_t::kernel_ptr_t;
+  using fused_kernel_t   = GraphNodeFusedKernelDefaultImpl<ExecutionSpace>;
+  std::vector<std::vector<kernel_ptr_t>> m_schedule;
+  std::vector<std::unique_ptr<fused_kernel_t>> m_fused_kernels;
+  bool m_schedule_valid = false;
+
+  struct schedule_entry {
+    int depth;
+    // where the node's kernel, or the fused kernel containing it, is
+    int level;
+    size_t index;
+  };
+
+  struct schedule_state {
+    std::map<node_details_t*, int> successors;
+    std::map<node_details_t*, schedule_entry> entries;
+  };
+
+  static bool is_kernel_node(node_details_t const* arg_node) {
+    // The root and aggregates have nothing to execute
+    return !arg_node->m_is_root && !arg_node->m_is_aggregate;
+  }
+
+  static void count_successors(node_details_t* arg_node,
+                               std::map<node_details_t*, int>& arg_counts) {
+    if (!arg_counts.emplace(arg_node, 0).second) return;
+    for (auto const& predecessor : arg_node->m_predecessors) {
+      count_successors(predecessor.get(), arg_counts);
+      ++arg_counts[predecessor.get()];
+    }
+  }
+
+  // Whether arg_node can run fused behind its only predecessor: both are
+  // fusable over the same range and arg_node is the predecessor's only
+  // successor.
+  static bool fuses_with_predecessor(node_details_t* arg_node,
+                                     schedule_state& arg_state) {
+    if (arg_node->m_predecessors.size() != 1) return false;
+    node_details_t* predecessor = arg_node->m_predecessors.front().get();
+    if (!is_kernel_node(predecessor) ||
+        arg_state.successors[predecessor] != 1) {
+      return false;
+    }
+    int64_t begin, end, pred_begin, pred_end;
+    return arg_node->m_kernel_ptr->get_fusable_range(begin, end) &&
+           predecessor->m_kernel_ptr->get_fusable_range(pred_begin,
+                                                        pred_end) &&
+           begin == pred_begin && end == pred_end;
+  }
+
+  // Returns the depth of arg_node: the number of kernels (fused kernels
+  // counting as one) on the longest path from the root to it, itself
+  // included.
+  int schedule_node(node_details_t* arg_node, schedule_state& arg_state) {
+    auto spot = arg_state.entries.find(arg_node);
+    if (spot != arg_state.entries.end()) return spot->second.depth;
+
+    int depth = 0;
+    for (auto const& predecessor : arg_node->m_predecessors) {
+      depth = std::max(depth, schedule_node(predecessor.get(), arg_state));
+    }
+
+    schedule_entry entry{depth, -1, 0};
+    if (is_kernel_node(arg_node)) {
+      KOKKOS_EXPECTS(bool(arg_node->m_kernel_ptr))
+      if (fuses_with_predecessor(arg_node, arg_state)) {
+        entry = arg_state.entries[arg_node->m_predecessors.front().get()];
+        kernel_ptr_t& slot = m_schedule[entry.level][entry.index];
+        if (slot == arg_node->m_predecessors.front()->m_kernel_ptr) {
+          // Replace the predecessor by a fused kernel starting with it
+          int64_t begin, end;
+          slot->get_fusable_range(begin, end);
+          m_fused_kernels.emplace_back(new fused_kernel_t(slot, begin, end));
+          slot = m_fused_kernels.back().get();
+        }
+        static_cast<fused_kernel_t*>(slot)->m_kernels.push_back(
+            arg_node->m_kernel_ptr);
+      } else {
+        if (int(m_schedule.size()) <= depth) m_schedule.resize(depth + 1);
+        entry.level = depth;
+        entry.index = m_schedule[depth].size();
+        m_schedule[depth].push_back(arg_node->m_kernel_ptr);
+        entry.depth = depth + 1;
+      }
+    }
+    arg_state.entries.emplace(arg_node, entry);
+    return entry.depth;
+  }
+
+  void build_schedule() {
+    m_schedule.clear();
+    m_fused_kernels.clear();
+    schedule_state state;
+    for (auto const& sink : m_sinks) {
+      count_successors(sink.get(), state.successors);
+    }
+    for (auto const& sink : m_sinks) {
+      schedule_node(sink.get(), state);
+    }
+    m_schedule_valid = true;
+  }
+
  public:
   //----------------------------------------------------------------------------
   // <editor-fold desc="Constructors, destructor, and assignment"> {{{2
@@ -120,6 +344,7 @@ struct GraphImpl : private ExecutionSpaceInstanceStorage<ExecutionSpace> {
     auto spot = m_sinks.find(arg_node_ptr);
     KOKKOS_ASSERT(spot == m_sinks.end())
     m_sinks.insert(std::move(spot), std::move(arg_node_ptr));
+    m_schedule_valid = false;
   }
 
   template <class NodeImplPtr, class PredecessorRef>
@@ -132,15 +357,14 @@ struct GraphImpl : private ExecutionSpaceInstanceStorage<ExecutionSpace> {
     auto pred_ref_spot = m_sinks.find(pred_ptr);
     KOKKOS_ASSERT(node_ptr_spot != m_sinks.end())
     if (pred_ref_spot != m_sinks.end()) {
-      // delegate responsibility for executing the predecessor to arg_node
-      // and then remove the predecessor from the set of sinks
+      // the predecessor is reachable from arg_node now, so remove it from
+      // the set of sinks
       (*node_ptr_spot)->set_predecessor(std::move(*pred_ref_spot));
       m_sinks.erase(pred_ref_spot);
     } else {
-      // We still want to check that it's executed, even though someone else
-      // should have executed it before us
       (*node_ptr_spot)->set_predecessor(std::move(pred_ptr));
     }
+    m_schedule_valid = false;
   }
 
   template <class... PredecessorRefs>
@@ -168,13 +392,11 @@ struct GraphImpl : private ExecutionSpaceInstanceStorage<ExecutionSpace> {
   }
 
   void submit() {
-    // This reset is gross, but for the purposes of our simple host
-    // implementation...
-    for (auto& sink : m_sinks) {
-      sink->reset_has_executed();
-    }
-    for (auto& sink : m_sinks) {
-      sink->execute_node();
+    if (!m_schedule_valid) build_schedule();
+    // Host kernels complete before returning, so the levels need no fences
+    // in between.
+    for (auto const& level : m_schedule) {
+      level_executor_t::execute(get_execution_space(), level);
     }
   }
 
@@ -43,6 +43,9 @@
 */
 
 #include <Kokkos_Core.hpp>
+#include <impl/Kokkos_CPUDiscovery.hpp>
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 
 namespace Kokkos {
@@ -50,6 +53,76 @@ namespace Impl {
 PerTeamValue::PerTeamValue(int arg) : value(arg) {}
 
 PerThreadValue::PerThreadValue(int arg) : value(arg) {}
+
+std::int64_t host_mdrange_tile_budget() {
+  // The input of a stencil with its halo, its output and some more
+  static const std::int64_t budget = [] {
+    long cache_size = host_cache_size(2);
+    if (cache_size <= 0) cache_size = 1 << 20;
+    return std::max<std::int64_t>(cache_size / (4 * sizeof(double)), 1024);
+  }();
+  return budget;
+}
+
+void host_mdrange_default_tile(int rank, bool inner_is_right,
+                               std::int64_t const* span, std::int64_t* tile,
+                               std::int64_t concurrency, std::int64_t budget) {
+  // Dimensions from the innermost to the outermost
+  int order[ARRAY_LAYOUT_MAX_RANK];
+  bool chosen[ARRAY_LAYOUT_MAX_RANK];
+  int num_chosen = 0;
+  for (int n = 0; n < rank; ++n) {
+    const int i = inner_is_right ? rank - 1 - n : n;
+    order[n]    = i;
+    chosen[i]   = tile[i] <= 0;
+    if (chosen[i]) {
+      ++num_chosen;
+    } else {
+      budget /= tile[i];
+    }
+  }
+  if (num_chosen == 0) return;
+  budget = std::max<std::int64_t>(budget, 1);
+
+  int inner = -1;
+  for (int n = 0; n < rank; ++n) {
+    const int i = order[n];
+    if (!chosen[i]) continue;
+    if (inner < 0) inner = i;
+    const std::int64_t extent = std::max<std::int64_t>(span[i], 1);
+    // Whole rows in the innermost dimension for vectorization and
+    // prefetching, square tiles in the others for reuse across rows
+    std::int64_t size =
+        i == inner ? budget
+                   : static_cast<std::int64_t>(std::pow(
+                         static_cast<double>(budget), 1.0 / num_chosen));
+    size    = std::min(std::max<std::int64_t>(size, 1), extent);
+    tile[i] = size;
+    budget  = std::max<std::int64_t>(budget / size, 1);
+    --num_chosen;
+  }
+
+  // Enough tiles for a balanced static distribution over the threads
+  auto num_tiles = [&]() {
+    std::int64_t count = 1;
+    for (int i = 0; i < rank; ++i) {
+      count *= (std::max<std::int64_t>(span[i], 1) + tile[i] - 1) / tile[i];
+    }
+    return count;
+  };
+  while (num_tiles() < 8 * concurrency) {
+    int split = -1;
+    for (int n = rank - 1; n >= 0; --n) {
+      const int i = order[n];
+      if (chosen[i] && i != inner && tile[i] > 1 &&
+          (split < 0 || tile[i] > tile[split]))
+        split = i;
+    }
+    if (split < 0 && tile[inner] > 1) split = inner;
+    if (split < 0) break;
+    tile[split] = (tile[split] + 1) / 2;
+  }
+}
 }  // namespace Impl
 
 Impl::PerTeamValue PerTeam(const int& arg) { return Impl::PerTeamValue(arg); }
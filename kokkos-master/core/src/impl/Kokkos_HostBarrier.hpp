@@ -47,6 +47,7 @@
 
 #include <Kokkos_Macros.hpp>
 #include <Kokkos_Atomic.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -89,10 +90,8 @@ class HostBarrier {
   static constexpr int master_idx = 64 / sizeof(int);
   static constexpr int wait_idx   = 96 / sizeof(int);
 
-  static constexpr int num_nops                   = 32;
-  static constexpr int iterations_till_backoff    = 64;
-  static constexpr int log2_iterations_till_yield = 4;
-  static constexpr int log2_iterations_till_sleep = 6;
+  static constexpr int num_nops                = 32;
+  static constexpr int iterations_till_backoff = 64;
 
  public:
   // will return true if call is the last thread to arrive
@@ -108,6 +107,9 @@ class HostBarrier {
 
     if (master_wait && result) {
       Kokkos::atomic_fetch_add(buffer + master_idx, 1);
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+      host_thread_wake(buffer[master_idx]);
+#endif
     }
 
     return result;
@@ -123,6 +125,9 @@ class HostBarrier {
     Kokkos::memory_fence();
     Kokkos::atomic_fetch_sub(buffer + arrive_idx, size);
     Kokkos::atomic_fetch_add(buffer + wait_idx, 1);
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+    host_thread_wake(buffer[wait_idx]);
+#endif
   }
 
   // should only be called by the master thread, will allow the master thread to
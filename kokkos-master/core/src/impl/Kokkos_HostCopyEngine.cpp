@@ -0,0 +1,236 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Macros.hpp>
+#include <impl/Kokkos_HostCopyEngine.hpp>
+#include <impl/Kokkos_HostSpace_deepcopy.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+// Without a threading backend the thread library may not be linked in,
+// copies then complete before their submission returns
+#if defined(KOKKOS_ENABLE_OPENMP) || defined(KOKKOS_ENABLE_THREADS)
+#define KOKKOS_IMPL_HOST_COPY_ENGINE_THREAD
+#include <thread>
+#endif
+
+namespace Kokkos {
+
+namespace Impl {
+
+namespace {
+
+struct HostCopyTask {
+  void* dst;
+  const void* src;
+  size_t n;
+  uint64_t ticket;
+  std::shared_ptr<void> keep_alive;
+};
+
+class HostCopyEngine {
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_submitted_cv;
+  std::condition_variable m_completed_cv;
+  std::deque<HostCopyTask> m_queue;
+  std::vector<std::shared_ptr<void>> m_retired;
+#if defined(KOKKOS_IMPL_HOST_COPY_ENGINE_THREAD)
+  std::thread m_thread;
+#endif
+  bool m_stop = false;
+
+  std::atomic<uint64_t> m_submitted{0};
+  std::atomic<uint64_t> m_completed{0};
+  std::atomic<bool> m_has_retired{false};
+
+  void run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_submitted_cv.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+      if (m_queue.empty()) return;
+
+      HostCopyTask task = std::move(m_queue.front());
+      m_queue.pop_front();
+      lock.unlock();
+
+      copy(task);
+
+      lock.lock();
+      retire(task);
+    }
+  }
+
+  static void copy(const HostCopyTask& task) {
+    // The host thread pool belongs to the execution spaces, copy on the
+    // calling thread only
+    if (ptrdiff_t(task.n) >= hostspace_streaming_limit()) {
+      hostspace_stream_copy(task.dst, task.src, task.n, false);
+    } else {
+      std::memcpy(task.dst, task.src, task.n);
+    }
+  }
+
+  // Requires the lock
+  void retire(HostCopyTask& task) {
+    m_retired.push_back(std::move(task.keep_alive));
+    m_has_retired.store(true, std::memory_order_relaxed);
+    m_completed.store(task.ticket, std::memory_order_release);
+    m_completed_cv.notify_all();
+  }
+
+  // Release the keep alive handles on the calling thread, outside the lock
+  void release_retired() {
+    if (!m_has_retired.load(std::memory_order_relaxed)) return;
+    std::vector<std::shared_ptr<void>> retired;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      retired.swap(m_retired);
+      m_has_retired.store(false, std::memory_order_relaxed);
+    }
+  }
+
+  // As release_retired but never blocks nor throws, if the helper thread
+  // holds the lock the handles are released by a later wait or fence
+  void try_release_retired() noexcept {
+    if (!m_has_retired.load(std::memory_order_relaxed)) return;
+    std::vector<std::shared_ptr<void>> retired;
+    if (m_mutex.try_lock()) {
+      retired.swap(m_retired);
+      m_has_retired.store(false, std::memory_order_relaxed);
+      m_mutex.unlock();
+    }
+  }
+
+ public:
+  uint64_t submit(void* dst, const void* src, size_t n,
+                  std::shared_ptr<void> keep_alive) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const uint64_t ticket = m_submitted.load(std::memory_order_relaxed) + 1;
+    m_submitted.store(ticket, std::memory_order_relaxed);
+    HostCopyTask task{dst, src, n, ticket, std::move(keep_alive)};
+#if defined(KOKKOS_IMPL_HOST_COPY_ENGINE_THREAD)
+    if (!m_thread.joinable()) {
+      m_stop   = false;
+      m_thread = std::thread([this] { run(); });
+    }
+    m_queue.push_back(std::move(task));
+    m_submitted_cv.notify_one();
+#else
+    copy(task);
+    retire(task);
+#endif
+    return ticket;
+  }
+
+  bool is_complete(const uint64_t ticket) const {
+    return ticket <= m_completed.load(std::memory_order_acquire);
+  }
+
+  void wait(const uint64_t ticket) {
+    if (!is_complete(ticket)) {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_completed_cv.wait(lock, [&] { return is_complete(ticket); });
+    }
+    release_retired();
+  }
+
+  // Called from the noexcept fences of the host execution spaces, so wait
+  // without the mutex and condition variable
+  void fence() noexcept {
+    const uint64_t ticket = m_submitted.load(std::memory_order_acquire);
+#if defined(KOKKOS_IMPL_HOST_COPY_ENGINE_THREAD)
+    while (!is_complete(ticket)) std::this_thread::yield();
+#else
+    (void)ticket;
+#endif
+    try_release_retired();
+  }
+
+  void finalize() {
+    wait(m_submitted.load(std::memory_order_acquire));
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_submitted_cv.notify_one();
+#if defined(KOKKOS_IMPL_HOST_COPY_ENGINE_THREAD)
+    if (m_thread.joinable()) m_thread.join();
+#endif
+  }
+};
+
+// Never destroyed, a joinable thread must not be destroyed at exit
+HostCopyEngine& host_copy_engine() {
+  static HostCopyEngine* engine = new HostCopyEngine;
+  return *engine;
+}
+
+}  // namespace
+
+uint64_t host_copy_engine_submit(void* dst, const void* src, size_t n,
+                                 std::shared_ptr<void> keep_alive) {
+  return host_copy_engine().submit(dst, src, n, std::move(keep_alive));
+}
+
+bool host_copy_engine_is_complete(uint64_t ticket) {
+  return host_copy_engine().is_complete(ticket);
+}
+
+void host_copy_engine_wait(uint64_t ticket) {
+  host_copy_engine().wait(ticket);
+}
+
+void host_copy_engine_fence() noexcept { host_copy_engine().fence(); }
+
+void host_copy_engine_finalize() { host_copy_engine().finalize(); }
+
+}  // namespace Impl
+
+}  // namespace Kokkos
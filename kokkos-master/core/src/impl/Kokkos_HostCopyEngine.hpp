@@ -0,0 +1,86 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_IMPL_HOSTCOPYENGINE_HPP
+#define KOKKOS_IMPL_HOSTCOPYENGINE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Kokkos {
+
+namespace Impl {
+
+/* Background engine copying host memory on a dedicated helper thread so
+ * that copies overlap with kernels of the host execution spaces.
+ *
+ * Copies complete in submission order and are identified by a ticket,
+ * the tickets of a process are increasing starting at one.  The keep_alive
+ * handle of a copy, e.g. the Views it reads and writes, is released by the
+ * thread calling a wait or fence after the copy completed, never by the
+ * helper thread.  Host execution space fences wait for all submitted
+ * copies and release the handles of completed copies; the fence does not
+ * block on the engine's lock, so it may leave handles to a later wait or
+ * fence.
+ */
+
+uint64_t host_copy_engine_submit(void* dst, const void* src, size_t n,
+                                 std::shared_ptr<void> keep_alive);
+
+bool host_copy_engine_is_complete(uint64_t ticket);
+
+void host_copy_engine_wait(uint64_t ticket);
+
+void host_copy_engine_fence() noexcept;
+
+// Wait for all copies and join the helper thread, a later submit starts
+// a new one.
+void host_copy_engine_finalize();
+
+}  // namespace Impl
+
+}  // namespace Kokkos
+
+#endif  // KOKKOS_IMPL_HOSTCOPYENGINE_HPP
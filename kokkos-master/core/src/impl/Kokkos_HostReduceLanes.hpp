@@ -0,0 +1,264 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_HOSTREDUCELANES_HPP
+#define KOKKOS_HOSTREDUCELANES_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <impl/Kokkos_FunctorAnalysis.hpp>
+
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+/* is_lane_reducer<ReducerType> - built-in reducers over arithmetic scalars
+ * whose partial results may be kept in several independent accumulators
+ * and joined at the end of a range. */
+template <class ReducerType>
+struct is_lane_reducer : std::false_type {};
+
+template <class Scalar, class Space>
+struct is_lane_reducer<Kokkos::Sum<Scalar, Space>>
+    : std::is_arithmetic<Scalar> {};
+
+template <class Scalar, class Space>
+struct is_lane_reducer<Kokkos::Prod<Scalar, Space>>
+    : std::is_arithmetic<Scalar> {};
+
+template <class Scalar, class Space>
+struct is_lane_reducer<Kokkos::Min<Scalar, Space>>
+    : std::is_arithmetic<Scalar> {};
+
+template <class Scalar, class Space>
+struct is_lane_reducer<Kokkos::Max<Scalar, Space>>
+    : std::is_arithmetic<Scalar> {};
+
+template <class Scalar, class Index, class Space>
+struct is_lane_reducer<Kokkos::MinLoc<Scalar, Index, Space>>
+    : std::is_arithmetic<Scalar> {};
+
+template <class Scalar, class Index, class Space>
+struct is_lane_reducer<Kokkos::MaxLoc<Scalar, Index, Space>>
+    : std::is_arithmetic<Scalar> {};
+
+/* HostReduceLanes - the per-thread loop of a host RangePolicy reduction.
+ *
+ * Calling the functor on one accumulator for every index makes each
+ * iteration depend on the previous one, which keeps the compiler from
+ * vectorizing or overlapping iterations even for a plain dot product.
+ * For the built-in reducers above, and for functors reducing a single
+ * arithmetic value with the default sum (no init or join member), the
+ * range is instead processed in groups of 'lanes' consecutive indices,
+ * each index of a group updating its own accumulator. The functor is
+ * still called in index order; only the association of the reduction
+ * changes. The lane accumulators are joined into 'update' at the end.
+ * Every other reduction uses the element-by-element loop. */
+template <class Policy, class FunctorType, class ReducerType>
+struct HostReduceLanes {
+ private:
+  using WorkTag  = typename Policy::work_tag;
+  using Member   = typename Policy::member_type;
+  using Analysis =
+      FunctorAnalysis<FunctorPatternInterface::REDUCE, Policy, FunctorType>;
+
+  using value_type     = typename Analysis::value_type;
+  using reference_type = typename Analysis::reference_type;
+
+  enum : bool {
+    is_default_sum =
+        std::is_same<InvalidType, ReducerType>::value &&
+        std::is_arithmetic<value_type>::value &&
+        std::is_same<reference_type, value_type&>::value &&
+        !Analysis::has_init_member_function &&
+        !Analysis::has_join_member_function
+  };
+
+  using ReducerTypeFwd =
+      typename std::conditional<std::is_same<InvalidType, ReducerType>::value,
+                                FunctorType, ReducerType>::type;
+
+ public:
+  enum : bool {
+    enabled = is_default_sum || is_lane_reducer<ReducerType>::value
+  };
+
+  // One cache line of accumulators, at least 4 and at most 16
+  enum : int {
+    lanes = !enabled ? 1
+                     : 64 / sizeof(value_type) < 4
+                           ? 4
+                           : 64 / sizeof(value_type) > 16
+                                 ? 16
+                                 : int(64 / sizeof(value_type))
+  };
+
+ private:
+  template <class TagType, class IndexType>
+  KOKKOS_FORCEINLINE_FUNCTION static
+      typename std::enable_if<std::is_same<TagType, void>::value>::type
+      apply(const FunctorType& functor, const IndexType i,
+            reference_type update) {
+    functor(i, update);
+  }
+
+  template <class TagType, class IndexType>
+  KOKKOS_FORCEINLINE_FUNCTION static
+      typename std::enable_if<!std::is_same<TagType, void>::value>::type
+      apply(const FunctorType& functor, const IndexType i,
+            reference_type update) {
+    functor(TagType{}, i, update);
+  }
+
+  // Unrolled at compile time: a loop over the lanes tends to be vectorized
+  // across groups (with gathers) instead of across the lanes of a group.
+  template <class IndexType, int L>
+  KOKKOS_FORCEINLINE_FUNCTION static void apply_group(
+      const FunctorType& functor, const IndexType i, value_type* lane,
+      std::integral_constant<int, L>) {
+    HostReduceLanes::template apply<WorkTag>(functor, i + L, lane[L]);
+    apply_group(functor, i, lane, std::integral_constant<int, L + 1>());
+  }
+
+  template <class IndexType>
+  KOKKOS_FORCEINLINE_FUNCTION static void apply_group(
+      const FunctorType&, const IndexType, value_type*,
+      std::integral_constant<int, lanes>) {}
+
+  template <bool DefaultSum = is_default_sum>
+  KOKKOS_FORCEINLINE_FUNCTION static
+      typename std::enable_if<DefaultSum>::type
+      lane_init(const ReducerTypeFwd&, value_type& value) {
+    value = value_type();
+  }
+
+  template <bool DefaultSum = is_default_sum>
+  KOKKOS_FORCEINLINE_FUNCTION static
+      typename std::enable_if<!DefaultSum>::type
+      lane_init(const ReducerTypeFwd& reducer, value_type& value) {
+    reducer.init(value);
+  }
+
+  template <bool DefaultSum = is_default_sum>
+  KOKKOS_FORCEINLINE_FUNCTION static
+      typename std::enable_if<DefaultSum>::type
+      lane_join(const ReducerTypeFwd&, value_type& dest,
+                const value_type& src) {
+    dest += src;
+  }
+
+  template <bool DefaultSum = is_default_sum>
+  KOKKOS_FORCEINLINE_FUNCTION static
+      typename std::enable_if<!DefaultSum>::type
+      lane_join(const ReducerTypeFwd& reducer, value_type& dest,
+                const value_type& src) {
+    reducer.join(dest, src);
+  }
+
+  template <class IndexType>
+  inline static void exec_lanes(const FunctorType& functor,
+                                const ReducerTypeFwd& reducer,
+                                const IndexType ibeg, const IndexType iend,
+                                reference_type update) {
+    value_type lane[lanes];
+    for (int l = 0; l < lanes; ++l) lane_init(reducer, lane[l]);
+
+    IndexType i = ibeg;
+    for (; iend - i >= IndexType(lanes); i += lanes) {
+      apply_group(functor, i, lane, std::integral_constant<int, 0>());
+    }
+    for (; i < iend; ++i) {
+      HostReduceLanes::template apply<WorkTag>(functor, i, update);
+    }
+
+    for (int l = 0; l < lanes; ++l) lane_join(reducer, update, lane[l]);
+  }
+
+  template <bool Enabled = enabled>
+  inline static typename std::enable_if<Enabled>::type exec(
+      const FunctorType& functor, const ReducerTypeFwd& reducer,
+      const Member ibeg, const Member iend, reference_type update) {
+    // Most functors take an int index. Converting the (usually 64 bit)
+    // policy index inside the functor hides from the compiler that the
+    // indices of a group are consecutive, which prevents vectorization,
+    // so iterate over int whenever the range fits.
+    if (sizeof(Member) > sizeof(int) && Member(int(ibeg)) == ibeg &&
+        Member(int(iend)) == iend) {
+      exec_lanes<int>(functor, reducer, int(ibeg), int(iend), update);
+    } else {
+      exec_lanes<Member>(functor, reducer, ibeg, iend, update);
+    }
+  }
+
+  template <bool Enabled = enabled>
+  inline static typename std::enable_if<!Enabled>::type exec(
+      const FunctorType& functor, const ReducerTypeFwd&, const Member ibeg,
+      const Member iend, reference_type update) {
+#if defined(KOKKOS_ENABLE_AGGRESSIVE_VECTORIZATION) && \
+    defined(KOKKOS_ENABLE_PRAGMA_IVDEP)
+#pragma ivdep
+#endif
+    for (Member i = ibeg; i < iend; ++i) {
+      HostReduceLanes::template apply<WorkTag>(functor, i, update);
+    }
+  }
+
+ public:
+  /** \brief  Reduce [ibeg, iend) into update.
+   *
+   *  'reducer' is the functor itself when ReducerType is InvalidType.
+   */
+  inline static void exec_range(const FunctorType& functor,
+                                const ReducerTypeFwd& reducer,
+                                const Member ibeg, const Member iend,
+                                reference_type update) {
+    exec(functor, reducer, ibeg, iend, update);
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_HOSTREDUCELANES_HPP */
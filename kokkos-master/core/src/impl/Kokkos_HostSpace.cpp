@@ -89,6 +89,32 @@
 
 /*--------------------------------------------------------------------------*/
 
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#if defined(MAP_ANONYMOUS) && defined(MAP_PRIVATE)
+
+// NUMA placement of anonymous mappings through the mbind system call,
+// without depending on libnuma
+#if defined(SYS_mbind)
+#define KOKKOS_IMPL_HOST_NUMA_MBIND
+#endif
+
+// Transparent huge pages through madvise, explicit huge pages through
+// MAP_HUGETLB when the headers provide it
+#if defined(MADV_HUGEPAGE)
+#define KOKKOS_IMPL_HOST_HUGE_PAGES
+#endif
+
+#endif
+
+#endif
+
+/*--------------------------------------------------------------------------*/
+
 #include <cstddef>
 #include <cstdlib>
 #include <cstdint>
@@ -98,8 +124,14 @@
 #include <sstream>
 #include <cstring>
 
+#include <atomic>
+#include <fstream>
+
 #include <Kokkos_HostSpace.hpp>
+#include <Kokkos_hwloc.hpp>
 #include <impl/Kokkos_Error.hpp>
+#include <impl/Kokkos_HostSpace_cache.hpp>
+#include <impl/Kokkos_HostSpace_deepcopy.hpp>
 #include <Kokkos_Atomic.hpp>
 
 #if (defined(KOKKOS_ENABLE_ASM) || defined(KOKKOS_ENABLE_TM)) && \
@@ -112,6 +144,239 @@
 
 namespace Kokkos {
 
+extern bool show_warnings() noexcept;
+
+namespace {
+
+HostSpace::HugePages g_host_space_huge_pages = HostSpace::HUGE_PAGES_OFF;
+
+constexpr size_t host_huge_page_2m = size_t(1) << 21;
+constexpr size_t host_huge_page_1g = size_t(1) << 30;
+
+// Size of the pages backing allocations with the given hint, zero if
+// huge pages are not available
+size_t host_huge_page_size(const HostSpace::HugePages arg_huge_pages) {
+#if defined(KOKKOS_IMPL_HOST_HUGE_PAGES)
+  switch (arg_huge_pages) {
+    case HostSpace::HUGE_PAGES_THP:
+    case HostSpace::HUGE_PAGES_2M: return host_huge_page_2m;
+    case HostSpace::HUGE_PAGES_1G: return host_huge_page_1g;
+    default: break;
+  }
+#else
+  (void)arg_huge_pages;
+#endif
+  return 0;
+}
+
+#if defined(KOKKOS_IMPL_HOST_NUMA_MBIND)
+
+// From <numaif.h>
+constexpr int host_numa_mpol_bind       = 2;
+constexpr int host_numa_mpol_interleave = 3;
+constexpr int host_numa_max_nodes       = 1024;
+
+unsigned host_numa_node_count() {
+  if (Kokkos::hwloc::available()) {
+    return Kokkos::hwloc::get_available_numa_count();
+  }
+
+  // Without hwloc fall back to the online node list, e.g. "0-3"
+  unsigned count = 1;
+  std::ifstream online("/sys/devices/system/node/online");
+  std::string nodes;
+  if (online >> nodes) {
+    const size_t last = nodes.find_last_of("-,");
+    const int max_node =
+        std::atoi(nodes.c_str() + (last == std::string::npos ? 0 : last + 1));
+    count = unsigned(max_node) + 1;
+  }
+  return count;
+}
+
+void host_numa_bind(void *const ptr, const size_t arg_alloc_size,
+                    const HostSpace::NumaPolicy arg_numa_policy,
+                    const int arg_numa_node) {
+  constexpr int bits_per_word = 8 * sizeof(unsigned long);
+
+  unsigned long mask[host_numa_max_nodes / bits_per_word] = {};
+  int mode                                                = 0;
+
+  if (arg_numa_policy == HostSpace::NUMA_INTERLEAVE) {
+    const unsigned count = std::min(host_numa_node_count(),
+                                    unsigned(host_numa_max_nodes));
+    for (unsigned node = 0; node < count; ++node) {
+      mask[node / bits_per_word] |= 1ul << (node % bits_per_word);
+    }
+    mode = host_numa_mpol_interleave;
+  } else {
+    mask[arg_numa_node / bits_per_word] |= 1ul
+                                           << (arg_numa_node % bits_per_word);
+    mode = host_numa_mpol_bind;
+  }
+
+  // Pages are not touched yet so the policy applies to all of them.
+  // If the kernel refuses the policy the pages keep the default placement.
+  (void)syscall(SYS_mbind, ptr, arg_alloc_size, mode, mask,
+                (unsigned long)host_numa_max_nodes, 0u);
+}
+
+#endif
+
+#if defined(KOKKOS_IMPL_HOST_NUMA_MBIND) || \
+    defined(KOKKOS_IMPL_HOST_HUGE_PAGES)
+
+#if defined(KOKKOS_IMPL_HOST_HUGE_PAGES) && defined(MAP_HUGETLB)
+
+// From <linux/mman.h>, missing from older headers
+constexpr int host_map_huge_shift = 26;
+constexpr int host_map_huge_2m    = 21 << host_map_huge_shift;
+constexpr int host_map_huge_1g    = 30 << host_map_huge_shift;
+
+void *host_hugetlb_map(const size_t arg_map_size,
+                       const HostSpace::HugePages arg_huge_pages) {
+  const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                    (arg_huge_pages == HostSpace::HUGE_PAGES_1G
+                         ? host_map_huge_1g
+                         : host_map_huge_2m);
+
+  void *ptr =
+      mmap(nullptr, arg_map_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+
+  if (ptr == MAP_FAILED) {
+    static std::atomic<bool> warned(false);
+    if (Kokkos::show_warnings() && !warned.exchange(true)) {
+      std::cerr << "Kokkos::HostSpace WARNING: cannot map "
+                << (arg_huge_pages == HostSpace::HUGE_PAGES_1G ? "1G" : "2M")
+                << " huge pages, falling back to transparent huge pages"
+                << std::endl;
+    }
+  }
+  return ptr;
+}
+
+#else
+
+void *host_hugetlb_map(const size_t, const HostSpace::HugePages) {
+  return MAP_FAILED;
+}
+
+#endif
+
+// Map private anonymous memory for NUMA placement or huge pages.
+// With huge pages the mapping covers arg_alloc_size rounded up to
+// a whole number of huge pages, see host_mmap_size.
+size_t host_mmap_size(const size_t arg_alloc_size,
+                      const HostSpace::HugePages arg_huge_pages) {
+  const size_t page = host_huge_page_size(arg_huge_pages);
+  return page ? (arg_alloc_size + page - 1) / page * page : arg_alloc_size;
+}
+
+void *host_mmap_allocate(const size_t arg_alloc_size,
+                         const HostSpace::HugePages arg_huge_pages,
+                         const HostSpace::NumaPolicy arg_numa_policy,
+                         const int arg_numa_node) {
+  constexpr int prot  = PROT_READ | PROT_WRITE;
+  constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+  const size_t page     = host_huge_page_size(arg_huge_pages);
+  const size_t map_size = host_mmap_size(arg_alloc_size, arg_huge_pages);
+
+  void *ptr = MAP_FAILED;
+
+  if (arg_huge_pages == HostSpace::HUGE_PAGES_2M ||
+      arg_huge_pages == HostSpace::HUGE_PAGES_1G) {
+    ptr = host_hugetlb_map(map_size, arg_huge_pages);
+  }
+
+  if (ptr == MAP_FAILED && page) {
+    // Over-map by one huge page and trim so the mapping is aligned to
+    // the huge page size, otherwise the kernel can only use huge pages
+    // for its aligned interior.
+    void *raw = mmap(nullptr, map_size + page, prot, flags, -1, 0);
+    if (raw != MAP_FAILED) {
+      const uintptr_t begin = reinterpret_cast<uintptr_t>(raw);
+      const uintptr_t align = (begin + page - 1) & ~uintptr_t(page - 1);
+      const uintptr_t head  = align - begin;
+      const uintptr_t tail  = page - head;
+      if (head) munmap(raw, head);
+      if (tail) munmap(reinterpret_cast<void *>(align + map_size), tail);
+      ptr = reinterpret_cast<void *>(align);
+#if defined(KOKKOS_IMPL_HOST_HUGE_PAGES)
+      // Advisory only: without THP support the pages stay base pages
+      (void)madvise(ptr, map_size, MADV_HUGEPAGE);
+#endif
+    }
+  } else if (ptr == MAP_FAILED) {
+    ptr = mmap(nullptr, map_size, prot, flags, -1, 0);
+  }
+
+  if (ptr == MAP_FAILED) return nullptr;
+
+#if defined(KOKKOS_IMPL_HOST_NUMA_MBIND)
+  if (arg_numa_policy == HostSpace::NUMA_INTERLEAVE ||
+      arg_numa_policy == HostSpace::NUMA_BIND) {
+    host_numa_bind(ptr, map_size, arg_numa_policy, arg_numa_node);
+  }
+#else
+  (void)arg_numa_policy;
+  (void)arg_numa_node;
+#endif
+
+  return ptr;
+}
+
+void host_mmap_deallocate(void *const arg_alloc_ptr,
+                          const size_t arg_alloc_size,
+                          const HostSpace::HugePages arg_huge_pages) {
+  munmap(arg_alloc_ptr, host_mmap_size(arg_alloc_size, arg_huge_pages));
+}
+
+#else
+
+// Not reachable: the HostSpace constructor rejects the NUMA policies and
+// host_huge_page_size disables huge pages
+void *host_mmap_allocate(const size_t, const HostSpace::HugePages,
+                         const HostSpace::NumaPolicy, const int) {
+  return nullptr;
+}
+
+void host_mmap_deallocate(void *const, const size_t,
+                          const HostSpace::HugePages) {}
+
+#endif
+
+// Every block handed out by HostSpace is preceded by a header recording how
+// it was obtained. The cache threshold, huge page and NUMA settings are
+// captured by each HostSpace instance, so the instance releasing a block may
+// be configured differently from the one that allocated it.
+enum class HostBlockPath : int {
+  Cache,
+  Mmap,
+  StdMalloc,
+  IntelMMAlloc,
+  PosixMemalign,
+  PosixMmap
+};
+
+struct HostBlockHeader {
+  void *base;  // pointer returned by the system allocator
+  HostBlockPath path;
+  HostSpace::HugePages huge_pages;  // page size of Mmap blocks
+};
+
+constexpr size_t host_block_header_size = Kokkos::Impl::MEMORY_ALIGNMENT;
+
+static_assert(sizeof(HostBlockHeader) <= host_block_header_size,
+              "HostSpace block header must fit in front of aligned data");
+
+HostBlockHeader *host_block_header(void *const arg_alloc_ptr) {
+  return reinterpret_cast<HostBlockHeader *>(static_cast<char *>(arg_alloc_ptr) -
+                                             host_block_header_size);
+}
+
+}  // namespace
+
 /* Default allocation mechanism */
 HostSpace::HostSpace()
     : m_alloc_mech(
@@ -124,12 +389,20 @@ HostSpace::HostSpace()
 #else
           HostSpace::STD_MALLOC
 #endif
-      ) {
+          ),
+      m_numa_policy(HostSpace::NUMA_DEFAULT),
+      m_numa_node(0),
+      m_huge_pages(g_host_space_huge_pages),
+      m_cache_threshold(Kokkos::Impl::host_space_cache_threshold()) {
 }
 
 /* Default allocation mechanism */
 HostSpace::HostSpace(const HostSpace::AllocationMechanism &arg_alloc_mech)
-    : m_alloc_mech(HostSpace::STD_MALLOC) {
+    : m_alloc_mech(HostSpace::STD_MALLOC),
+      m_numa_policy(HostSpace::NUMA_DEFAULT),
+      m_numa_node(0),
+      m_huge_pages(g_host_space_huge_pages),
+      m_cache_threshold(Kokkos::Impl::host_space_cache_threshold()) {
   if (arg_alloc_mech == STD_MALLOC) {
     m_alloc_mech = HostSpace::STD_MALLOC;
   }
@@ -163,6 +436,48 @@ HostSpace::HostSpace(const HostSpace::AllocationMechanism &arg_alloc_mech)
   }
 }
 
+HostSpace::HostSpace(const HostSpace::NumaPolicy &arg_numa_policy,
+                     const int arg_numa_node)
+    : HostSpace() {
+  m_numa_policy = arg_numa_policy;
+  m_numa_node   = arg_numa_node;
+
+  // Cached blocks are recycled regardless of their placement
+  if (arg_numa_policy != HostSpace::NUMA_DEFAULT) m_cache_threshold = 0;
+
+  if (arg_numa_policy == HostSpace::NUMA_INTERLEAVE ||
+      arg_numa_policy == HostSpace::NUMA_BIND) {
+#if defined(KOKKOS_IMPL_HOST_NUMA_MBIND)
+    // Placement policies apply to whole pages of a private mapping
+    m_alloc_mech = HostSpace::POSIX_MMAP;
+
+    if (arg_numa_policy == HostSpace::NUMA_BIND &&
+        (arg_numa_node < 0 || host_numa_max_nodes <= arg_numa_node ||
+         (Kokkos::hwloc::available() &&
+          Kokkos::hwloc::get_available_numa_count() <=
+              unsigned(arg_numa_node)))) {
+      std::ostringstream msg;
+      msg << "Kokkos::HostSpace NUMA_BIND to node " << arg_numa_node
+          << " is not available";
+      Kokkos::Impl::throw_runtime_exception(msg.str());
+    }
+#else
+    Kokkos::Impl::throw_runtime_exception(
+        std::string("Kokkos::HostSpace ") +
+        (arg_numa_policy == HostSpace::NUMA_INTERLEAVE ? "NUMA_INTERLEAVE"
+                                                       : "NUMA_BIND") +
+        " is not available");
+#endif
+  }
+}
+
+HostSpace::HostSpace(const HostSpace::HugePages &arg_huge_pages)
+    : HostSpace() {
+  if (arg_huge_pages != HostSpace::HUGE_PAGES_DEFAULT) {
+    m_huge_pages = arg_huge_pages;
+  }
+}
+
 void *HostSpace::allocate(const size_t arg_alloc_size) const {
   return allocate("[unlabeled]", arg_alloc_size);
 }
@@ -191,35 +506,38 @@ void *HostSpace::impl_allocate(
   void *ptr = nullptr;
 
   if (arg_alloc_size) {
-    if (m_alloc_mech == STD_MALLOC) {
+    const size_t block_size  = arg_alloc_size + host_block_header_size;
+    const size_t huge_page   = host_huge_page_size(m_huge_pages);
+    const bool use_huge_page = huge_page && huge_page <= arg_alloc_size;
+
+    HostBlockHeader header = {nullptr, HostBlockPath::StdMalloc,
+                              HUGE_PAGES_OFF};
+
+    if (block_size <= m_cache_threshold) {
+      header.path = HostBlockPath::Cache;
+      header.base = Kokkos::Impl::host_space_cache_allocate(block_size);
+    } else if (use_huge_page || m_numa_policy == NUMA_INTERLEAVE ||
+               m_numa_policy == NUMA_BIND) {
+      header.path       = HostBlockPath::Mmap;
+      header.huge_pages = use_huge_page ? m_huge_pages : HUGE_PAGES_OFF;
+      header.base       = host_mmap_allocate(block_size, header.huge_pages,
+                                       m_numa_policy, m_numa_node);
+    } else if (m_alloc_mech == STD_MALLOC) {
       // Over-allocate to and round up to guarantee proper alignment.
-      size_t size_padded = arg_alloc_size + sizeof(void *) + alignment;
-
-      void *alloc_ptr = malloc(size_padded);
-
-      if (alloc_ptr) {
-        auto address = reinterpret_cast<uintptr_t>(alloc_ptr);
-
-        // offset enough to record the alloc_ptr
-        address += sizeof(void *);
-        uintptr_t rem    = address % alignment;
-        uintptr_t offset = rem ? (alignment - rem) : 0u;
-        address += offset;
-        ptr = reinterpret_cast<void *>(address);
-        // record the alloc'd pointer
-        address -= sizeof(void *);
-        *reinterpret_cast<void **>(address) = alloc_ptr;
-      }
+      header.path = HostBlockPath::StdMalloc;
+      header.base = malloc(block_size + alignment);
     }
 #if defined(KOKKOS_ENABLE_INTEL_MM_ALLOC)
     else if (m_alloc_mech == INTEL_MM_ALLOC) {
-      ptr = _mm_malloc(arg_alloc_size, alignment);
+      header.path = HostBlockPath::IntelMMAlloc;
+      header.base = _mm_malloc(block_size, alignment);
     }
 #endif
 
 #if defined(KOKKOS_ENABLE_POSIX_MEMALIGN)
     else if (m_alloc_mech == POSIX_MEMALIGN) {
-      posix_memalign(&ptr, alignment, arg_alloc_size);
+      header.path = HostBlockPath::PosixMemalign;
+      posix_memalign(&header.base, alignment, block_size);
     }
 #endif
 
@@ -227,16 +545,17 @@ void *HostSpace::impl_allocate(
     else if (m_alloc_mech == POSIX_MMAP) {
       constexpr size_t use_huge_pages = (1u << 27);
       constexpr int prot              = PROT_READ | PROT_WRITE;
-      const int flags                 = arg_alloc_size < use_huge_pages
+      const int flags                 = block_size < use_huge_pages
                             ? KOKKOS_IMPL_POSIX_MMAP_FLAGS
                             : KOKKOS_IMPL_POSIX_MMAP_FLAGS_HUGE;
 
       // read write access to private memory
 
-      ptr =
+      header.path = HostBlockPath::PosixMmap;
+      header.base =
           mmap(nullptr /* address hint, if nullptr OS kernel chooses address */
                ,
-               arg_alloc_size /* size in bytes */
+               block_size /* size in bytes */
                ,
                prot /* memory protection */
                ,
@@ -246,12 +565,22 @@ void *HostSpace::impl_allocate(
                ,
                0 /* offset */
           );
+      if (header.base == MAP_FAILED) header.base = nullptr;
 
       /* Associated reallocation:
              ptr = mremap( old_ptr , old_size , new_size , MREMAP_MAYMOVE );
       */
     }
 #endif
+
+    if (header.base != nullptr) {
+      // All paths but malloc return aligned blocks
+      const uintptr_t block =
+          (reinterpret_cast<uintptr_t>(header.base) + alignment_mask) &
+          ~alignment_mask;
+      ptr = reinterpret_cast<void *>(block + host_block_header_size);
+      *host_block_header(ptr) = header;
+    }
   }
 
   if ((ptr == nullptr) || (reinterpret_cast<uintptr_t>(ptr) == ~uintptr_t(0)) ||
@@ -286,6 +615,9 @@ void *HostSpace::impl_allocate(
     throw Kokkos::Experimental::RawMemoryAllocationFailure(
         arg_alloc_size, alignment, failure_mode, alloc_mec);
   }
+  if (m_numa_policy == NUMA_FIRST_TOUCH) {
+    Kokkos::Impl::hostspace_parallel_first_touch(ptr, arg_alloc_size);
+  }
   if (Kokkos::Profiling::profileLibraryLoaded()) {
     Kokkos::Profiling::allocateData(arg_handle, arg_label, ptr, reported_size);
   }
@@ -315,30 +647,46 @@ void HostSpace::impl_deallocate(
       Kokkos::Profiling::deallocateData(arg_handle, arg_label, arg_alloc_ptr,
                                         reported_size);
     }
-    if (m_alloc_mech == STD_MALLOC) {
-      void *alloc_ptr = *(reinterpret_cast<void **>(arg_alloc_ptr) - 1);
-      free(alloc_ptr);
-    }
+    const HostBlockHeader header = *host_block_header(arg_alloc_ptr);
+    void *const block            = host_block_header(arg_alloc_ptr);
+    const size_t block_size      = arg_alloc_size + host_block_header_size;
+
+    switch (header.path) {
+      case HostBlockPath::Cache:
+        Kokkos::Impl::host_space_cache_deallocate(block, block_size);
+        break;
+      case HostBlockPath::Mmap:
+        host_mmap_deallocate(block, block_size, header.huge_pages);
+        break;
+      case HostBlockPath::StdMalloc: free(header.base); break;
 #if defined(KOKKOS_ENABLE_INTEL_MM_ALLOC)
-    else if (m_alloc_mech == INTEL_MM_ALLOC) {
-      _mm_free(arg_alloc_ptr);
-    }
+      case HostBlockPath::IntelMMAlloc: _mm_free(block); break;
 #endif
-
 #if defined(KOKKOS_ENABLE_POSIX_MEMALIGN)
-    else if (m_alloc_mech == POSIX_MEMALIGN) {
-      free(arg_alloc_ptr);
-    }
+      case HostBlockPath::PosixMemalign: free(block); break;
 #endif
-
 #if defined(KOKKOS_IMPL_POSIX_MMAP_FLAGS)
-    else if (m_alloc_mech == POSIX_MMAP) {
-      munmap(arg_alloc_ptr, arg_alloc_size);
-    }
+      case HostBlockPath::PosixMmap: munmap(block, block_size); break;
 #endif
+      default: break;
+    }
   }
 }
 
+namespace Impl {
+
+void host_space_set_huge_pages(const HostSpace::HugePages arg_huge_pages) {
+  g_host_space_huge_pages = arg_huge_pages == HostSpace::HUGE_PAGES_DEFAULT
+                                ? HostSpace::HUGE_PAGES_OFF
+                                : arg_huge_pages;
+}
+
+HostSpace::HugePages host_space_huge_pages() {
+  return g_host_space_huge_pages;
+}
+
+}  // namespace Impl
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
@@ -412,7 +760,7 @@ SharedAllocationRecord<Kokkos::HostSpace, void>::SharedAllocationRecord(
       static_cast<SharedAllocationRecord<void, void> *>(this);
 
   strncpy(RecordBase::m_alloc_ptr->m_label, arg_label.c_str(),
-          SharedAllocationHeader::maximum_label_length);
+          SharedAllocationHeader::maximum_label_length - 1);
   // Set last element zero, in case c_str is too long
   RecordBase::m_alloc_ptr
       ->m_label[SharedAllocationHeader::maximum_label_length - 1] = (char)0;
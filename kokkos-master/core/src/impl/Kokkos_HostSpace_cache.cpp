@@ -0,0 +1,269 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_HostSpace.hpp>
+#include <impl/Kokkos_HostSpace_cache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+namespace Kokkos {
+
+namespace Impl {
+
+namespace {
+
+constexpr int cache_min_shift      = 6;  // 64 bytes
+constexpr int cache_max_shift      = 20;
+constexpr int cache_class_count    = cache_max_shift - cache_min_shift + 1;
+constexpr int cache_magazine_size  = 32;
+constexpr int cache_magazine_batch = cache_magazine_size / 2;
+
+static_assert((size_t(1) << cache_max_shift) == host_space_cache_max_threshold,
+              "Size classes must cover the maximum threshold");
+
+std::atomic<size_t> g_cache_threshold(0);
+std::atomic<size_t> g_cache_allocations(0);
+std::atomic<size_t> g_cache_hits(0);
+std::atomic<size_t> g_cache_deallocations(0);
+std::atomic<size_t> g_cache_bytes(0);
+
+int cache_class(const size_t arg_alloc_size) {
+  int shift = cache_min_shift;
+  while ((size_t(1) << shift) < arg_alloc_size) ++shift;
+  return shift - cache_min_shift;
+}
+
+size_t cache_class_size(const int arg_class) {
+  return size_t(1) << (arg_class + cache_min_shift);
+}
+
+// Aligned blocks from the system allocator, the unaligned pointer is
+// recorded in front of the block
+void* cache_system_allocate(const size_t arg_size) {
+  constexpr uintptr_t alignment = Kokkos::Impl::MEMORY_ALIGNMENT;
+
+  void* alloc_ptr = std::malloc(arg_size + sizeof(void*) + alignment);
+  if (alloc_ptr == nullptr) return nullptr;
+
+  uintptr_t address = reinterpret_cast<uintptr_t>(alloc_ptr) + sizeof(void*);
+  address += (alignment - address % alignment) % alignment;
+  reinterpret_cast<void**>(address)[-1] = alloc_ptr;
+  return reinterpret_cast<void*>(address);
+}
+
+void cache_system_deallocate(void* const arg_ptr) {
+  std::free(reinterpret_cast<void**>(arg_ptr)[-1]);
+}
+
+struct CacheCentralList {
+  std::mutex lock;
+  std::vector<void*> blocks;
+};
+
+// Never destroyed so that magazines of threads exiting during static
+// destruction can still spill into it
+CacheCentralList* cache_central_lists() {
+  static CacheCentralList* lists = new CacheCentralList[cache_class_count];
+  return lists;
+}
+
+struct CacheMagazines;
+
+// Magazines of all live threads, so that host_space_cache_release() can
+// drain them. Lock order is registry, then magazines, then central lists.
+struct CacheRegistry {
+  std::mutex lock;
+  std::vector<CacheMagazines*> magazines;
+};
+
+// Never destroyed for the same reason as the central lists
+CacheRegistry& cache_registry() {
+  static CacheRegistry* registry = new CacheRegistry;
+  return *registry;
+}
+
+struct CacheMagazines {
+  // Only contended while host_space_cache_release() drains the magazine
+  std::mutex lock;
+  void* blocks[cache_class_count][cache_magazine_size];
+  int count[cache_class_count];
+
+  CacheMagazines() {
+    for (int c = 0; c < cache_class_count; ++c) count[c] = 0;
+    CacheRegistry& registry = cache_registry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    registry.magazines.push_back(this);
+  }
+
+  // Move the top arg_n blocks of a magazine to the central list
+  void spill(const int arg_class, const int arg_n) {
+    CacheCentralList& central = cache_central_lists()[arg_class];
+    std::lock_guard<std::mutex> guard(central.lock);
+    central.blocks.insert(central.blocks.end(),
+                          blocks[arg_class] + count[arg_class] - arg_n,
+                          blocks[arg_class] + count[arg_class]);
+    count[arg_class] -= arg_n;
+  }
+
+  // Move up to half a magazine of blocks from the central list
+  void refill(const int arg_class) {
+    CacheCentralList& central = cache_central_lists()[arg_class];
+    std::lock_guard<std::mutex> guard(central.lock);
+    const int n =
+        std::min(int(central.blocks.size()), int(cache_magazine_batch));
+    std::copy(central.blocks.end() - n, central.blocks.end(),
+              blocks[arg_class] + count[arg_class]);
+    central.blocks.resize(central.blocks.size() - n);
+    count[arg_class] += n;
+  }
+
+  void spill_all() {
+    for (int c = 0; c < cache_class_count; ++c) {
+      if (count[c]) spill(c, count[c]);
+    }
+  }
+
+  ~CacheMagazines() {
+    CacheRegistry& registry = cache_registry();
+    std::lock_guard<std::mutex> registry_guard(registry.lock);
+    registry.magazines.erase(std::find(registry.magazines.begin(),
+                                       registry.magazines.end(), this));
+    std::lock_guard<std::mutex> guard(lock);
+    spill_all();
+  }
+};
+
+CacheMagazines& cache_magazines() {
+  static thread_local CacheMagazines magazines;
+  return magazines;
+}
+
+}  // namespace
+
+void host_space_cache_set_threshold(const size_t arg_threshold) {
+  g_cache_threshold = std::min(arg_threshold, host_space_cache_max_threshold);
+}
+
+size_t host_space_cache_threshold() { return g_cache_threshold; }
+
+void* host_space_cache_allocate(const size_t arg_alloc_size) {
+  const int c           = cache_class(arg_alloc_size);
+  CacheMagazines& local = cache_magazines();
+  std::lock_guard<std::mutex> guard(local.lock);
+
+  g_cache_allocations.fetch_add(1, std::memory_order_relaxed);
+
+  if (local.count[c] == 0) local.refill(c);
+
+  if (local.count[c] == 0) {
+    return cache_system_allocate(cache_class_size(c));
+  }
+
+  g_cache_hits.fetch_add(1, std::memory_order_relaxed);
+  g_cache_bytes.fetch_sub(cache_class_size(c), std::memory_order_relaxed);
+  return local.blocks[c][--local.count[c]];
+}
+
+void host_space_cache_deallocate(void* const arg_alloc_ptr,
+                                 const size_t arg_alloc_size) {
+  const int c           = cache_class(arg_alloc_size);
+  CacheMagazines& local = cache_magazines();
+  std::lock_guard<std::mutex> guard(local.lock);
+
+  g_cache_deallocations.fetch_add(1, std::memory_order_relaxed);
+  g_cache_bytes.fetch_add(cache_class_size(c), std::memory_order_relaxed);
+
+  if (local.count[c] == cache_magazine_size) {
+    local.spill(c, cache_magazine_batch);
+  }
+  local.blocks[c][local.count[c]++] = arg_alloc_ptr;
+}
+
+void host_space_cache_release() {
+  CacheRegistry& registry = cache_registry();
+  std::lock_guard<std::mutex> registry_guard(registry.lock);
+
+  for (CacheMagazines* magazines : registry.magazines) {
+    std::lock_guard<std::mutex> guard(magazines->lock);
+    magazines->spill_all();
+  }
+
+  for (int c = 0; c < cache_class_count; ++c) {
+    CacheCentralList& central = cache_central_lists()[c];
+    std::vector<void*> blocks;
+    {
+      std::lock_guard<std::mutex> guard(central.lock);
+      blocks.swap(central.blocks);
+    }
+    for (void* ptr : blocks) {
+      cache_system_deallocate(ptr);
+    }
+    g_cache_bytes.fetch_sub(blocks.size() * cache_class_size(c),
+                            std::memory_order_relaxed);
+  }
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+HostSpaceCacheStats host_space_cache_stats() {
+  HostSpaceCacheStats stats;
+  stats.threshold     = Kokkos::Impl::g_cache_threshold;
+  stats.allocations   = Kokkos::Impl::g_cache_allocations;
+  stats.hits          = Kokkos::Impl::g_cache_hits;
+  stats.deallocations = Kokkos::Impl::g_cache_deallocations;
+  stats.cached_bytes  = Kokkos::Impl::g_cache_bytes;
+  return stats;
+}
+
+}  // namespace Experimental
+
+}  // namespace Kokkos
@@ -0,0 +1,84 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_HOSTSPACE_CACHE_HPP
+#define KOKKOS_HOSTSPACE_CACHE_HPP
+
+#include <cstddef>
+
+namespace Kokkos {
+
+namespace Impl {
+
+/* Size class caching allocator for small HostSpace allocations.
+ *
+ * Allocations are rounded up to a power of two size class.  Freed blocks
+ * are kept in a per-thread magazine of each size class; full magazines
+ * spill half of their blocks into a central free list shared by all
+ * threads and empty magazines refill from it before falling back to the
+ * system allocator.  Blocks are only returned to the system by
+ * host_space_cache_release().
+ */
+
+// Largest threshold accepted by host_space_cache_set_threshold
+constexpr size_t host_space_cache_max_threshold = size_t(1) << 20;
+
+// Allocations of at most arg_threshold bytes are served by the cache of
+// HostSpace instances constructed afterwards, zero disables the cache.
+void host_space_cache_set_threshold(const size_t arg_threshold);
+size_t host_space_cache_threshold();
+
+void* host_space_cache_allocate(const size_t arg_alloc_size);
+void host_space_cache_deallocate(void* const arg_alloc_ptr,
+                                 const size_t arg_alloc_size);
+
+// Return the blocks of the central free lists and of the magazines of all
+// threads to the system.
+void host_space_cache_release();
+
+}  // namespace Impl
+
+}  // namespace Kokkos
+
+#endif  // KOKKOS_HOSTSPACE_CACHE_HPP
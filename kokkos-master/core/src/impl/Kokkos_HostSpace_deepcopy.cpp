@@ -45,6 +45,18 @@
 #include "Kokkos_Core.hpp"
 #include "Kokkos_HostSpace_deepcopy.hpp"
 
+// Non-temporal stores are selected at run time so that the library does
+// not need to be compiled for the widest instruction set it may use
+#if defined(__x86_64__) && !defined(__CUDACC__) && \
+    (defined(KOKKOS_COMPILER_GNU) || defined(KOKKOS_COMPILER_CLANG))
+#define KOKKOS_IMPL_HOST_STREAMING_STORES
+#include <immintrin.h>
+#endif
+
+#if defined(__unix__)
+#include <unistd.h>
+#endif
+
 namespace Kokkos {
 
 namespace Impl {
@@ -53,7 +65,238 @@ namespace Impl {
 #define KOKKOS_IMPL_HOST_DEEP_COPY_SERIAL_LIMIT 10 * 8192
 #endif
 
+namespace {
+
+// Streaming kernels write whole cache lines to line aligned destinations
+constexpr ptrdiff_t stream_line_size = 64;
+
+// Bytes handled by one iteration of the parallel streaming loops
+constexpr ptrdiff_t stream_chunk_size = ptrdiff_t(1) << 16;
+
+// Copy n bytes, n a multiple of the line size, to a line aligned dst
+using stream_copy_type = void (*)(char*, const char*, ptrdiff_t);
+
+// Replicate a line of bytes over n bytes, n a multiple of the line size,
+// of a line aligned dst
+using stream_fill_type = void (*)(char*, const char*, ptrdiff_t);
+
+#if defined(KOKKOS_IMPL_HOST_STREAMING_STORES)
+
+__attribute__((target("avx512f"))) void stream_copy_avx512(char* dst,
+                                                          const char* src,
+                                                          ptrdiff_t n) {
+  for (ptrdiff_t i = 0; i < n; i += stream_line_size) {
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(dst + i),
+                        _mm512_loadu_si512(src + i));
+  }
+  _mm_sfence();
+}
+
+__attribute__((target("avx512f"))) void stream_fill_avx512(char* dst,
+                                                          const char* line,
+                                                          ptrdiff_t n) {
+  const __m512i v = _mm512_loadu_si512(line);
+  for (ptrdiff_t i = 0; i < n; i += stream_line_size) {
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(dst + i), v);
+  }
+  _mm_sfence();
+}
+
+__attribute__((target("avx2"))) void stream_copy_avx2(char* dst,
+                                                     const char* src,
+                                                     ptrdiff_t n) {
+  for (ptrdiff_t i = 0; i < n; i += stream_line_size) {
+    const __m256i v0 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    const __m256i v1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 32));
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i), v0);
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i + 32), v1);
+  }
+  _mm_sfence();
+}
+
+__attribute__((target("avx2"))) void stream_fill_avx2(char* dst,
+                                                     const char* line,
+                                                     ptrdiff_t n) {
+  const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(line));
+  const __m256i v1 =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(line + 32));
+  for (ptrdiff_t i = 0; i < n; i += stream_line_size) {
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i), v0);
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i + 32), v1);
+  }
+  _mm_sfence();
+}
+
+// SSE2 is part of the x86_64 baseline
+void stream_copy_sse2(char* dst, const char* src, ptrdiff_t n) {
+  for (ptrdiff_t i = 0; i < n; i += 16) {
+    _mm_stream_si128(
+        reinterpret_cast<__m128i*>(dst + i),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+  }
+  _mm_sfence();
+}
+
+void stream_fill_sse2(char* dst, const char* line, ptrdiff_t n) {
+  __m128i v[4];
+  for (int j = 0; j < 4; ++j) {
+    v[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(line + 16 * j));
+  }
+  for (ptrdiff_t i = 0; i < n; i += stream_line_size) {
+    for (int j = 0; j < 4; ++j) {
+      _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 16 * j), v[j]);
+    }
+  }
+  _mm_sfence();
+}
+
+#else
+
+void stream_copy_scalar(char* dst, const char* src, ptrdiff_t n) {
+  std::memcpy(dst, src, n);
+}
+
+void stream_fill_scalar(char* dst, const char* line, ptrdiff_t n) {
+  for (ptrdiff_t i = 0; i < n; i += stream_line_size) {
+    std::memcpy(dst + i, line, stream_line_size);
+  }
+}
+
+#endif
+
+struct StreamKernels {
+  stream_copy_type copy;
+  stream_fill_type fill;
+};
+
+const StreamKernels& stream_kernels() {
+  static const StreamKernels kernels = []() {
+#if defined(KOKKOS_IMPL_HOST_STREAMING_STORES)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      return StreamKernels{stream_copy_avx512, stream_fill_avx512};
+    }
+    if (__builtin_cpu_supports("avx2")) {
+      return StreamKernels{stream_copy_avx2, stream_fill_avx2};
+    }
+    return StreamKernels{stream_copy_sse2, stream_fill_sse2};
+#else
+    return StreamKernels{stream_copy_scalar, stream_fill_scalar};
+#endif
+  }();
+  return kernels;
+}
+
+// Apply f to consecutive chunks of [0, n) in parallel on the host pool
+template <class Functor>
+void stream_parallel(const ptrdiff_t n, const Functor& f) {
+  const ptrdiff_t num_chunks = (n + stream_chunk_size - 1) / stream_chunk_size;
+
+  if ((num_chunks < 2) || !Kokkos::is_initialized() ||
+      (Kokkos::DefaultHostExecutionSpace().concurrency() == 1) ||
+      Kokkos::DefaultHostExecutionSpace::in_parallel()) {
+    f(0, n);
+    return;
+  }
+
+  using policy_t = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+
+  Kokkos::parallel_for("Kokkos::Impl::host_space_stream",
+                       policy_t(0, num_chunks), [=](const ptrdiff_t i) {
+                         const ptrdiff_t begin = i * stream_chunk_size;
+                         f(begin, std::min(stream_chunk_size, n - begin));
+                       });
+  Kokkos::DefaultHostExecutionSpace().fence();
+}
+
+// Bytes before the first line aligned address of [ptr, ptr + n)
+ptrdiff_t stream_head(const void* ptr, const ptrdiff_t n) {
+  const ptrdiff_t rem = reinterpret_cast<uintptr_t>(ptr) % stream_line_size;
+  return std::min(rem ? stream_line_size - rem : ptrdiff_t(0), n);
+}
+
+}  // namespace
+
+ptrdiff_t hostspace_streaming_limit() {
+  static const ptrdiff_t limit = []() {
+#if defined(KOKKOS_IMPL_HOST_DEEP_COPY_STREAMING_LIMIT)
+    return ptrdiff_t(KOKKOS_IMPL_HOST_DEEP_COPY_STREAMING_LIMIT);
+#else
+    // Beyond the last level cache the destination is evicted before it
+    // is read again anyway
+    long llc = 0;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+    llc = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+    return std::max(ptrdiff_t(llc), ptrdiff_t(1) << 25);
+#endif
+  }();
+  return limit;
+}
+
+void hostspace_stream_copy(void* dst, const void* src, ptrdiff_t n,
+                           bool use_pool) {
+  char* dst_c       = reinterpret_cast<char*>(dst);
+  const char* src_c = reinterpret_cast<const char*>(src);
+
+  const ptrdiff_t head = stream_head(dst, n);
+  const ptrdiff_t body = (n - head) / stream_line_size * stream_line_size;
+
+  std::memcpy(dst_c, src_c, head);
+
+  const stream_copy_type copy = stream_kernels().copy;
+  char* const dst_body        = dst_c + head;
+  const char* const src_body  = src_c + head;
+  if (use_pool) {
+    stream_parallel(body, [=](const ptrdiff_t begin, const ptrdiff_t count) {
+      copy(dst_body + begin, src_body + begin, count);
+    });
+  } else {
+    copy(dst_body, src_body, body);
+  }
+
+  std::memcpy(dst_c + head + body, src_c + head + body, n - head - body);
+}
+
+void hostspace_stream_fill(void* dst, const void* value, size_t value_size,
+                           ptrdiff_t n) {
+  char* dst_c         = reinterpret_cast<char*>(dst);
+  const char* value_c = reinterpret_cast<const char*>(value);
+  const ptrdiff_t vs  = value_size;
+
+  const ptrdiff_t head = stream_head(dst, n);
+  const ptrdiff_t body = (n - head) / stream_line_size * stream_line_size;
+
+  // Byte i of the destination is byte i % value_size of the value, every
+  // aligned line has the same content since value_size divides its size.
+  char line[stream_line_size];
+  for (ptrdiff_t i = 0; i < stream_line_size; ++i) {
+    line[i] = value_c[(head + i) % vs];
+  }
+  for (ptrdiff_t i = 0; i < head; ++i) {
+    dst_c[i] = value_c[i % vs];
+  }
+
+  const stream_fill_type fill = stream_kernels().fill;
+  char* const dst_body        = dst_c + head;
+  const char* const line_c    = line;
+  stream_parallel(body, [=](const ptrdiff_t begin, const ptrdiff_t count) {
+    fill(dst_body + begin, line_c, count);
+  });
+
+  for (ptrdiff_t i = head + body; i < n; ++i) {
+    dst_c[i] = value_c[i % vs];
+  }
+}
+
 void hostspace_parallel_deepcopy(void* dst, const void* src, ptrdiff_t n) {
+  if (n >= hostspace_streaming_limit()) {
+    hostspace_stream_copy(dst, src, n);
+    return;
+  }
+
   if ((n < KOKKOS_IMPL_HOST_DEEP_COPY_SERIAL_LIMIT) ||
       (Kokkos::DefaultHostExecutionSpace().concurrency() == 1)) {
     std::memcpy(dst, src, n);
@@ -138,6 +381,38 @@ void hostspace_parallel_deepcopy(void* dst, const void* src, ptrdiff_t n) {
   }
 }
 
+void hostspace_parallel_first_touch(void* ptr, ptrdiff_t n) {
+  // Too small to span pages of several threads, or no pool to touch with
+  if ((n < KOKKOS_IMPL_HOST_DEEP_COPY_SERIAL_LIMIT) ||
+      !Kokkos::is_initialized() ||
+      (Kokkos::DefaultHostExecutionSpace().concurrency() == 1) ||
+      Kokkos::DefaultHostExecutionSpace::in_parallel()) {
+    return;
+  }
+
+  using policy_t =
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace,
+                          Kokkos::Schedule<Kokkos::Static>>;
+
+  constexpr ptrdiff_t page_size = 4096;
+
+  // Spread the pages the way a static schedule spreads the View's elements
+  char* const ptr_c = reinterpret_cast<char*>(ptr);
+  const ptrdiff_t concurrency =
+      Kokkos::DefaultHostExecutionSpace().concurrency();
+  const ptrdiff_t num_pages    = (n + page_size - 1) / page_size;
+  const ptrdiff_t thread_pages = (num_pages + concurrency - 1) / concurrency;
+  Kokkos::parallel_for(
+      "Kokkos::Impl::host_space_first_touch", policy_t(0, concurrency),
+      [=](const ptrdiff_t t) {
+        const ptrdiff_t end = std::min((t + 1) * thread_pages, num_pages);
+        for (ptrdiff_t p = t * thread_pages; p < end; ++p) {
+          ptr_c[p * page_size] = 0;
+        }
+      });
+  Kokkos::DefaultHostExecutionSpace().fence();
+}
+
 }  // namespace Impl
 
 }  // namespace Kokkos
@@ -41,6 +41,9 @@
 // ************************************************************************
 //@HEADER
 */
+#ifndef KOKKOS_IMPL_HOSTSPACE_DEEPCOPY_HPP
+#define KOKKOS_IMPL_HOSTSPACE_DEEPCOPY_HPP
+
 #include <cstdint>
 
 namespace Kokkos {
@@ -49,6 +52,26 @@ namespace Impl {
 
 void hostspace_parallel_deepcopy(void* dst, const void* src, ptrdiff_t n);
 
+// Copies and fills of at least this many bytes bypass the caches with
+// non-temporal stores, see hostspace_stream_copy / hostspace_stream_fill.
+ptrdiff_t hostspace_streaming_limit();
+
+// Copy n bytes with non-temporal stores, using the widest instruction set
+// available at run time and, if use_pool, the host thread pool.
+void hostspace_stream_copy(void* dst, const void* src, ptrdiff_t n,
+                           bool use_pool = true);
+
+// Fill n bytes with copies of a value of value_size bytes, value_size must
+// divide 64.
+void hostspace_stream_fill(void* dst, const void* value, size_t value_size,
+                           ptrdiff_t n);
+
+// Touch every page of [ ptr , ptr + n ) from the host thread pool with a
+// static schedule so that first touch places pages near their users.
+void hostspace_parallel_first_touch(void* ptr, ptrdiff_t n);
+
 }  // namespace Impl
 
 }  // namespace Kokkos
+
+#endif  // KOKKOS_IMPL_HOSTSPACE_DEEPCOPY_HPP
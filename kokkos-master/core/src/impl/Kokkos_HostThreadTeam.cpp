@@ -47,6 +47,9 @@
 #include <impl/Kokkos_HostThreadTeam.hpp>
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_Spinwait.hpp>
+#include <Kokkos_hwloc.hpp>
+
+#include <cmath>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -54,6 +57,37 @@
 namespace Kokkos {
 namespace Impl {
 
+namespace {
+
+int g_pool_group_size = -1;
+
+int host_pool_group_size(const int size) {
+  const int numa_count = Kokkos::hwloc::get_available_numa_count();
+  const int numa_size  = Kokkos::hwloc::get_available_cores_per_numa() *
+                        Kokkos::hwloc::get_available_threads_per_core();
+
+  int group = g_pool_group_size;
+
+  if (group <= 0) {
+    if (1 < numa_count && numa_size < size) {
+      group = numa_size;
+    } else if (group < 0) {
+      group = 1;
+    } else {
+      // Two levels of about sqrt(size) threads each
+      group = int(std::ceil(std::sqrt(double(size))));
+    }
+  }
+
+  return group < size ? group : size;
+}
+
+}  // namespace
+
+void host_thread_team_set_pool_group(const int arg_group_size) {
+  g_pool_group_size = arg_group_size;
+}
+
 void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
                                        const int size) {
   bool ok = true;
@@ -73,6 +107,16 @@ void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
       root_scratch[i] = 0;
     }
 
+    const int group_size  = host_pool_group_size(size);
+    const int group_count = (size + group_size - 1) / group_size;
+
+    // Each group leader holds the rendezvous of its group
+    for (int base = group_size; base < size; base += group_size) {
+      for (int i = m_pool_rendezvous; i < m_team_rendezvous; ++i) {
+        members[base]->m_scratch[i] = 0;
+      }
+    }
+
     {
       HostThreadTeamData **const pool =
           (HostThreadTeamData **)(root_scratch + m_pool_members);
@@ -80,19 +124,29 @@ void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
       // team size == 1, league size == pool_size
 
       for (int rank = 0; rank < size; ++rank) {
-        HostThreadTeamData *const mem = members[rank];
-        mem->m_pool_scratch           = root_scratch;
-        mem->m_team_scratch           = mem->m_scratch;
-        mem->m_pool_rank              = rank;
-        mem->m_pool_size              = size;
-        mem->m_team_base              = rank;
-        mem->m_team_rank              = 0;
-        mem->m_team_size              = 1;
-        mem->m_team_alloc             = 1;
-        mem->m_league_rank            = rank;
-        mem->m_league_size            = size;
-        mem->m_team_rendezvous_step   = 0;
-        pool[rank]                    = mem;
+        HostThreadTeamData *const mem   = members[rank];
+        const int group_base            = rank - rank % group_size;
+        mem->m_pool_scratch             = root_scratch;
+        mem->m_team_scratch             = mem->m_scratch;
+        mem->m_group_scratch            = members[group_base]->m_scratch;
+        mem->m_pool_rank                = rank;
+        mem->m_pool_size                = size;
+        mem->m_group_base               = group_base;
+        mem->m_group_size               = group_base + group_size <= size
+                                              ? group_size
+                                              : size - group_base;
+        mem->m_group_stride             = group_size;
+        mem->m_group_count              = group_count;
+        mem->m_team_base                = rank;
+        mem->m_team_rank                = 0;
+        mem->m_team_size                = 1;
+        mem->m_team_alloc               = 1;
+        mem->m_league_rank              = rank;
+        mem->m_league_size              = size;
+        mem->m_pool_rendezvous_step     = 0;
+        mem->m_pool_rendezvous_top_step = 0;
+        mem->m_team_rendezvous_step     = 0;
+        pool[rank]                      = mem;
       }
     }
 
@@ -109,8 +163,13 @@ void HostThreadTeamData::disband_pool() {
   m_work_range.second    = -1;
   m_pool_scratch         = nullptr;
   m_team_scratch         = nullptr;
+  m_group_scratch        = nullptr;
   m_pool_rank            = 0;
   m_pool_size            = 1;
+  m_group_base           = 0;
+  m_group_size           = 1;
+  m_group_stride         = 1;
+  m_group_count          = 1;
   m_team_base            = 0;
   m_team_rank            = 0;
   m_team_size            = 1;
@@ -307,5 +366,79 @@ fflush(stdout);
   return w.first;
 }
 
+//----------------------------------------------------------------------------
+
+int HostThreadTeamData::pop_work_deque() noexcept {
+  // Only thieves compete with the owner, so this rarely loops
+  for (int64_t w = *((int64_t volatile *)&m_work_deque);;) {
+    const int begin = work_deque_begin(w);
+    const int end   = work_deque_end(w);
+
+    if (end <= begin) return -1;
+
+    const int64_t w_new = pack_work_deque(begin + 1, end);
+    const int64_t w_old =
+        Kokkos::atomic_compare_exchange(&m_work_deque, w, w_new);
+
+    if (w_old == w) return begin;
+
+    w = w_old;
+  }
+}
+
+int HostThreadTeamData::steal_work_deque() noexcept {
+  HostThreadTeamData *const *const pool =
+      (HostThreadTeamData **)(m_pool_scratch + m_pool_members);
+
+  // xorshift: spread thieves over the pool instead of all of them
+  // hammering the next rank
+  m_steal_seed ^= m_steal_seed << 13;
+  m_steal_seed ^= m_steal_seed >> 17;
+  m_steal_seed ^= m_steal_seed << 5;
+
+  const int offset = int(m_steal_seed % uint32_t(m_pool_size));
+
+  for (int n = 0; n < m_pool_size; ++n) {
+    const int victim = (offset + n) % m_pool_size;
+
+    if (victim == m_pool_rank) continue;
+
+    int64_t *const deque = &(pool[victim]->m_work_deque);
+
+    for (int64_t w = *((int64_t volatile *)deque);;) {
+      const int begin = work_deque_begin(w);
+      const int end   = work_deque_end(w);
+
+      if (end <= begin) break;
+
+      // Take the back half, leaving the front to the owner
+      const int split = end - (end - begin + 1) / 2;
+
+      const int64_t w_new = pack_work_deque(begin, split);
+      const int64_t w_old = Kokkos::atomic_compare_exchange(deque, w, w_new);
+
+      if (w_old == w) {
+        // Keep what is left of the stolen range in my own (empty) deque,
+        // where other thieves may find it in turn.
+        if (split + 1 < end) {
+          Kokkos::atomic_exchange(&m_work_deque,
+                                  pack_work_deque(split + 1, end));
+        }
+        return split;
+      }
+
+      w = w_old;
+    }
+  }
+
+  return -1;
+}
+
+int HostThreadTeamData::get_work_deque() noexcept {
+  const int i = pop_work_deque();
+
+  return 0 <= i ? i : (1 < m_pool_size ? steal_work_deque() : -1);
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
@@ -95,15 +95,27 @@ class HostThreadTeamData {
   enum : int { m_team_rendezvous = m_pool_rendezvous + max_pool_rendezvous };
   enum : int { m_pool_reduce = m_team_rendezvous + max_team_rendezvous };
 
+  // The pool rendezvous chunk holds two barriers a few cache lines apart:
+  // one for the group led by this thread and, on the root, one for the
+  // group leaders.
+  enum : int {
+    m_pool_rendezvous_top = m_pool_rendezvous + max_pool_rendezvous / 2
+  };
   using pair_int_t = Kokkos::pair<int64_t, int64_t>;
 
   pair_int_t m_work_range;
   int64_t m_work_end;
-  int64_t* m_scratch;       // per-thread buffer
-  int64_t* m_pool_scratch;  // == pool[0]->m_scratch
-  int64_t* m_team_scratch;  // == pool[ 0 + m_team_base ]->m_scratch
+  int64_t m_work_deque;      // work stealing deque [ begin .. end ) packed
+  int64_t* m_scratch;        // per-thread buffer
+  int64_t* m_pool_scratch;   // == pool[0]->m_scratch
+  int64_t* m_team_scratch;   // == pool[ 0 + m_team_base ]->m_scratch
+  int64_t* m_group_scratch;  // == pool[ 0 + m_group_base ]->m_scratch
   int m_pool_rank;
   int m_pool_size;
+  int m_group_base;    // pool rank of the leader of this thread's group
+  int m_group_size;    // number of threads in this thread's group
+  int m_group_stride;  // threads per group, the last group may be smaller
+  int m_group_count;   // number of groups in the pool
   int m_team_reduce;
   int m_team_shared;
   int m_thread_local;
@@ -115,8 +127,10 @@ class HostThreadTeamData {
   int m_league_rank;
   int m_league_size;
   int m_work_chunk;
-  int m_steal_rank;  // work stealing rank
+  int m_steal_rank;        // work stealing rank
+  uint32_t m_steal_seed;  // work stealing deque victim selection
   int mutable m_pool_rendezvous_step;
+  int mutable m_pool_rendezvous_top_step;
   int mutable m_team_rendezvous_step;
 
   HostThreadTeamData* team_member(int r) const noexcept {
@@ -154,21 +168,59 @@ class HostThreadTeamData {
                                m_team_size, m_team_rendezvous_step);
   }
 
+  // The pool rendezvous is a two level tree: threads first meet their
+  // group leader, then the group leaders meet the root. With groups of
+  // one thread (the flat barrier) the first level is a no-op.
   inline int pool_rendezvous() const noexcept {
-    int* ptr = (int*)(m_pool_scratch + m_pool_rendezvous);
-    HostBarrier::split_arrive(ptr, m_pool_size, m_pool_rendezvous_step);
+    int* group = (int*)(m_group_scratch + m_pool_rendezvous);
+    HostBarrier::split_arrive(group, m_group_size, m_pool_rendezvous_step);
+    if (m_pool_rank != m_group_base) {
+      HostBarrier::wait(group, m_group_size, m_pool_rendezvous_step);
+      return false;
+    }
+    HostBarrier::split_master_wait(group, m_group_size,
+                                   m_pool_rendezvous_step);
+
+    int* top = (int*)(m_pool_scratch + m_pool_rendezvous_top);
+    HostBarrier::split_arrive(top, m_group_count, m_pool_rendezvous_top_step);
     if (m_pool_rank != 0) {
-      HostBarrier::wait(ptr, m_pool_size, m_pool_rendezvous_step);
-    } else {
-      HostBarrier::split_master_wait(ptr, m_pool_size, m_pool_rendezvous_step);
+      HostBarrier::wait(top, m_group_count, m_pool_rendezvous_top_step);
+      HostBarrier::split_release(group, m_group_size, m_pool_rendezvous_step);
+      return false;
     }
+    HostBarrier::split_master_wait(top, m_group_count,
+                                   m_pool_rendezvous_top_step);
 
-    return m_pool_rank == 0;
+    return true;
   }
 
   inline void pool_rendezvous_release() const noexcept {
-    HostBarrier::split_release((int*)(m_pool_scratch + m_pool_rendezvous),
-                               m_pool_size, m_pool_rendezvous_step);
+    HostBarrier::split_release((int*)(m_pool_scratch + m_pool_rendezvous_top),
+                               m_group_count, m_pool_rendezvous_top_step);
+    HostBarrier::split_release((int*)(m_group_scratch + m_pool_rendezvous),
+                               m_group_size, m_pool_rendezvous_step);
+  }
+
+  // Join the pool_reduce_local() values of a group into its leader's.
+  // Must be called by all threads of the pool at the end of a reduction,
+  // before leaving the parallel region; the root then joins the values of
+  // the group leaders, pool ranks 0, pool_group_size(), 2*pool_group_size()
+  // and so on. Threads other than the group leaders do not wait: the end
+  // of the parallel region keeps them from touching their value again.
+  template <class Join>
+  inline void pool_reduce_group(const Join& join) const noexcept {
+    if (m_group_size <= 1) return;
+    int* group = (int*)(m_group_scratch + m_pool_rendezvous);
+    HostBarrier::split_arrive(group, m_group_size, m_pool_rendezvous_step);
+    if (m_pool_rank == m_group_base) {
+      HostBarrier::split_master_wait(group, m_group_size,
+                                     m_pool_rendezvous_step);
+      for (int r = 1; r < m_group_size; ++r) {
+        join(pool_reduce_local(),
+             pool_member(m_group_base + r)->pool_reduce_local());
+      }
+      HostBarrier::split_release(group, m_group_size, m_pool_rendezvous_step);
+    }
   }
 
   //----------------------------------------
@@ -176,11 +228,17 @@ class HostThreadTeamData {
   constexpr HostThreadTeamData() noexcept
       : m_work_range(-1, -1),
         m_work_end(0),
+        m_work_deque(0),
         m_scratch(nullptr),
         m_pool_scratch(nullptr),
         m_team_scratch(nullptr),
+        m_group_scratch(nullptr),
         m_pool_rank(0),
         m_pool_size(1),
+        m_group_base(0),
+        m_group_size(1),
+        m_group_stride(1),
+        m_group_count(1),
         m_team_reduce(0),
         m_team_shared(0),
         m_thread_local(0),
@@ -193,7 +251,9 @@ class HostThreadTeamData {
         m_league_size(1),
         m_work_chunk(0),
         m_steal_rank(0),
+        m_steal_seed(0),
         m_pool_rendezvous_step(0),
+        m_pool_rendezvous_top_step(0),
         m_team_rendezvous_step(0) {}
 
   //----------------------------------------
@@ -203,6 +263,8 @@ class HostThreadTeamData {
   // Requires: called by one thread.
   // Pool members are ordered as "close" - sorted by NUMA and then CORE
   // Each thread is its own team with team_size == 1.
+  // Consecutive members are grouped for the pool rendezvous and pool
+  // reductions, see host_thread_team_set_pool_group.
   static void organize_pool(HostThreadTeamData* members[], const int size);
 
   // Called by each thread within the pool
@@ -229,19 +291,30 @@ class HostThreadTeamData {
   constexpr int pool_rank() const { return m_pool_rank; }
   constexpr int pool_size() const { return m_pool_size; }
 
+  // Number of threads per group of the pool, 1 for a flat pool
+  constexpr int pool_group_size() const { return m_group_stride; }
+
   HostThreadTeamData* pool_member(int r) const noexcept {
     return ((HostThreadTeamData**)(m_pool_scratch + m_pool_members))[r];
   }
 
   //----------------------------------------
 
+  // Scratch chunks start on this boundary so that reduction values as wide
+  // as the widest host SIMD register (AVX-512) can be stored in place.
+  enum : int { max_reduce_alignment = 64 };
+
  private:
-  enum : int { mask_to_16 = 0x0f };  // align to 16 bytes
-  enum : int { shift_to_8 = 3 };     // size to 8 bytes
+  enum : int { mask_to_64 = max_reduce_alignment - 1 };  // align to 64 bytes
+  enum : int { shift_to_8 = 3 };                         // size to 8 bytes
+
+  static_assert((sizeof(int64_t) * m_pool_reduce) % max_reduce_alignment ==
+                    0,
+                "HostThreadTeamData reduce scratch must stay aligned");
 
  public:
   static constexpr int align_to_int64(int n) {
-    return ((n + mask_to_16) & ~mask_to_16) >> shift_to_8;
+    return ((n + mask_to_64) & ~mask_to_64) >> shift_to_8;
   }
 
   constexpr int pool_reduce_bytes() const {
@@ -356,6 +429,30 @@ fflush(stdout);
   // If that fails then try to steal from end of another teams' partition.
   int get_work_stealing() noexcept;
 
+  //----------------------------------------
+  // Chase-Lev style work stealing for pools of teams of one thread.
+  // Each thread owns a deque of chunk indices, initialized with its
+  // partition. The owner takes chunks one at a time from the front while
+  // thieves, visiting victims in pseudo-random order, take the back half
+  // of a victim's remaining chunks and continue from there.
+  //
+  // Return a work index or -1 if no work is left.
+  int get_work_deque() noexcept;
+
+ private:
+  static constexpr int64_t pack_work_deque(int64_t begin, int64_t end) {
+    return (begin << 32) | end;
+  }
+  static constexpr int work_deque_begin(int64_t w) { return int(w >> 32); }
+  static constexpr int work_deque_end(int64_t w) {
+    return int(w & 0xffffffff);
+  }
+
+  int pop_work_deque() noexcept;
+  int steal_work_deque() noexcept;
+
+ public:
+
   //----------------------------------------
   // Set the initial work partitioning of [ 0 .. length ) among the teams
   // with granularity of chunk
@@ -377,6 +474,10 @@ fflush(stdout);
     m_work_range.first  = part * m_league_rank;
     m_work_range.second = m_work_range.first + part;
 
+    m_work_deque = pack_work_deque(std::min(m_work_range.first, int64_t(num)),
+                                   std::min(m_work_range.second, int64_t(num)));
+    m_steal_seed = 2654435761u * uint32_t(m_pool_rank + 1);
+
     // Steal from next team, round robin
     // The next team is offset by m_team_alloc if it fits in the pool.
 
@@ -407,8 +508,29 @@ fflush(stdout);
 
     return x;
   }
+
+  std::pair<int64_t, int64_t> get_work_deque_chunk() noexcept {
+    std::pair<int64_t, int64_t> x(-1, -1);
+
+    const int i = get_work_deque();
+
+    if (0 <= i) {
+      x.first  = m_work_chunk * i;
+      x.second = x.first + m_work_chunk < m_work_end ? x.first + m_work_chunk
+                                                     : m_work_end;
+    }
+
+    return x;
+  }
 };
 
+// Number of consecutive pool members per group in pools organized from now
+// on: 1 gives the flat pool barrier and reduction, 0 groups the threads of
+// each NUMA domain (or about sqrt(pool size) threads without hwloc) and a
+// negative value, the default, groups by NUMA domain on multi-domain nodes
+// and is flat otherwise.
+void host_thread_team_set_pool_group(const int arg_group_size);
+
 //----------------------------------------------------------------------------
 
 template <class HostExecSpace>
@@ -62,6 +62,7 @@
 #include <impl/Kokkos_Atomic_Increment.hpp>
 #include <impl/Kokkos_OptionalRef.hpp>
 #include <impl/Kokkos_LIFO.hpp>
+#include <impl/Kokkos_Profiling_TaskTrace.hpp>
 
 #include <string>
 #include <typeinfo>
@@ -88,6 +89,37 @@ struct FailedQueueInsertionLinkedListSchedulingInfo {
 
 struct EmptyTaskSchedulingInfo {};
 
+// Forwards pushes to a team's ready queue, except for the first one, which is
+// kept aside as the continuation of the task that the team just completed
+// unless a task of higher priority is already waiting in the team's queues
+template <class ReadyQueueType, class TaskBaseType>
+struct ContinuationCapturingReadyQueue {
+  ReadyQueueType& m_ready_queue;
+  TaskBaseType*& m_continuation;
+  bool m_may_capture;
+
+  KOKKOS_INLINE_FUNCTION
+  bool push(TaskBaseType& task) {
+    if (m_may_capture && m_continuation == nullptr) {
+      m_continuation = &task;
+      return true;
+    }
+    return m_ready_queue.push(task);
+  }
+};
+
+// The team that an idle team tries to steal from at its i-th attempt, for i
+// in [1, n_teams): nearest first, alternating between the two neighbors at
+// each distance, since adjacent team ranks are usually bound to cores that
+// share a cache
+KOKKOS_INLINE_FUNCTION
+int32_t multiple_task_queue_steal_victim(int32_t team, int32_t i,
+                                         int32_t n_teams) {
+  auto const distance = (i + 1) / 2;
+  return (i % 2 == 1) ? (team + distance) % n_teams
+                      : (team + n_teams - distance) % n_teams;
+}
+
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
@@ -116,6 +148,11 @@ struct MultipleTaskQueueTeamEntry {
 
   task_base_type* m_failed_heads[NumPriorities][2];
 
+  // A successor made ready by the task this team just completed.  Only the
+  // team that owns this entry touches these, so no synchronization is needed
+  task_base_type* m_continuation = nullptr;
+  bool m_accepts_continuation    = false;
+
   KOKKOS_INLINE_FUNCTION
   task_base_type*& failed_head_for(runnable_task_base_type const& task) {
     return m_failed_heads[int(task.get_priority())][int(task.get_task_type())];
@@ -177,8 +214,36 @@ struct MultipleTaskQueueTeamEntry {
   }
 
   KOKKOS_INLINE_FUNCTION
-  OptionalRef<task_base_type> pop_ready_task() {
+  void accept_continuation(bool value) { m_accepts_continuation = value; }
+
+  // Highest priority (lowest value) of the tasks waiting in this team's
+  // queues, or NumPriorities if there are none
+  KOKKOS_INLINE_FUNCTION
+  int ready_head_priority() const {
+    for (int i_priority = 0; i_priority < NumPriorities; ++i_priority) {
+      for (int i_type = 0; i_type < 2; ++i_type) {
+        if (m_failed_heads[i_priority][i_type] != nullptr ||
+            !m_ready_queues[i_priority][i_type].empty()) {
+          return i_priority;
+        }
+      }
+    }
+    return NumPriorities;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  OptionalRef<task_base_type> pop_ready_task(bool& is_continuation) {
     auto return_value = OptionalRef<task_base_type>{};
+    // Run the continuation first, its data is most likely still in cache,
+    // unless a task of higher priority became ready after it was captured
+    is_continuation = m_continuation != nullptr &&
+                      int(m_continuation->get_priority()) <=
+                          ready_head_priority();
+    if (is_continuation) {
+      return_value   = OptionalRef<task_base_type>{*m_continuation};
+      m_continuation = nullptr;
+      return return_value;
+    }
     for (int i_priority = 0; i_priority < NumPriorities; ++i_priority) {
       return_value = _pop_failed_insertion(i_priority, TaskTeam);
       if (!return_value)
@@ -191,6 +256,12 @@ struct MultipleTaskQueueTeamEntry {
         return_value = m_ready_queues[i_priority][TaskSingle].pop();
       if (return_value) return return_value;
     }
+    // The higher priority tasks were stolen in the meantime
+    if (m_continuation != nullptr) {
+      is_continuation = true;
+      return_value    = OptionalRef<task_base_type>{*m_continuation};
+      m_continuation  = nullptr;
+    }
     return return_value;
   }
 
@@ -285,7 +356,14 @@ struct MultipleTaskQueueTeamEntry {
     auto task_type   = task.get_task_type();
 
     // First schedule the task
-    queue.schedule_runnable_to_queue(std::move(task), team_queue, info);
+    if (m_accepts_continuation) {
+      ContinuationCapturingReadyQueue<ready_queue_type, task_base_type>
+          capturing_queue{team_queue, m_continuation,
+                          int(priority) <= ready_head_priority()};
+      queue.schedule_runnable_to_queue(std::move(task), capturing_queue, info);
+    } else {
+      queue.schedule_runnable_to_queue(std::move(task), team_queue, info);
+    }
 
     // Task may be enqueued and may be run at any point; don't touch it (hence
     // the use of move semantics)
@@ -374,6 +452,11 @@ class MultipleTaskQueue final
   // Number of allowed priorities
   static constexpr int NumPriorities = 3;
 
+  // Host teams run a successor made ready by a completed task right away
+  // instead of pushing it where any other team could steal it
+  static constexpr bool passes_continuations =
+      Kokkos::SpaceAccessibility<ExecSpace, Kokkos::HostSpace>::accessible;
+
   KOKKOS_INLINE_FUNCTION
   constexpr typename vla_emulation_base_t::vla_entry_count_type n_queues() const
       noexcept {
@@ -436,25 +519,55 @@ class MultipleTaskQueue final
       team_queue_info.flush_all_failed_insertions();
     }
 
-    return_value = team_queue_info.pop_ready_task();
+    bool is_continuation = false;
+    return_value         = team_queue_info.pop_ready_task(is_continuation);
+    uint32_t trace_flags =
+        is_continuation ? Kokkos::Tools::Impl::task_trace_continuation : 0;
 
     if (!return_value) {
-      // loop through the rest of the teams and try to steal
-      for (auto isteal = (team_association + 1) % this->n_queues();
-           isteal != team_association;
-           isteal = (isteal + 1) % this->n_queues()) {
+      // loop through the rest of the teams and try to steal, nearest first
+      auto const n_queues = int32_t(this->n_queues());
+      for (int32_t i = 1; i < n_queues; ++i) {
+        auto const isteal =
+            multiple_task_queue_steal_victim(team_association, i, n_queues);
         return_value = this->vla_value_at(isteal).try_to_steal_ready_task();
         if (return_value) {
+          trace_flags = Kokkos::Tools::Impl::task_trace_stolen;
           break;
         }
       }
 
       // Note that this is where we'd update the task's scheduling info
     }
+    if (return_value) {
+      Kokkos::Tools::Impl::task_trace_event(
+          Kokkos::Tools::Impl::TaskTraceEvent::start, &*return_value,
+          trace_flags);
+    }
     // if nothing was found, return a default-constructed (empty) OptionalRef
     return return_value;
   }
 
+  using common_mixin_t::complete;
+
+  KOKKOS_FUNCTION
+  void complete(runnable_task_base_type&& task,
+                team_scheduler_info_type const& info) {
+    // A respawned task is not finished, and running it again right away could
+    // starve the tasks it is waiting for when there is a single team
+    bool const pass_continuation =
+        passes_continuations && !task.get_respawn_flag() &&
+        info.team_association != team_scheduler_info_type::NoAssociatedTeam;
+    if (pass_continuation) {
+      auto& team_queue_info = this->vla_value_at(info.team_association);
+      team_queue_info.accept_continuation(true);
+      common_mixin_t::complete(std::move(task), info);
+      team_queue_info.accept_continuation(false);
+    } else {
+      common_mixin_t::complete(std::move(task), info);
+    }
+  }
+
   // TODO @tasking @generalization DSH make this a property-based customization
   // point
   KOKKOS_INLINE_FUNCTION
@@ -513,9 +626,9 @@ class MultipleTaskQueue final
     // Do nothing; we're using the extra storage for the failure linked list
   }
 
-  KOKKOS_INLINE_FUNCTION
-  void handle_failed_ready_queue_insertion(
-      runnable_task_base_type&& task, ready_queue_type&,
+  template <class ReadyQueueType>
+  KOKKOS_INLINE_FUNCTION void handle_failed_ready_queue_insertion(
+      runnable_task_base_type&& task, ReadyQueueType&,
       team_scheduler_info_type const& info) {
     KOKKOS_EXPECTS(info.team_association !=
                    team_scheduler_info_type::NoAssociatedTeam);
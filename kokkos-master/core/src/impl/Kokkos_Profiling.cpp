@@ -45,6 +45,10 @@
 #include <Kokkos_Macros.hpp>
 #include <Kokkos_Tuners.hpp>
 #include <impl/Kokkos_Profiling.hpp>
+#include <impl/Kokkos_Profiling_Counters.hpp>
+#include <impl/Kokkos_Profiling_Tuner.hpp>
+#include <impl/Kokkos_Profiling_TuningCache.hpp>
+#include <impl/Kokkos_Profiling_TaskTrace.hpp>
 #if defined(KOKKOS_ENABLE_LIBDL)
 #include <dlfcn.h>
 #endif
@@ -61,6 +65,10 @@ namespace Kokkos {
 
 namespace Tools {
 
+namespace Impl {
+bool g_profile_library_loaded = false;
+}  // namespace Impl
+
 namespace Experimental {
 #ifdef KOKKOS_ENABLE_TUNING
 static size_t kernel_name_context_variable_id;
@@ -102,11 +110,12 @@ bool eventSetsEqual(const EventSet& l, const EventSet& r) {
          l.request_output_values == r.request_output_values &&
          l.declare_optimization_goal == r.declare_optimization_goal;
 }
-}  // namespace Experimental
-bool profileLibraryLoaded() {
-  return !Experimental::eventSetsEqual(Experimental::current_callbacks,
-                                       Experimental::no_profiling);
+
+static void update_profile_library_loaded() {
+  Tools::Impl::g_profile_library_loaded =
+      !eventSetsEqual(current_callbacks, no_profiling);
 }
+}  // namespace Experimental
 
 void beginParallelFor(const std::string& kernelPrefix, const uint32_t devID,
                       uint64_t* kernelID) {
@@ -323,12 +332,81 @@ SpaceHandle make_space_handle(const char* space_name) {
   return handle;
 }
 
+#ifdef KOKKOS_ENABLE_TUNING
+// Context variables set around every kernel when tuning internals
+static void declare_kernel_context_variables() {
+  Experimental::VariableInfo kernel_name;
+  kernel_name.type = Experimental::ValueType::kokkos_value_string;
+  kernel_name.category =
+      Experimental::StatisticalCategory::kokkos_value_categorical;
+  kernel_name.valueQuantity =
+      Experimental::CandidateValueType::kokkos_value_unbounded;
+
+  std::array<std::string, 4> candidate_values = {
+      "parallel_for",
+      "parallel_reduce",
+      "parallel_scan",
+      "parallel_copy",
+  };
+
+  Experimental::SetOrRange kernel_type_variable_candidates =
+      Experimental::make_candidate_set(4, candidate_values.data());
+
+  Experimental::kernel_name_context_variable_id =
+      Experimental::declare_input_type("kokkos.kernel_name", kernel_name);
+
+  Experimental::VariableInfo kernel_type;
+  kernel_type.type = Experimental::ValueType::kokkos_value_string;
+  kernel_type.category =
+      Experimental::StatisticalCategory::kokkos_value_categorical;
+  kernel_type.valueQuantity =
+      Experimental::CandidateValueType::kokkos_value_set;
+  kernel_type.candidates = kernel_type_variable_candidates;
+  Experimental::kernel_type_context_variable_id =
+      Experimental::declare_input_type("kokkos.kernel_type", kernel_type);
+}
+#endif
+
 void initialize() {
   // Make sure initialize calls happens only once
   static int is_initialized = 0;
   if (is_initialized) return;
   is_initialized = 1;
 
+  char* envCounterFile = getenv("KOKKOS_PROFILE_COUNTERS");
+  if ((envCounterFile != nullptr) && (strcmp(envCounterFile, "") != 0)) {
+    if (getenv("KOKKOS_PROFILE_LIBRARY") != nullptr) {
+      std::cerr << "Warning: KOKKOS_PROFILE_COUNTERS is ignored since "
+                   "KOKKOS_PROFILE_LIBRARY is set"
+                << std::endl;
+    } else {
+      Impl::counters_tool_initialize(envCounterFile);
+    }
+  }
+
+  char* envTaskTrace = getenv("KOKKOS_TASK_TRACE");
+  if ((envTaskTrace != nullptr) && (strcmp(envTaskTrace, "") != 0)) {
+    Impl::task_trace_initialize(envTaskTrace);
+  }
+
+#ifdef KOKKOS_ENABLE_TUNING
+  char* envTuningFile = getenv("KOKKOS_TUNING_FILE");
+  if ((envTuningFile != nullptr) && (strcmp(envTuningFile, "") != 0)) {
+    if (getenv("KOKKOS_PROFILE_LIBRARY") != nullptr) {
+      std::cerr << "Warning: KOKKOS_TUNING_FILE is ignored since "
+                   "KOKKOS_PROFILE_LIBRARY is set"
+                << std::endl;
+    } else {
+      Impl::tuner_tool_initialize(envTuningFile);
+    }
+  }
+
+  char* envTuningCache = getenv("KOKKOS_TUNING_CACHE");
+  if ((envTuningCache != nullptr) && (strcmp(envTuningCache, "") != 0)) {
+    Impl::tuning_cache_initialize(envTuningCache);
+  }
+#endif
+
 #ifdef KOKKOS_ENABLE_LIBDL
   void* firstProfileLibrary = nullptr;
 
@@ -337,6 +415,9 @@ void initialize() {
   // If we do not find a profiling library in the environment then exit
   // early.
   if (envProfileLibrary == nullptr) {
+#ifdef KOKKOS_ENABLE_TUNING
+    declare_kernel_context_variables();
+#endif
     return;
   }
 
@@ -475,36 +556,7 @@ void initialize() {
   }
 
 #ifdef KOKKOS_ENABLE_TUNING
-  Experimental::VariableInfo kernel_name;
-  kernel_name.type = Experimental::ValueType::kokkos_value_string;
-  kernel_name.category =
-      Experimental::StatisticalCategory::kokkos_value_categorical;
-  kernel_name.valueQuantity =
-      Experimental::CandidateValueType::kokkos_value_unbounded;
-
-  std::array<std::string, 4> candidate_values = {
-      "parallel_for",
-      "parallel_reduce",
-      "parallel_scan",
-      "parallel_copy",
-  };
-
-  Experimental::SetOrRange kernel_type_variable_candidates =
-      Experimental::make_candidate_set(4, candidate_values.data());
-
-  Experimental::kernel_name_context_variable_id =
-      Experimental::declare_input_type("kokkos.kernel_name", kernel_name);
-
-  Experimental::VariableInfo kernel_type;
-  kernel_type.type = Experimental::ValueType::kokkos_value_string;
-  kernel_type.category =
-      Experimental::StatisticalCategory::kokkos_value_categorical;
-  kernel_type.valueQuantity =
-      Experimental::CandidateValueType::kokkos_value_set;
-  kernel_type.candidates = kernel_type_variable_candidates;
-  Experimental::kernel_type_context_variable_id =
-      Experimental::declare_input_type("kokkos.kernel_type", kernel_type);
-
+  declare_kernel_context_variables();
 #endif
 
   Experimental::no_profiling.init     = nullptr;
@@ -547,6 +599,10 @@ void finalize() {
   if (is_finalized) return;
   is_finalized = 1;
 
+  Impl::tuner_tool_finalize();
+  Impl::tuning_cache_finalize();
+  Impl::task_trace_finalize();
+
   if (Experimental::current_callbacks.finalize != nullptr) {
     (*Experimental::current_callbacks.finalize)();
 
@@ -587,106 +643,142 @@ namespace Tools {
 namespace Experimental {
 void set_init_callback(initFunction callback) {
   current_callbacks.init = callback;
+  update_profile_library_loaded();
 }
 void set_finalize_callback(finalizeFunction callback) {
   current_callbacks.finalize = callback;
+  update_profile_library_loaded();
 }
 void set_begin_parallel_for_callback(beginFunction callback) {
   current_callbacks.begin_parallel_for = callback;
+  update_profile_library_loaded();
 }
 void set_end_parallel_for_callback(endFunction callback) {
   current_callbacks.end_parallel_for = callback;
+  update_profile_library_loaded();
 }
 void set_begin_parallel_reduce_callback(beginFunction callback) {
   current_callbacks.begin_parallel_reduce = callback;
+  update_profile_library_loaded();
 }
 void set_end_parallel_reduce_callback(endFunction callback) {
   current_callbacks.end_parallel_reduce = callback;
+  update_profile_library_loaded();
 }
 void set_begin_parallel_scan_callback(beginFunction callback) {
   current_callbacks.begin_parallel_scan = callback;
+  update_profile_library_loaded();
 }
 void set_end_parallel_scan_callback(endFunction callback) {
   current_callbacks.end_parallel_scan = callback;
+  update_profile_library_loaded();
 }
 void set_push_region_callback(pushFunction callback) {
   current_callbacks.push_region = callback;
+  update_profile_library_loaded();
 }
 void set_pop_region_callback(popFunction callback) {
   current_callbacks.pop_region = callback;
+  update_profile_library_loaded();
 }
 void set_allocate_data_callback(allocateDataFunction callback) {
   current_callbacks.allocate_data = callback;
+  update_profile_library_loaded();
 }
 void set_deallocate_data_callback(deallocateDataFunction callback) {
   current_callbacks.deallocate_data = callback;
+  update_profile_library_loaded();
 }
 void set_create_profile_section_callback(
     createProfileSectionFunction callback) {
   current_callbacks.create_profile_section = callback;
+  update_profile_library_loaded();
 }
 void set_start_profile_section_callback(startProfileSectionFunction callback) {
   current_callbacks.start_profile_section = callback;
+  update_profile_library_loaded();
 }
 void set_stop_profile_section_callback(stopProfileSectionFunction callback) {
   current_callbacks.stop_profile_section = callback;
+  update_profile_library_loaded();
 }
 void set_destroy_profile_section_callback(
     destroyProfileSectionFunction callback) {
   current_callbacks.destroy_profile_section = callback;
+  update_profile_library_loaded();
 }
 void set_profile_event_callback(profileEventFunction callback) {
   current_callbacks.profile_event = callback;
+  update_profile_library_loaded();
 }
 void set_begin_deep_copy_callback(beginDeepCopyFunction callback) {
   current_callbacks.begin_deep_copy = callback;
+  update_profile_library_loaded();
 }
 void set_end_deep_copy_callback(endDeepCopyFunction callback) {
   current_callbacks.end_deep_copy = callback;
+  update_profile_library_loaded();
 }
 void set_begin_fence_callback(beginFenceFunction callback) {
   current_callbacks.begin_fence = callback;
+  update_profile_library_loaded();
 }
 void set_end_fence_callback(endFenceFunction callback) {
   current_callbacks.end_fence = callback;
+  update_profile_library_loaded();
 }
 
 void set_dual_view_sync_callback(dualViewSyncFunction callback) {
   current_callbacks.sync_dual_view = callback;
+  update_profile_library_loaded();
 }
 void set_dual_view_modify_callback(dualViewModifyFunction callback) {
   current_callbacks.modify_dual_view = callback;
+  update_profile_library_loaded();
 }
 
 void set_declare_output_type_callback(outputTypeDeclarationFunction callback) {
   current_callbacks.declare_output_type = callback;
+  update_profile_library_loaded();
 }
 void set_declare_input_type_callback(inputTypeDeclarationFunction callback) {
   current_callbacks.declare_input_type = callback;
+  update_profile_library_loaded();
 }
 void set_request_output_values_callback(requestValueFunction callback) {
   current_callbacks.request_output_values = callback;
+  update_profile_library_loaded();
 }
 void set_end_context_callback(contextEndFunction callback) {
   current_callbacks.end_tuning_context = callback;
+  update_profile_library_loaded();
 }
 void set_begin_context_callback(contextBeginFunction callback) {
   current_callbacks.begin_tuning_context = callback;
+  update_profile_library_loaded();
 }
 void set_declare_optimization_goal_callback(
     optimizationGoalDeclarationFunction callback) {
   current_callbacks.declare_optimization_goal = callback;
+  update_profile_library_loaded();
 }
 
 void pause_tools() {
   backup_callbacks  = current_callbacks;
   current_callbacks = no_profiling;
+  update_profile_library_loaded();
 }
 
-void resume_tools() { current_callbacks = backup_callbacks; }
+void resume_tools() {
+  current_callbacks = backup_callbacks;
+  update_profile_library_loaded();
+}
 
 EventSet get_callbacks() { return current_callbacks; }
-void set_callbacks(EventSet new_events) { current_callbacks = new_events; }
+void set_callbacks(EventSet new_events) {
+  current_callbacks = new_events;
+  update_profile_library_loaded();
+}
 }  // namespace Experimental
 }  // namespace Tools
 
@@ -775,6 +867,17 @@ static size_t& get_variable_counter() {
 }
 
 size_t get_new_context_id() { return ++get_context_counter(); }
+
+size_t get_problem_size_context_variable_id() {
+  static size_t problem_size_id = [] {
+    VariableInfo info;
+    info.type          = ValueType::kokkos_value_int64;
+    info.category      = StatisticalCategory::kokkos_value_ratio;
+    info.valueQuantity = CandidateValueType::kokkos_value_unbounded;
+    return declare_input_type("kokkos.problem_size", info);
+  }();
+  return problem_size_id;
+}
 size_t get_current_context_id() { return get_context_counter(); }
 void decrement_current_context_id() { --get_context_counter(); }
 size_t get_new_variable_id() { return get_variable_counter(); }
@@ -782,6 +885,10 @@ size_t get_new_variable_id() { return get_variable_counter(); }
 size_t declare_output_type(const std::string& variableName, VariableInfo info) {
   size_t variableId = get_new_variable_id();
 #ifdef KOKKOS_ENABLE_TUNING
+  if (Tools::Impl::tuning_cache_enabled()) {
+    Tools::Impl::tuning_cache_declare_variable(variableId,
+                                               variableName.c_str());
+  }
   if (Experimental::current_callbacks.declare_output_type != nullptr) {
     (*Experimental::current_callbacks.declare_output_type)(variableName.c_str(),
                                                            variableId, &info);
@@ -797,6 +904,10 @@ size_t declare_output_type(const std::string& variableName, VariableInfo info) {
 size_t declare_input_type(const std::string& variableName, VariableInfo info) {
   size_t variableId = get_new_variable_id();
 #ifdef KOKKOS_ENABLE_TUNING
+  if (Tools::Impl::tuning_cache_enabled()) {
+    Tools::Impl::tuning_cache_declare_variable(variableId,
+                                               variableName.c_str());
+  }
   if (Experimental::current_callbacks.declare_input_type != nullptr) {
     (*Experimental::current_callbacks.declare_input_type)(variableName.c_str(),
                                                           variableId, &info);
@@ -835,12 +946,22 @@ void request_output_values(size_t contextId, size_t count,
   for (auto id : active_features) {
     context_values.push_back(feature_values[id]);
   }
+  for (size_t x = 0; x < count; ++x) {
+    values[x].metadata = &variable_metadata[values[x].type_id];
+  }
+  // Decisions of earlier runs take precedence over the tool
+  if (Tools::Impl::tuning_cache_enabled() &&
+      Tools::Impl::tuning_cache_request(contextId, context_values.size(),
+                                        context_values.data(), count,
+                                        values)) {
+    return;
+  }
   if (Experimental::current_callbacks.request_output_values != nullptr) {
-    for (size_t x = 0; x < count; ++x) {
-      values[x].metadata = &variable_metadata[values[x].type_id];
-    }
     (*Experimental::current_callbacks.request_output_values)(
         contextId, context_values.size(), context_values.data(), count, values);
+    if (Tools::Impl::tuning_cache_enabled()) {
+      Tools::Impl::tuning_cache_answer(contextId, count, values);
+    }
   }
 #else
   (void)contextId;
@@ -863,6 +984,9 @@ void end_context(size_t contextId) {
   for (auto id : features_per_context[contextId]) {
     active_features.erase(id);
   }
+  if (Tools::Impl::tuning_cache_enabled()) {
+    Tools::Impl::tuning_cache_end_context(contextId);
+  }
   if (Experimental::current_callbacks.end_tuning_context != nullptr) {
     (*Experimental::current_callbacks.end_tuning_context)(
         contextId, feature_values[optimization_goals[contextId]]);
@@ -876,7 +1000,8 @@ void end_context(size_t contextId) {
 
 bool have_tuning_tool() {
 #ifdef KOKKOS_ENABLE_TUNING
-  return (Experimental::current_callbacks.request_output_values != nullptr);
+  return (Experimental::current_callbacks.request_output_values != nullptr) ||
+         Tools::Impl::tuning_cache_enabled();
 #else
   return false;
 #endif
@@ -60,7 +60,13 @@ bool tune_internals() noexcept;
 
 namespace Tools {
 
-bool profileLibraryLoaded();
+namespace Impl {
+// Whether any tool callback is set, updated whenever the callbacks change
+// so that the check made around every kernel launch is a single load.
+extern bool g_profile_library_loaded;
+}  // namespace Impl
+
+inline bool profileLibraryLoaded() { return Impl::g_profile_library_loaded; }
 
 void beginParallelFor(const std::string& kernelPrefix, const uint32_t devID,
                       uint64_t* kernelID);
@@ -183,6 +189,12 @@ namespace Impl {
 static std::map<std::string, Kokkos::Tools::Experimental::TeamSizeTuner>
     team_tuners;
 
+static std::map<std::string, Kokkos::Tools::Experimental::MDRangeTuner>
+    mdrange_tuners;
+
+static std::map<std::string, Kokkos::Tools::Experimental::ChunkSizeTuner>
+    chunk_size_tuners;
+
 template <class ReducerType, class ExecPolicy, class Functor, typename TagType>
 void tune_policy(const size_t, const std::string&, ExecPolicy&, const Functor&,
                  TagType) {}
@@ -313,6 +325,70 @@ void tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
   }
 }
 
+template <class Functor, class TagType, class... Properties>
+void tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
+                 Kokkos::MDRangePolicy<Properties...>& policy, const Functor&,
+                 const TagType&) {
+  if (policy.impl_tune_tile_size()) {
+    std::string label = label_in;
+    if (label_in.empty()) {
+      using policy_type =
+          typename std::remove_reference<decltype(policy)>::type;
+      using work_tag = typename policy_type::work_tag;
+      Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label);
+      label = name.get();
+    }
+    auto tuner_iter = mdrange_tuners.find(label);
+    if (tuner_iter == mdrange_tuners.end()) {
+      tuner_iter =
+          mdrange_tuners
+              .emplace(label,
+                       Kokkos::Tools::Experimental::MDRangeTuner(label, policy))
+              .first;
+    }
+    tuner_iter->second.tune(policy);
+  }
+}
+
+template <class ReducerType, class Functor, class TagType, class... Properties>
+void tune_policy(const size_t tuning_context, const std::string& label_in,
+                 Kokkos::MDRangePolicy<Properties...>& policy,
+                 const Functor& functor, const TagType& tag) {
+  tune_policy(tuning_context, label_in, policy, functor, tag);
+}
+
+template <class Functor, class TagType, class... Properties>
+void tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
+                 Kokkos::RangePolicy<Properties...>& policy, const Functor&,
+                 const TagType&) {
+  if (policy.impl_auto_chunk_size()) {
+    std::string label = label_in;
+    if (label_in.empty()) {
+      using policy_type =
+          typename std::remove_reference<decltype(policy)>::type;
+      using work_tag = typename policy_type::work_tag;
+      Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label);
+      label = name.get();
+    }
+    auto tuner_iter = chunk_size_tuners.find(label);
+    if (tuner_iter == chunk_size_tuners.end()) {
+      tuner_iter = chunk_size_tuners
+                       .emplace(label,
+                                Kokkos::Tools::Experimental::ChunkSizeTuner(
+                                    label))
+                       .first;
+    }
+    tuner_iter->second.tune(policy);
+  }
+}
+
+template <class ReducerType, class Functor, class TagType, class... Properties>
+void tune_policy(const size_t tuning_context, const std::string& label_in,
+                 Kokkos::RangePolicy<Properties...>& policy,
+                 const Functor& functor, const TagType& tag) {
+  tune_policy(tuning_context, label_in, policy, functor, tag);
+}
+
 template <class ReducerType>
 struct ReductionSwitcher {
   template <class Functor, class TagType, class ExecPolicy>
@@ -360,6 +436,44 @@ void report_policy_results(const size_t /**tuning_context*/,
   }
 }
 
+template <class Functor, class TagType, class... Properties>
+void report_policy_results(const size_t /**tuning_context*/,
+                           const std::string& label_in,
+                           Kokkos::MDRangePolicy<Properties...> policy,
+                           const Functor&, const TagType&) {
+  if (policy.impl_tune_tile_size()) {
+    std::string label = label_in;
+    if (label_in.empty()) {
+      using policy_type =
+          typename std::remove_reference<decltype(policy)>::type;
+      using work_tag = typename policy_type::work_tag;
+      Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label);
+      label = name.get();
+    }
+    auto& tuner = mdrange_tuners[label];
+    tuner.end();
+  }
+}
+
+template <class Functor, class TagType, class... Properties>
+void report_policy_results(const size_t /**tuning_context*/,
+                           const std::string& label_in,
+                           Kokkos::RangePolicy<Properties...> policy,
+                           const Functor&, const TagType&) {
+  if (policy.impl_auto_chunk_size()) {
+    std::string label = label_in;
+    if (label_in.empty()) {
+      using policy_type =
+          typename std::remove_reference<decltype(policy)>::type;
+      using work_tag = typename policy_type::work_tag;
+      Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label);
+      label = name.get();
+    }
+    auto& tuner = chunk_size_tuners[label];
+    tuner.end();
+  }
+}
+
 template <class ExecPolicy, class FunctorType>
 void begin_parallel_for(ExecPolicy& policy, FunctorType& functor,
                         const std::string& label, uint64_t& kpID) {
@@ -372,8 +486,8 @@ void begin_parallel_for(ExecPolicy& policy, FunctorType& functor,
         &kpID);
   }
 #ifdef KOKKOS_ENABLE_TUNING
-  size_t context_id = Kokkos::Tools::Experimental::get_new_context_id();
   if (Kokkos::tune_internals()) {
+    size_t context_id = Kokkos::Tools::Experimental::get_new_context_id();
     tune_policy(context_id, label, policy, functor, Kokkos::ParallelForTag{});
   }
 #else
@@ -388,8 +502,8 @@ void end_parallel_for(ExecPolicy& policy, FunctorType& functor,
     Kokkos::Tools::endParallelFor(kpID);
   }
 #ifdef KOKKOS_ENABLE_TUNING
-  size_t context_id = Kokkos::Tools::Experimental::get_current_context_id();
   if (Kokkos::tune_internals()) {
+    size_t context_id = Kokkos::Tools::Experimental::get_current_context_id();
     report_policy_results(context_id, label, policy, functor,
                           Kokkos::ParallelForTag{});
   }
@@ -412,8 +526,8 @@ void begin_parallel_scan(ExecPolicy& policy, FunctorType& functor,
         &kpID);
   }
 #ifdef KOKKOS_ENABLE_TUNING
-  size_t context_id = Kokkos::Tools::Experimental::get_new_context_id();
   if (Kokkos::tune_internals()) {
+    size_t context_id = Kokkos::Tools::Experimental::get_new_context_id();
     tune_policy(context_id, label, policy, functor, Kokkos::ParallelScanTag{});
   }
 #else
@@ -428,8 +542,8 @@ void end_parallel_scan(ExecPolicy& policy, FunctorType& functor,
     Kokkos::Tools::endParallelScan(kpID);
   }
 #ifdef KOKKOS_ENABLE_TUNING
-  size_t context_id = Kokkos::Tools::Experimental::get_current_context_id();
   if (Kokkos::tune_internals()) {
+    size_t context_id = Kokkos::Tools::Experimental::get_current_context_id();
     report_policy_results(context_id, label, policy, functor,
                           Kokkos::ParallelScanTag{});
   }
@@ -452,9 +566,11 @@ void begin_parallel_reduce(ExecPolicy& policy, FunctorType& functor,
         &kpID);
   }
 #ifdef KOKKOS_ENABLE_TUNING
-  size_t context_id = Kokkos::Tools::Experimental::get_new_context_id();
-  ReductionSwitcher<ReducerType>::tune(context_id, label, policy, functor,
-                                       Kokkos::ParallelReduceTag{});
+  if (Kokkos::tune_internals()) {
+    size_t context_id = Kokkos::Tools::Experimental::get_new_context_id();
+    ReductionSwitcher<ReducerType>::tune(context_id, label, policy, functor,
+                                         Kokkos::ParallelReduceTag{});
+  }
 #else
   (void)functor;
 #endif
@@ -467,8 +583,8 @@ void end_parallel_reduce(ExecPolicy& policy, FunctorType& functor,
     Kokkos::Tools::endParallelReduce(kpID);
   }
 #ifdef KOKKOS_ENABLE_TUNING
-  size_t context_id = Kokkos::Tools::Experimental::get_current_context_id();
   if (Kokkos::tune_internals()) {
+    size_t context_id = Kokkos::Tools::Experimental::get_current_context_id();
     report_policy_results(context_id, label, policy, functor,
                           Kokkos::ParallelReduceTag{});
   }
@@ -587,6 +703,9 @@ size_t get_new_context_id();
 size_t get_current_context_id();
 
 size_t get_new_variable_id();
+
+// Input variable holding the amount of work of a tuned kernel
+size_t get_problem_size_context_variable_id();
 }  // namespace Experimental
 }  // namespace Tools
 
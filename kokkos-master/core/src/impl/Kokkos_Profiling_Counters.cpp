@@ -0,0 +1,421 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Macros.hpp>
+#include <impl/Kokkos_Profiling.hpp>
+#include <impl/Kokkos_Profiling_Counters.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#define KOKKOS_IMPL_PROFILING_PERF_EVENTS
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+namespace {
+
+enum : int {
+  counter_cycles,
+  counter_instructions,
+  counter_llc_misses,
+  num_counters
+};
+
+using clock_type = std::chrono::steady_clock;
+
+struct CounterValues {
+  uint64_t value[num_counters] = {};
+};
+
+// Counter group inherited by the threads started after it was opened,
+// 'slot' maps the counters that could be opened to their position in the
+// values read from the group
+struct ProcessCounters {
+  bool opened = false;
+  int group_fd;
+  int fd[num_counters];
+  int slot[num_counters];
+  int num_open = 0;
+};
+
+struct Sample {
+  std::string name;
+  const char* type;
+  clock_type::time_point start;
+  CounterValues counters;
+};
+
+struct Record {
+  uint64_t calls = 0;
+  double seconds = 0;
+  uint64_t counters[num_counters] = {};
+
+  void add(const Record& other) {
+    calls += other.calls;
+    seconds += other.seconds;
+    for (int c = 0; c < num_counters; ++c) counters[c] += other.counters[c];
+  }
+};
+
+using RecordMap = std::map<std::pair<std::string, std::string>, Record>;
+
+// Kernels and regions begin and end on the thread that launches them, so
+// each thread keeps its own samples and records and the callbacks take no
+// lock.  The records are merged at finalize, or when the thread exits.
+struct ThreadState {
+  std::unordered_map<uint64_t, Sample> active_kernels;
+  std::vector<Sample> regions;
+  RecordMap records;
+
+  ThreadState();
+  ~ThreadState();
+};
+
+// g_mutex protects the registry of thread states and the merged records
+std::mutex g_mutex;
+std::string g_output_file;
+ProcessCounters g_counters;
+std::vector<ThreadState*> g_thread_states;
+RecordMap g_records;
+std::atomic<uint64_t> g_next_kernel_id(0);
+int g_cache_line_size = 64;
+
+void merge_records(RecordMap& records) {
+  for (const auto& entry : records) g_records[entry.first].add(entry.second);
+  records.clear();
+}
+
+ThreadState::ThreadState() {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  g_thread_states.push_back(this);
+}
+
+ThreadState::~ThreadState() {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  merge_records(records);
+  g_thread_states.erase(
+      std::find(g_thread_states.begin(), g_thread_states.end(), this));
+}
+
+ThreadState& thread_state() {
+  static thread_local ThreadState state;
+  return state;
+}
+
+#if defined(KOKKOS_IMPL_PROFILING_PERF_EVENTS)
+
+int open_counter(uint32_t type, uint64_t config, int group_fd) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size           = sizeof(attr);
+  attr.type           = type;
+  attr.config         = config;
+  attr.read_format    = PERF_FORMAT_GROUP;
+  attr.inherit        = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv     = 1;
+  // The calling thread and, through inherit, the threads it starts later
+  return static_cast<int>(
+      syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+void open_counters() {
+  static const uint64_t configs[num_counters] = {
+      PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_MISSES};
+  if (g_counters.opened) return;
+  g_counters.opened   = true;
+  g_counters.group_fd = -1;
+  int error           = 0;
+  for (int c = 0; c < num_counters; ++c) {
+    g_counters.fd[c] =
+        open_counter(PERF_TYPE_HARDWARE, configs[c], g_counters.group_fd);
+    g_counters.slot[c] = -1;
+    if (g_counters.fd[c] < 0) {
+      error = errno;
+      continue;
+    }
+    if (g_counters.group_fd < 0) g_counters.group_fd = g_counters.fd[c];
+    g_counters.slot[c] = g_counters.num_open++;
+  }
+  if (error != 0) {
+    std::cerr << "KokkosP: some hardware counters are not available ("
+              << std::strerror(error) << "), their values are reported as 0"
+              << std::endl;
+  }
+  long line_size = sysconf(_SC_LEVEL3_CACHE_LINESIZE);
+  if (line_size > 0) g_cache_line_size = static_cast<int>(line_size);
+}
+
+void close_counters() {
+  for (int c = 0; c < num_counters; ++c) {
+    if (g_counters.opened && g_counters.fd[c] >= 0) close(g_counters.fd[c]);
+  }
+  g_counters = ProcessCounters();
+}
+
+// A single read returns the counts of the whole group summed over the
+// threads that inherited it
+void read_counters(CounterValues& values) {
+  if (g_counters.num_open == 0) return;
+  // PERF_FORMAT_GROUP: the number of counters followed by their values
+  uint64_t buffer[1 + num_counters] = {};
+  if (read(g_counters.group_fd, buffer, sizeof(buffer)) <= 0) buffer[0] = 0;
+  for (int c = 0; c < num_counters; ++c) {
+    const int slot  = g_counters.slot[c];
+    values.value[c] =
+        (0 <= slot && uint64_t(slot) < buffer[0]) ? buffer[1 + slot] : 0;
+  }
+}
+
+#else
+
+void open_counters() {
+  if (g_counters.opened) return;
+  g_counters.opened = true;
+  std::cerr << "KokkosP: hardware counters are not supported on this "
+               "platform, their values are reported as 0"
+            << std::endl;
+}
+
+void close_counters() { g_counters = ProcessCounters(); }
+
+void read_counters(CounterValues&) {}
+
+#endif
+
+void begin_sample(Sample& sample, const char* name, const char* type) {
+  sample.name  = name;
+  sample.type  = type;
+  sample.start = clock_type::now();
+  read_counters(sample.counters);
+}
+
+void end_sample(const Sample& sample, RecordMap& records) {
+  const auto stop = clock_type::now();
+  CounterValues counters;
+  read_counters(counters);
+
+  Record& record = records[std::make_pair(sample.type, sample.name)];
+  record.calls += 1;
+  record.seconds += std::chrono::duration<double>(stop - sample.start).count();
+  for (int c = 0; c < num_counters; ++c) {
+    record.counters[c] += counters.value[c] - sample.counters.value[c];
+  }
+}
+
+void begin_kernel(const char* name, const char* type, uint64_t* kernel_id) {
+  *kernel_id = g_next_kernel_id.fetch_add(1, std::memory_order_relaxed);
+  begin_sample(thread_state().active_kernels[*kernel_id], name, type);
+}
+
+void begin_parallel_for(const char* name, const uint32_t, uint64_t* id) {
+  begin_kernel(name, "parallel_for", id);
+}
+
+void begin_parallel_reduce(const char* name, const uint32_t, uint64_t* id) {
+  begin_kernel(name, "parallel_reduce", id);
+}
+
+void begin_parallel_scan(const char* name, const uint32_t, uint64_t* id) {
+  begin_kernel(name, "parallel_scan", id);
+}
+
+void end_kernel(const uint64_t kernel_id) {
+  ThreadState& state = thread_state();
+  auto found         = state.active_kernels.find(kernel_id);
+  if (found == state.active_kernels.end()) return;
+  end_sample(found->second, state.records);
+  state.active_kernels.erase(found);
+}
+
+void push_region(const char* name) {
+  ThreadState& state = thread_state();
+  state.regions.emplace_back();
+  begin_sample(state.regions.back(), name, "region");
+}
+
+void pop_region() {
+  ThreadState& state = thread_state();
+  if (state.regions.empty()) return;
+  end_sample(state.regions.back(), state.records);
+  state.regions.pop_back();
+}
+
+std::string csv_quote(const std::string& str) {
+  std::string quoted = "\"";
+  for (char c : str) {
+    if (c == '"') quoted += '"';
+    quoted += c;
+  }
+  return quoted + '"';
+}
+
+std::string json_quote(const std::string& str) {
+  std::string quoted = "\"";
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      quoted += '\\';
+      quoted += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      quoted += escaped;
+    } else {
+      quoted += c;
+    }
+  }
+  return quoted + '"';
+}
+
+void write_summary(std::ostream& out, bool json) {
+  const char* columns[] = {"cycles", "instructions", "llc_misses"};
+  if (json) {
+    out << "{\"cache_line_size\": " << g_cache_line_size
+        << ", \"records\": [";
+  } else {
+    out << "type,name,calls,seconds";
+    for (const char* column : columns) out << ',' << column;
+    out << ",llc_bytes\n";
+  }
+  bool first = true;
+  for (const auto& entry : g_records) {
+    const Record& record = entry.second;
+    const uint64_t bytes =
+        record.counters[counter_llc_misses] * uint64_t(g_cache_line_size);
+    if (json) {
+      out << (first ? "\n" : ",\n") << "  {\"type\": \"" << entry.first.first
+          << "\", \"name\": " << json_quote(entry.first.second)
+          << ", \"calls\": " << record.calls
+          << ", \"seconds\": " << record.seconds;
+      for (int c = 0; c < num_counters; ++c) {
+        out << ", \"" << columns[c] << "\": " << record.counters[c];
+      }
+      out << ", \"llc_bytes\": " << bytes << '}';
+    } else {
+      out << entry.first.first << ',' << csv_quote(entry.first.second) << ','
+          << record.calls << ',' << record.seconds;
+      for (int c = 0; c < num_counters; ++c) out << ',' << record.counters[c];
+      out << ',' << bytes << '\n';
+    }
+    first = false;
+  }
+  if (json) out << "\n]}\n";
+}
+
+void finalize_library() {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  for (ThreadState* state : g_thread_states) merge_records(state->records);
+  const std::string suffix = ".json";
+  const bool json =
+      g_output_file.size() >= suffix.size() &&
+      g_output_file.compare(g_output_file.size() - suffix.size(),
+                            suffix.size(), suffix) == 0;
+  std::ofstream out(g_output_file);
+  if (out) {
+    out.precision(9);
+    write_summary(out, json);
+  } else {
+    std::cerr << "KokkosP: unable to write the counter summary to "
+              << g_output_file << std::endl;
+  }
+  close_counters();
+  g_records.clear();
+}
+
+bool counters_tool_requested() {
+  const char* output_file = std::getenv("KOKKOS_PROFILE_COUNTERS");
+  return output_file != nullptr && std::strcmp(output_file, "") != 0 &&
+         std::getenv("KOKKOS_PROFILE_LIBRARY") == nullptr;
+}
+
+}  // namespace
+
+void counters_tool_pre_initialize() {
+  if (!counters_tool_requested()) return;
+  std::lock_guard<std::mutex> lock(g_mutex);
+  open_counters();
+}
+
+void counters_tool_initialize(const char* output_file) {
+  {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_output_file = output_file;
+    open_counters();
+  }
+  Experimental::set_begin_parallel_for_callback(begin_parallel_for);
+  Experimental::set_end_parallel_for_callback(end_kernel);
+  Experimental::set_begin_parallel_reduce_callback(begin_parallel_reduce);
+  Experimental::set_end_parallel_reduce_callback(end_kernel);
+  Experimental::set_begin_parallel_scan_callback(begin_parallel_scan);
+  Experimental::set_end_parallel_scan_callback(end_kernel);
+  Experimental::set_push_region_callback(push_region);
+  Experimental::set_pop_region_callback(pop_region);
+  Experimental::set_finalize_callback(finalize_library);
+}
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
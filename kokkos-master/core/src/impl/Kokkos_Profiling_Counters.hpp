@@ -0,0 +1,79 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_IMPL_KOKKOS_PROFILING_COUNTERS_HPP
+#define KOKKOS_IMPL_KOKKOS_PROFILING_COUNTERS_HPP
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+/* Built-in tool collecting hardware counters per kernel and region.
+ *
+ * Enabled by setting KOKKOS_PROFILE_COUNTERS to the name of an output file
+ * instead of loading a library through KOKKOS_PROFILE_LIBRARY.  Before
+ * the backends start, a counter group (cycles, instructions and last level
+ * cache misses, user mode only) is opened with perf_event_open on the
+ * initializing thread and inherited by every thread started afterwards,
+ * which includes the threads of the host execution spaces.  Threads started
+ * before Kokkos::initialize are not counted.  The group counts
+ * continuously; each kernel or region reads it once at its begin and end
+ * and accumulates the differences, summed over the threads, under its
+ * label.  Samples and records are kept per launching thread, so the
+ * kernel and region callbacks take no lock.  The summary is written at
+ * finalize, as JSON when the file name ends in ".json" and as CSV
+ * otherwise.  Where counters are unavailable only calls and times are
+ * recorded.
+ */
+void counters_tool_initialize(const char* output_file);
+
+// Opens the counter group if KOKKOS_PROFILE_COUNTERS is set, called by
+// Kokkos::initialize before the backends start their threads
+void counters_tool_pre_initialize();
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
+
+#endif  // KOKKOS_IMPL_KOKKOS_PROFILING_COUNTERS_HPP
@@ -0,0 +1,366 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Macros.hpp>
+#include <impl/Kokkos_Profiling_TaskTrace.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+std::atomic<bool> g_task_trace_enabled{false};
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr uint64_t buffer_capacity = 65536;
+
+struct Event {
+  uint64_t time;  // nanoseconds since tracing was enabled
+  void const* task;
+  TaskTraceEvent kind;
+  uint32_t flags;
+};
+
+// Written only by the thread owning it
+struct ThreadTrace {
+  std::vector<Event> events;  // ring buffer of buffer_capacity events
+  uint64_t recorded      = 0;
+  uint64_t counts[4]     = {};  // by event kind
+  uint64_t stolen        = 0;
+  uint64_t continuations = 0;
+  uint64_t respawned     = 0;
+  uint64_t start_time    = 0;  // of the task being run
+  uint64_t run_time      = 0;
+};
+
+struct MergedEvent {
+  Event event;
+  size_t thread;
+};
+
+// Bumped by every initialization so that threads register new buffers
+std::atomic<uint64_t> g_generation{0};
+std::mutex g_mutex;
+std::string g_output_file;
+clock_type::time_point g_origin;
+std::vector<std::unique_ptr<ThreadTrace>> g_threads;
+
+std::atomic<uint64_t> g_allocations{0};
+std::atomic<uint64_t> g_failed_allocations{0};
+std::atomic<int64_t> g_allocated_bytes{0};
+std::atomic<int64_t> g_peak_allocated_bytes{0};
+std::atomic<uint64_t> g_pool_capacity{0};
+
+thread_local ThreadTrace* t_trace        = nullptr;
+thread_local uint64_t t_trace_generation = 0;
+
+uint64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             clock_type::now() - g_origin)
+      .count();
+}
+
+ThreadTrace& thread_trace() {
+  const uint64_t generation = g_generation.load(std::memory_order_relaxed);
+  if (t_trace == nullptr || t_trace_generation != generation) {
+    std::unique_ptr<ThreadTrace> trace(new ThreadTrace);
+    trace->events.resize(buffer_capacity);
+    std::lock_guard<std::mutex> lock(g_mutex);
+    t_trace            = trace.get();
+    t_trace_generation = generation;
+    g_threads.push_back(std::move(trace));
+  }
+  return *t_trace;
+}
+
+template <class T>
+void atomic_max(std::atomic<T>& value, T candidate) {
+  T current = value.load(std::memory_order_relaxed);
+  while (current < candidate &&
+         !value.compare_exchange_weak(current, candidate,
+                                      std::memory_order_relaxed)) {
+  }
+}
+
+// The events still held by all buffers, in time order; g_mutex must be held
+std::vector<MergedEvent> merged_events() {
+  std::vector<MergedEvent> merged;
+  for (size_t thread = 0; thread < g_threads.size(); ++thread) {
+    auto const& trace    = *g_threads[thread];
+    const uint64_t first = trace.recorded > buffer_capacity
+                               ? trace.recorded - buffer_capacity
+                               : 0;
+    for (uint64_t i = first; i < trace.recorded; ++i) {
+      merged.push_back({trace.events[i % buffer_capacity], thread});
+    }
+  }
+  std::stable_sort(merged.begin(), merged.end(),
+                   [](MergedEvent const& lhs, MergedEvent const& rhs) {
+                     return lhs.event.time < rhs.event.time;
+                   });
+  return merged;
+}
+
+// Microseconds, as expected by the trace format
+void write_time(std::ostream& out, uint64_t nanoseconds) {
+  out << nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0')
+      << nanoseconds % 1000;
+}
+
+void write_task(std::ostream& out, void const* task) {
+  out << "\"0x" << std::hex << reinterpret_cast<uintptr_t>(task) << std::dec
+      << '"';
+}
+
+void write_trace(std::ostream& out, std::vector<MergedEvent> const& events) {
+  struct Running {
+    MergedEvent start;
+    uint64_t wait;
+  };
+  std::unordered_map<void const*, uint64_t> ready_times;
+  std::vector<Running> running(g_threads.size());
+  std::vector<bool> is_running(g_threads.size(), false);
+
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  const char* separator = "\n";
+  for (size_t thread = 0; thread < g_threads.size(); ++thread) {
+    out << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+        << "\"tid\":" << thread << ",\"args\":{\"name\":\"thread " << thread
+        << "\"}}";
+    separator = ",\n";
+  }
+  for (auto const& merged : events) {
+    auto const& event = merged.event;
+    switch (event.kind) {
+      case TaskTraceEvent::spawn:
+        out << separator << "{\"name\":\"spawn\",\"cat\":\"task\",\"ph\":\"i\","
+            << "\"s\":\"t\",\"pid\":0,\"tid\":" << merged.thread << ",\"ts\":";
+        write_time(out, event.time);
+        out << ",\"args\":{\"task\":";
+        write_task(out, event.task);
+        out << "}}";
+        break;
+      case TaskTraceEvent::ready:
+      case TaskTraceEvent::start: {
+        uint64_t wait = 0;
+        if (event.kind == TaskTraceEvent::ready) {
+          ready_times[event.task] = event.time;
+        } else {
+          auto found = ready_times.find(event.task);
+          if (found != ready_times.end()) {
+            wait = event.time - found->second;
+            ready_times.erase(found);
+          }
+          running[merged.thread]    = {merged, wait};
+          is_running[merged.thread] = true;
+        }
+        out << separator << "{\"name\":\"ready tasks\",\"ph\":\"C\",\"pid\":0,"
+            << "\"ts\":";
+        write_time(out, event.time);
+        out << ",\"args\":{\"ready\":" << ready_times.size() << "}}";
+      } break;
+      case TaskTraceEvent::end: {
+        if (!is_running[merged.thread]) break;
+        auto const& start = running[merged.thread];
+        out << separator << "{\"name\":\"task\",\"cat\":\"task\",\"ph\":\"X\","
+            << "\"pid\":0,\"tid\":" << merged.thread << ",\"ts\":";
+        write_time(out, start.start.event.time);
+        out << ",\"dur\":";
+        write_time(out, event.time - start.start.event.time);
+        out << ",\"args\":{\"task\":";
+        write_task(out, event.task);
+        out << ",\"queue_wait_us\":";
+        write_time(out, start.wait);
+        out << ",\"stolen\":"
+            << ((start.start.event.flags & task_trace_stolen) ? "true"
+                                                                : "false")
+            << ",\"continuation\":"
+            << ((start.start.event.flags & task_trace_continuation)
+                    ? "true"
+                    : "false")
+            << ",\"respawned\":"
+            << ((event.flags & task_trace_respawned) ? "true" : "false")
+            << "}}";
+        is_running[merged.thread] = false;
+      } break;
+    }
+  }
+  out << "\n]}\n";
+}
+
+Experimental::TaskTraceCounters collect_counters() {
+  Experimental::TaskTraceCounters counters{};
+  std::lock_guard<std::mutex> lock(g_mutex);
+  uint64_t run_time = 0;
+  for (auto const& trace : g_threads) {
+    counters.spawned += trace->counts[int(TaskTraceEvent::spawn)];
+    counters.became_ready += trace->counts[int(TaskTraceEvent::ready)];
+    counters.executed += trace->counts[int(TaskTraceEvent::start)];
+    counters.stolen += trace->stolen;
+    counters.continuations += trace->continuations;
+    counters.respawned += trace->respawned;
+    run_time += trace->run_time;
+    if (trace->recorded > buffer_capacity) {
+      counters.dropped_events += trace->recorded - buffer_capacity;
+    }
+  }
+  counters.run_time = 1.0e-9 * run_time;
+
+  std::unordered_map<void const*, uint64_t> ready_times;
+  for (auto const& merged : merged_events()) {
+    auto const& event = merged.event;
+    if (event.kind == TaskTraceEvent::ready) {
+      ready_times[event.task] = event.time;
+    } else if (event.kind == TaskTraceEvent::start) {
+      auto found = ready_times.find(event.task);
+      if (found == ready_times.end()) continue;
+      const double wait = 1.0e-9 * (event.time - found->second);
+      counters.queue_wait_time += wait;
+      counters.max_queue_wait_time =
+          std::max(counters.max_queue_wait_time, wait);
+      ready_times.erase(found);
+    }
+  }
+
+  counters.allocations        = g_allocations;
+  counters.failed_allocations = g_failed_allocations;
+  counters.allocated_bytes =
+      static_cast<uint64_t>(std::max<int64_t>(g_allocated_bytes, 0));
+  counters.peak_allocated_bytes =
+      static_cast<uint64_t>(g_peak_allocated_bytes.load());
+  counters.pool_capacity = g_pool_capacity;
+  return counters;
+}
+
+}  // namespace
+
+void task_trace_initialize(const char* output_file) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  g_output_file = output_file;
+  g_origin      = clock_type::now();
+  g_threads.clear();
+  g_allocations          = 0;
+  g_failed_allocations   = 0;
+  g_allocated_bytes      = 0;
+  g_peak_allocated_bytes = 0;
+  g_pool_capacity        = 0;
+  ++g_generation;
+  g_task_trace_enabled = true;
+}
+
+void task_trace_finalize() {
+  if (!g_task_trace_enabled) return;
+  std::lock_guard<std::mutex> lock(g_mutex);
+  g_task_trace_enabled = false;
+  if (!g_output_file.empty()) {
+    std::ofstream out(g_output_file);
+    if (out) {
+      write_trace(out, merged_events());
+    } else {
+      std::cerr << "Kokkos: unable to write the task trace to "
+                << g_output_file << std::endl;
+    }
+  }
+  g_threads.clear();
+}
+
+void task_trace_record(TaskTraceEvent event, void const* task,
+                       uint32_t flags) {
+  const uint64_t time = now();
+  auto& trace         = thread_trace();
+  trace.events[trace.recorded % buffer_capacity] = {time, task, event, flags};
+  ++trace.recorded;
+  ++trace.counts[static_cast<int>(event)];
+  if (event == TaskTraceEvent::start) {
+    trace.start_time = time;
+    if (flags & task_trace_stolen) ++trace.stolen;
+    if (flags & task_trace_continuation) ++trace.continuations;
+  } else if (event == TaskTraceEvent::end) {
+    trace.run_time += time - trace.start_time;
+    if (flags & task_trace_respawned) ++trace.respawned;
+  }
+}
+
+void task_trace_allocation(size_t bytes, bool success, size_t pool_capacity) {
+  atomic_max(g_pool_capacity, static_cast<uint64_t>(pool_capacity));
+  if (!success) {
+    ++g_failed_allocations;
+    return;
+  }
+  ++g_allocations;
+  const int64_t allocated = g_allocated_bytes += static_cast<int64_t>(bytes);
+  atomic_max(g_peak_allocated_bytes, allocated);
+}
+
+void task_trace_deallocation(size_t bytes) {
+  g_allocated_bytes -= static_cast<int64_t>(bytes);
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+TaskTraceCounters get_task_trace_counters() {
+  if (!task_trace_enabled()) return TaskTraceCounters{};
+  return Impl::collect_counters();
+}
+
+}  // namespace Experimental
+}  // namespace Tools
+}  // namespace Kokkos
@@ -0,0 +1,177 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_IMPL_KOKKOS_PROFILING_TASKTRACE_HPP
+#define KOKKOS_IMPL_KOKKOS_PROFILING_TASKTRACE_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+// Set between task_trace_initialize and task_trace_finalize, so that the
+// check made by every queue operation is a single load when tracing is off
+extern std::atomic<bool> g_task_trace_enabled;
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief Totals of the task scheduler activity since tracing was enabled.
+ *
+ *  The counts are exact.  The queue wait times are computed from the events
+ *  still held in the trace buffers, so they only cover the most recent
+ *  events once dropped_events is not zero.  Query these while no task
+ *  scheduler is executing.
+ */
+struct TaskTraceCounters {
+  uint64_t spawned;            // tasks spawned
+  uint64_t became_ready;       // tasks pushed to a ready queue
+  uint64_t executed;           // tasks popped from a ready queue and run
+  uint64_t stolen;             // executed tasks stolen from another team
+  uint64_t continuations;      // executed tasks run as a continuation
+  uint64_t respawned;          // executed tasks that respawned
+  double run_time;             // seconds spent running tasks
+  double queue_wait_time;      // seconds between becoming ready and running
+  double max_queue_wait_time;  // longest single wait, in seconds
+  uint64_t allocations;        // task queue memory pool allocations
+  uint64_t failed_allocations;
+  uint64_t allocated_bytes;  // currently allocated from the memory pool
+  uint64_t peak_allocated_bytes;
+  uint64_t pool_capacity;   // capacity of the largest pool allocated from
+  uint64_t dropped_events;  // events overwritten in the trace buffers
+};
+
+/** \brief Whether task scheduler tracing is enabled */
+inline bool task_trace_enabled() noexcept {
+  return Tools::Impl::g_task_trace_enabled.load(std::memory_order_relaxed);
+}
+
+/** \brief Counters collected since tracing was enabled; all zero when it is
+ *  not */
+TaskTraceCounters get_task_trace_counters();
+
+}  // namespace Experimental
+
+namespace Impl {
+
+/* Built-in tracing of the task schedulers (SimpleTaskScheduler queues).
+ *
+ * Enabled by setting KOKKOS_TASK_TRACE to the name of an output file.  Every
+ * thread records the spawn, ready, start and end of tasks with a time stamp
+ * in its own ring buffer of 65536 events, overwriting the oldest ones when
+ * full.  At finalize the buffers are merged and written in the Chrome trace
+ * event format (chrome://tracing, Perfetto): one duration event per task run
+ * on the thread that ran it, with its queue wait time in the arguments, an
+ * instant event per spawn and a counter with the number of ready tasks that
+ * have not started yet.
+ */
+void task_trace_initialize(const char* output_file);
+
+void task_trace_finalize();
+
+enum class TaskTraceEvent : uint32_t { spawn, ready, start, end };
+
+enum : uint32_t {
+  task_trace_stolen       = 1,
+  task_trace_continuation = 2,
+  task_trace_respawned    = 4
+};
+
+void task_trace_record(TaskTraceEvent event, void const* task, uint32_t flags);
+
+void task_trace_allocation(size_t bytes, bool success, size_t pool_capacity);
+
+void task_trace_deallocation(size_t bytes);
+
+// The hooks below are called from the task queues; they compile to nothing
+// in device code
+
+KOKKOS_INLINE_FUNCTION
+void task_trace_event(TaskTraceEvent event, void const* task,
+                      uint32_t flags = 0) {
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+  if (Experimental::task_trace_enabled()) {
+    task_trace_record(event, task, flags);
+  }
+#else
+  (void)event;
+  (void)task;
+  (void)flags;
+#endif
+}
+
+KOKKOS_INLINE_FUNCTION
+void task_trace_pool_allocate(size_t bytes, bool success,
+                              size_t pool_capacity) {
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+  if (Experimental::task_trace_enabled()) {
+    task_trace_allocation(bytes, success, pool_capacity);
+  }
+#else
+  (void)bytes;
+  (void)success;
+  (void)pool_capacity;
+#endif
+}
+
+KOKKOS_INLINE_FUNCTION
+void task_trace_pool_deallocate(size_t bytes) {
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+  if (Experimental::task_trace_enabled()) {
+    task_trace_deallocation(bytes);
+  }
+#else
+  (void)bytes;
+#endif
+}
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
+
+#endif  // KOKKOS_IMPL_KOKKOS_PROFILING_TASKTRACE_HPP
@@ -0,0 +1,417 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Macros.hpp>
+#include <impl/Kokkos_Profiling.hpp>
+#include <impl/Kokkos_Profiling_Tuner.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+using Experimental::CandidateValueType;
+using Experimental::ValueType;
+using Experimental::VariableInfo;
+using Experimental::VariableValue;
+
+constexpr size_t max_points        = 64;
+constexpr uint64_t min_samples     = 2;
+constexpr double exploration_ratio = 0.05;
+
+// Values searched for one output variable
+struct Dimension {
+  std::string name;
+  ValueType type;
+  std::vector<VariableValue> values;
+};
+
+struct PointStats {
+  uint64_t samples = 0;
+  double best      = 0;  // fastest time seen
+  double total     = 0;
+};
+
+struct Problem {
+  std::vector<std::vector<VariableValue>> points;
+  std::vector<std::string> keys;  // the values of each point, as stored
+  std::vector<PointStats> stats;
+};
+
+struct ActiveContext {
+  size_t id;
+  Problem* problem;
+  size_t point;
+  clock_type::time_point start;
+};
+
+std::mutex g_mutex;
+std::string g_results_file;
+bool g_enabled = false;
+std::unordered_map<size_t, Dimension> g_dimensions;
+std::map<std::string, Problem> g_problems;
+// Statistics read from the results file, by problem and point
+std::map<std::string, std::map<std::string, PointStats>> g_results;
+std::vector<ActiveContext> g_contexts;
+std::minstd_rand g_random;
+
+std::string sanitize(std::string str) {
+  for (auto& c : str) {
+    if (c == '\t' || c == '\n' || c == ',') c = ' ';
+  }
+  return str;
+}
+
+std::string format_value(ValueType type, const VariableValue& value) {
+  switch (type) {
+    case ValueType::kokkos_value_int64:
+      return std::to_string(value.value.int_value);
+    case ValueType::kokkos_value_double: {
+      char buffer[32];
+      std::snprintf(buffer, sizeof(buffer), "%.17g",
+                    value.value.double_value);
+      return buffer;
+    }
+    default: return sanitize(value.value.string_value);
+  }
+}
+
+// Indices of 'limit' values spread evenly over [0, count)
+std::vector<size_t> spread(size_t count, size_t limit) {
+  std::vector<size_t> indices;
+  if (count <= limit) {
+    for (size_t i = 0; i < count; ++i) indices.push_back(i);
+  } else if (limit == 1) {
+    indices.push_back(count / 2);
+  } else {
+    for (size_t i = 0; i < limit; ++i) {
+      indices.push_back((i * (count - 1) + (limit - 1) / 2) / (limit - 1));
+    }
+  }
+  return indices;
+}
+
+// Candidate values of a variable, at most 'limit' of them
+std::vector<VariableValue> candidate_values(const VariableInfo& info,
+                                            size_t limit) {
+  std::vector<VariableValue> values;
+  VariableValue value{};
+  if (info.valueQuantity == CandidateValueType::kokkos_value_set) {
+    const auto& set = info.candidates.set;
+    for (size_t i : spread(set.size, limit)) {
+      switch (info.type) {
+        case ValueType::kokkos_value_int64:
+          value.value.int_value = set.values.int_value[i];
+          break;
+        case ValueType::kokkos_value_double:
+          value.value.double_value = set.values.double_value[i];
+          break;
+        default:
+          std::snprintf(value.value.string_value,
+                        sizeof(value.value.string_value), "%s",
+                        set.values.string_value[i]);
+      }
+      values.push_back(value);
+    }
+  } else if (info.valueQuantity == CandidateValueType::kokkos_value_range) {
+    const auto& range = info.candidates.range;
+    if (info.type == ValueType::kokkos_value_int64) {
+      const int64_t step  = std::max<int64_t>(range.step.int_value, 1);
+      const int64_t first = range.lower.int_value + (range.openLower ? 1 : 0);
+      const int64_t last  = range.upper.int_value - (range.openUpper ? 1 : 0);
+      if (last < first) return values;
+      for (size_t i : spread((last - first) / step + 1, limit)) {
+        value.value.int_value = first + int64_t(i) * step;
+        values.push_back(value);
+      }
+    } else if (info.type == ValueType::kokkos_value_double) {
+      const double lower = range.lower.double_value;
+      const double upper = range.upper.double_value;
+      const double step  = range.step.double_value;
+      if (!(lower < upper)) return values;
+      if (step > 0) {
+        const int64_t first = range.openLower ? 1 : 0;
+        int64_t last        = int64_t(std::floor((upper - lower) / step));
+        if (range.openUpper && lower + last * step >= upper) --last;
+        if (last < first) return values;
+        for (size_t i : spread(last - first + 1, limit)) {
+          value.value.double_value = lower + (first + int64_t(i)) * step;
+          values.push_back(value);
+        }
+      } else {
+        // Without a step, pick points inside the interval
+        for (size_t i = 0; i < limit; ++i) {
+          value.value.double_value =
+              lower + (i + 1) * (upper - lower) / (limit + 1);
+          values.push_back(value);
+        }
+      }
+    }
+  }
+  return values;
+}
+
+void declare_output_type(const char* name, const size_t id,
+                         VariableInfo* info) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  Dimension dimension;
+  dimension.name = sanitize(name);
+  dimension.type = info->type;
+  // How many of these a problem searches depends on its number of variables
+  dimension.values = candidate_values(*info, max_points);
+  g_dimensions[id] = std::move(dimension);
+}
+
+// Grid over the candidate values of 'dims', false if a variable has none
+bool build_problem(const std::vector<const Dimension*>& dims,
+                   const std::string& name, Problem& problem) {
+  const size_t limit = std::max<size_t>(
+      2, size_t(std::pow(double(max_points), 1.0 / dims.size()) + 1e-9));
+  std::vector<std::vector<size_t>> axes;
+  for (const auto* dim : dims) {
+    if (dim->values.empty()) return false;
+    axes.push_back(spread(dim->values.size(), limit));
+  }
+  std::vector<size_t> index(dims.size(), 0);
+  const auto& results = g_results[name];
+  while (true) {
+    std::vector<VariableValue> point;
+    std::string key;
+    for (size_t d = 0; d < dims.size(); ++d) {
+      point.push_back(dims[d]->values[axes[d][index[d]]]);
+      if (d > 0) key += ',';
+      key += format_value(dims[d]->type, point.back());
+    }
+    auto found = results.find(key);
+    problem.stats.push_back(found == results.end() ? PointStats{}
+                                                   : found->second);
+    problem.points.push_back(std::move(point));
+    problem.keys.push_back(std::move(key));
+    size_t d = dims.size();
+    while (d > 0 && ++index[d - 1] == axes[d - 1].size()) index[--d] = 0;
+    if (d == 0) break;
+  }
+  return true;
+}
+
+size_t choose_point(const Problem& problem) {
+  size_t best = 0;
+  for (size_t i = 0; i < problem.stats.size(); ++i) {
+    if (problem.stats[i].samples < problem.stats[best].samples) best = i;
+  }
+  if (problem.stats[best].samples < min_samples) return best;
+  if (std::uniform_real_distribution<double>(0, 1)(g_random) <
+      exploration_ratio) {
+    return std::uniform_int_distribution<size_t>(
+        0, problem.stats.size() - 1)(g_random);
+  }
+  for (size_t i = 0; i < problem.stats.size(); ++i) {
+    if (problem.stats[i].best < problem.stats[best].best) best = i;
+  }
+  return best;
+}
+
+void request_output_values(const size_t context, const size_t,
+                           const VariableValue*, const size_t count,
+                           VariableValue* values) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  std::vector<const Dimension*> dims;
+  std::string name;
+  for (size_t i = 0; i < count; ++i) {
+    auto dim = g_dimensions.find(values[i].type_id);
+    if (dim == g_dimensions.end()) return;
+    dims.push_back(&dim->second);
+    name += (i > 0 ? ";" : "") + dim->second.name;
+  }
+  if (dims.empty()) return;
+  auto problem = g_problems.find(name);
+  if (problem == g_problems.end()) {
+    Problem new_problem;
+    if (!build_problem(dims, name, new_problem)) return;
+    problem = g_problems.emplace(name, std::move(new_problem)).first;
+  }
+  const size_t point = choose_point(problem->second);
+  for (size_t i = 0; i < count; ++i) {
+    values[i].value = problem->second.points[point][i].value;
+  }
+  for (auto active = g_contexts.rbegin(); active != g_contexts.rend();
+       ++active) {
+    if (active->id == context) {
+      active->problem = &problem->second;
+      active->point   = point;
+      active->start   = clock_type::now();
+      return;
+    }
+  }
+  g_contexts.push_back(
+      ActiveContext{context, &problem->second, point, clock_type::now()});
+}
+
+void begin_context(const size_t context) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  g_contexts.push_back(ActiveContext{context, nullptr, 0, clock_type::now()});
+}
+
+void end_context(const size_t context, VariableValue) {
+  const auto end = clock_type::now();
+  std::lock_guard<std::mutex> lock(g_mutex);
+  for (auto active = g_contexts.end(); active != g_contexts.begin();) {
+    --active;
+    if (active->id != context) continue;
+    if (active->problem != nullptr) {
+      const double seconds =
+          std::chrono::duration<double>(end - active->start).count();
+      auto& stats = active->problem->stats[active->point];
+      stats.best =
+          stats.samples == 0 ? seconds : std::min(stats.best, seconds);
+      stats.total += seconds;
+      ++stats.samples;
+    }
+    g_contexts.erase(active);
+    return;
+  }
+}
+
+void read_results() {
+  std::ifstream in(g_results_file);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream fields(line);
+    std::string problem, point, samples, best, total;
+    if (std::getline(fields, problem, '\t') &&
+        std::getline(fields, point, '\t') &&
+        std::getline(fields, samples, '\t') &&
+        std::getline(fields, best, '\t') && std::getline(fields, total)) {
+      PointStats stats;
+      stats.samples = std::strtoull(samples.c_str(), nullptr, 10);
+      stats.best    = std::strtod(best.c_str(), nullptr);
+      stats.total   = std::strtod(total.c_str(), nullptr);
+      g_results[problem][point] = stats;
+    }
+  }
+}
+
+void write_results() {
+  for (const auto& problem : g_problems) {
+    auto& results = g_results[problem.first];
+    for (size_t i = 0; i < problem.second.keys.size(); ++i) {
+      if (problem.second.stats[i].samples > 0) {
+        results[problem.second.keys[i]] = problem.second.stats[i];
+      }
+    }
+  }
+  // Replace the file at once so that a concurrent run reads either version
+  const std::string temporary = g_results_file + ".tmp";
+  {
+    std::ofstream out(temporary);
+    if (!out) {
+      std::cerr << "Kokkos::Tuning: unable to write the tuning results to "
+                << g_results_file << std::endl;
+      return;
+    }
+    out.precision(9);
+    out << "# problem\tvalues\tsamples\tbest seconds\ttotal seconds\n";
+    for (const auto& problem : g_results) {
+      for (const auto& point : problem.second) {
+        out << problem.first << '\t' << point.first << '\t'
+            << point.second.samples << '\t' << point.second.best << '\t'
+            << point.second.total << '\n';
+      }
+    }
+  }
+  if (std::rename(temporary.c_str(), g_results_file.c_str()) != 0) {
+    std::cerr << "Kokkos::Tuning: unable to write the tuning results to "
+              << g_results_file << std::endl;
+  }
+}
+
+}  // namespace
+
+void tuner_tool_initialize(const char* results_file) {
+  {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_results_file = results_file;
+    g_enabled      = true;
+    read_results();
+  }
+  Experimental::set_declare_output_type_callback(declare_output_type);
+  Experimental::set_request_output_values_callback(request_output_values);
+  Experimental::set_begin_context_callback(begin_context);
+  Experimental::set_end_context_callback(end_context);
+}
+
+void tuner_tool_finalize() {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  if (!g_enabled) return;
+  write_results();
+  g_enabled = false;
+  g_dimensions.clear();
+  g_problems.clear();
+  g_results.clear();
+  g_contexts.clear();
+}
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
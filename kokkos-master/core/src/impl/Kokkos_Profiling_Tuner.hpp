@@ -0,0 +1,73 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_IMPL_KOKKOS_PROFILING_TUNER_HPP
+#define KOKKOS_IMPL_KOKKOS_PROFILING_TUNER_HPP
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+/* Built-in tool answering tuning requests without an external library.
+ *
+ * Enabled by setting KOKKOS_TUNING_FILE to the name of a results file.  Each
+ * tuning problem, identified by the names of its output variables, is
+ * searched over a grid of at most 64 points of its candidate values: every
+ * point is first timed twice, after which the fastest point is used with
+ * a small probability of trying another one.  The time of a point is the
+ * time between the request for output values and the end of the tuning
+ * context.  The statistics of every point are read from the file at
+ * initialization and written back at finalize, so that the search resumes
+ * where the previous run left off.  The tuners of the Kokkos policies only
+ * issue requests when tuning of internals is on (--kokkos-tune-internals).
+ */
+void tuner_tool_initialize(const char* results_file);
+
+void tuner_tool_finalize();
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
+
+#endif  // KOKKOS_IMPL_KOKKOS_PROFILING_TUNER_HPP
@@ -0,0 +1,351 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_CPUDiscovery.hpp>
+#include <impl/Kokkos_Profiling_TuningCache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+using Experimental::StatisticalCategory;
+using Experimental::ValueType;
+using Experimental::VariableValue;
+
+constexpr const char* cache_header = "# Kokkos tuning cache, version 1";
+
+// An answer of the tool is only stored once the tool chose it this many
+// times: a search samples each candidate a few times before settling on the
+// fastest, and an exploratory sample must not be frozen into the cache
+constexpr uint64_t settled_samples = 8;
+
+struct Entry {
+  std::string values;  // comma separated, in the order of the outputs
+  double seconds   = 0;
+  uint64_t samples = 0;
+};
+
+struct PendingContext {
+  std::string key;
+  std::string values;
+  clock_type::time_point start;
+};
+
+std::mutex g_mutex;
+std::atomic<bool> g_enabled{false};
+std::string g_cache_file;
+std::string g_signature;
+std::unordered_map<size_t, std::string> g_names;
+// Entries by signature and key as read from the file; only those of
+// g_signature are looked up
+std::map<std::pair<std::string, std::string>, Entry> g_entries;
+// Answers of the tool during this run with their fastest time, by key and
+// values
+std::map<std::string, std::map<std::string, Entry>> g_measured;
+std::unordered_map<size_t, PendingContext> g_pending;
+
+std::string sanitize(std::string str) {
+  for (auto& c : str) {
+    if (c == '\t' || c == '\n' || c == ',' || c == ';' || c == '=') c = ' ';
+  }
+  return str;
+}
+
+std::string format_value(const VariableValue& value) {
+  switch (value.metadata->type) {
+    case ValueType::kokkos_value_int64:
+      return std::to_string(value.value.int_value);
+    case ValueType::kokkos_value_double: {
+      char buffer[32];
+      std::snprintf(buffer, sizeof(buffer), "%.17g",
+                    value.value.double_value);
+      return buffer;
+    }
+    default: return sanitize(value.value.string_value);
+  }
+}
+
+// Inputs measuring a quantity only need to match within a factor two
+std::string format_input(const VariableValue& value) {
+  const auto category = value.metadata->category;
+  const bool quantity =
+      category == StatisticalCategory::kokkos_value_interval ||
+      category == StatisticalCategory::kokkos_value_ratio;
+  if (quantity && value.metadata->type == ValueType::kokkos_value_int64) {
+    int64_t magnitude = std::abs(value.value.int_value);
+    int bucket        = 0;
+    while (magnitude > 0) {
+      magnitude >>= 1;
+      ++bucket;
+    }
+    return (value.value.int_value < 0 ? "-2^" : "2^") +
+           std::to_string(bucket);
+  }
+  if (quantity && value.metadata->type == ValueType::kokkos_value_double) {
+    const double magnitude = std::fabs(value.value.double_value);
+    if (!(magnitude > 0)) return "0";
+    return (value.value.double_value < 0 ? "-2^" : "2^") +
+           std::to_string(int(std::floor(std::log2(magnitude))));
+  }
+  return format_value(value);
+}
+
+bool parse_values(const std::string& str, size_t count,
+                  VariableValue* values) {
+  std::istringstream fields(str);
+  std::vector<VariableValue> parsed(values, values + count);
+  for (size_t i = 0; i < count; ++i) {
+    std::string field;
+    if (!std::getline(fields, field, ',')) return false;
+    char* end = nullptr;
+    switch (parsed[i].metadata->type) {
+      case ValueType::kokkos_value_int64:
+        parsed[i].value.int_value = std::strtoll(field.c_str(), &end, 10);
+        if (end == field.c_str()) return false;
+        break;
+      case ValueType::kokkos_value_double:
+        parsed[i].value.double_value = std::strtod(field.c_str(), &end);
+        if (end == field.c_str()) return false;
+        break;
+      default:
+        std::snprintf(parsed[i].value.string_value,
+                      sizeof(parsed[i].value.string_value), "%s",
+                      field.c_str());
+    }
+  }
+  std::copy(parsed.begin(), parsed.end(), values);
+  return true;
+}
+
+std::string make_signature() {
+  std::string model = Kokkos::Impl::host_cpu_model();
+  if (model.empty()) model = "unknown cpu";
+  std::ostringstream signature;
+  signature << sanitize(model) << ';' << DefaultExecutionSpace::name() << ' '
+            << DefaultExecutionSpace::concurrency() << ';'
+            << DefaultHostExecutionSpace::name() << ' '
+            << DefaultHostExecutionSpace::concurrency() << ";Kokkos "
+            << KOKKOS_VERSION;
+  return signature.str();
+}
+
+void read_cache() {
+  std::ifstream in(g_cache_file);
+  std::string line;
+  if (!std::getline(in, line)) return;
+  if (line != cache_header) {
+    std::cerr << "Kokkos::Tuning: ignoring " << g_cache_file
+              << ", which is not a tuning cache of this version" << std::endl;
+    return;
+  }
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    std::string signature, key, values, seconds, samples;
+    if (std::getline(fields, signature, '\t') &&
+        std::getline(fields, key, '\t') &&
+        std::getline(fields, values, '\t') &&
+        std::getline(fields, seconds, '\t') && std::getline(fields, samples)) {
+      Entry& entry  = g_entries[std::make_pair(signature, key)];
+      entry.values  = values;
+      entry.seconds = std::strtod(seconds.c_str(), nullptr);
+      entry.samples = std::strtoull(samples.c_str(), nullptr, 10);
+    }
+  }
+}
+
+void write_cache() {
+  for (const auto& measured : g_measured) {
+    // The fastest of the answers the search settled on, if any
+    const Entry* settled = nullptr;
+    for (const auto& answer : measured.second) {
+      if (answer.second.samples >= settled_samples &&
+          (settled == nullptr || answer.second.seconds < settled->seconds)) {
+        settled = &answer.second;
+      }
+    }
+    if (settled == nullptr) continue;
+    Entry& entry = g_entries[std::make_pair(g_signature, measured.first)];
+    if (entry.samples == 0 || settled->seconds < entry.seconds) {
+      entry.values  = settled->values;
+      entry.seconds = settled->seconds;
+    }
+    entry.samples += settled->samples;
+  }
+  // Replace the file at once so that a concurrent run reads either version
+  const std::string temporary = g_cache_file + ".tmp";
+  {
+    std::ofstream out(temporary);
+    if (!out) {
+      std::cerr << "Kokkos::Tuning: unable to write the tuning cache "
+                << g_cache_file << std::endl;
+      return;
+    }
+    out.precision(9);
+    out << cache_header << '\n';
+    for (const auto& entry : g_entries) {
+      out << entry.first.first << '\t' << entry.first.second << '\t'
+          << entry.second.values << '\t' << entry.second.seconds << '\t'
+          << entry.second.samples << '\n';
+    }
+  }
+  if (std::rename(temporary.c_str(), g_cache_file.c_str()) != 0) {
+    std::cerr << "Kokkos::Tuning: unable to write the tuning cache "
+              << g_cache_file << std::endl;
+  }
+}
+
+}  // namespace
+
+void tuning_cache_initialize(const char* cache_file) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  g_cache_file = cache_file;
+  g_signature  = make_signature();
+  g_enabled    = true;
+  read_cache();
+}
+
+void tuning_cache_finalize() {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  if (!g_enabled) return;
+  write_cache();
+  g_enabled = false;
+  g_names.clear();
+  g_entries.clear();
+  g_measured.clear();
+  g_pending.clear();
+}
+
+bool tuning_cache_enabled() { return g_enabled; }
+
+void tuning_cache_declare_variable(size_t variable_id, const char* name) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  g_names[variable_id] = sanitize(name);
+}
+
+bool tuning_cache_request(size_t context_id, size_t num_inputs,
+                          const VariableValue* inputs, size_t num_outputs,
+                          VariableValue* values) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  // The kernel name and type inputs only exist while a tool observes
+  // kernels, the names of the outputs already identify the kernel
+  std::vector<std::pair<std::string, std::string>> features;
+  for (size_t i = 0; i < num_inputs; ++i) {
+    const auto& name = g_names[inputs[i].type_id];
+    if (name.compare(0, 14, "kokkos.kernel_") == 0) continue;
+    features.emplace_back(name, format_input(inputs[i]));
+  }
+  std::sort(features.begin(), features.end());
+  std::string key;
+  for (size_t i = 0; i < num_outputs; ++i) {
+    key += (i > 0 ? "," : "") + g_names[values[i].type_id];
+  }
+  for (const auto& feature : features) {
+    key += ';' + feature.first + '=' + feature.second;
+  }
+  auto entry = g_entries.find(std::make_pair(g_signature, key));
+  if (entry != g_entries.end() &&
+      parse_values(entry->second.values, num_outputs, values)) {
+    return true;
+  }
+  g_pending[context_id] = PendingContext{key, "", clock_type::now()};
+  return false;
+}
+
+void tuning_cache_answer(size_t context_id, size_t num_outputs,
+                         const VariableValue* values) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  auto pending = g_pending.find(context_id);
+  if (pending == g_pending.end()) return;
+  std::string formatted;
+  for (size_t i = 0; i < num_outputs; ++i) {
+    formatted += (i > 0 ? "," : "") + format_value(values[i]);
+  }
+  pending->second.values = formatted;
+  pending->second.start  = clock_type::now();
+}
+
+void tuning_cache_end_context(size_t context_id) {
+  const auto end = clock_type::now();
+  std::lock_guard<std::mutex> lock(g_mutex);
+  auto pending = g_pending.find(context_id);
+  if (pending == g_pending.end()) return;
+  if (!pending->second.values.empty()) {
+    const double seconds =
+        std::chrono::duration<double>(end - pending->second.start).count();
+    Entry& entry =
+        g_measured[pending->second.key][pending->second.values];
+    if (entry.samples == 0 || seconds < entry.seconds) {
+      entry.values  = pending->second.values;
+      entry.seconds = seconds;
+    }
+    ++entry.samples;
+  }
+  g_pending.erase(pending);
+}
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
@@ -0,0 +1,93 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_IMPL_KOKKOS_PROFILING_TUNINGCACHE_HPP
+#define KOKKOS_IMPL_KOKKOS_PROFILING_TUNINGCACHE_HPP
+
+#include <impl/Kokkos_Profiling_Interface.hpp>
+
+#include <cstddef>
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+/* Cache of tuning decisions kept across runs.
+ *
+ * Enabled by setting KOKKOS_TUNING_CACHE to the name of the cache file.  A
+ * request for output values is looked up by the names of the requested
+ * variables and the values of the context variables, where integer and
+ * floating point inputs that are intervals or ratios, such as the problem
+ * size, are rounded to a power of two.  Entries are further tagged with a
+ * signature of the hardware and of the configuration of Kokkos; entries of
+ * other signatures are kept but never used.  On a hit the values come from
+ * the cache and the tuning tool is not asked.  On a miss the tool's answer
+ * is timed until the end of its context.  At finalize, per key, the fastest
+ * of the answers the tool chose at least 8 times is stored, so a key only
+ * enters the cache once the tool's search settled for it; until then the
+ * tool keeps being asked.
+ */
+void tuning_cache_initialize(const char* cache_file);
+void tuning_cache_finalize();
+bool tuning_cache_enabled();
+
+void tuning_cache_declare_variable(size_t variable_id, const char* name);
+
+// Fills 'values' and returns true when the cache holds an answer
+bool tuning_cache_request(size_t context_id, size_t num_inputs,
+                          const Experimental::VariableValue* inputs,
+                          size_t num_outputs,
+                          Experimental::VariableValue* values);
+
+// Remembers the values chosen by the tool after a miss
+void tuning_cache_answer(size_t context_id, size_t num_outputs,
+                         const Experimental::VariableValue* values);
+
+void tuning_cache_end_context(size_t context_id);
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
+
+#endif  // KOKKOS_IMPL_KOKKOS_PROFILING_TUNINGCACHE_HPP
@@ -0,0 +1,360 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SIMD_AVX2_HPP
+#define KOKKOS_SIMD_AVX2_HPP
+
+#include <impl/Kokkos_BitOps.hpp>
+
+#include <immintrin.h>
+
+// SIMDOps specializations for simd_abi::avx2_fixed_size. Included from
+// Kokkos_SIMD.hpp when compiling host code with AVX2 enabled. Masks are
+// kept in vector registers with all bits of an active lane set, which is
+// the form produced by _mm256_cmp_* and consumed by blendv/maskload.
+
+namespace Kokkos {
+namespace Impl {
+
+template <>
+struct SIMDOps<double, Kokkos::Experimental::simd_abi::avx2_fixed_size<4>> {
+  enum : int { size = 4 };
+
+  struct reg {
+    __m256d v;
+  };
+  struct mask {
+    __m256d v;
+  };
+
+  static inline reg broadcast(double a) { return {_mm256_set1_pd(a)}; }
+  static inline reg load(double const* ptr) { return {_mm256_loadu_pd(ptr)}; }
+  static inline reg load_aligned(double const* ptr) {
+    return {_mm256_load_pd(ptr)};
+  }
+  static inline void store(double* ptr, reg const& a) {
+    _mm256_storeu_pd(ptr, a.v);
+  }
+  static inline void store_aligned(double* ptr, reg const& a) {
+    _mm256_store_pd(ptr, a.v);
+  }
+  static inline double get(reg const& a, int i) {
+    alignas(32) double tmp[size];
+    _mm256_store_pd(tmp, a.v);
+    return tmp[i];
+  }
+
+  static inline reg add(reg const& a, reg const& b) {
+    return {_mm256_add_pd(a.v, b.v)};
+  }
+  static inline reg sub(reg const& a, reg const& b) {
+    return {_mm256_sub_pd(a.v, b.v)};
+  }
+  static inline reg mul(reg const& a, reg const& b) {
+    return {_mm256_mul_pd(a.v, b.v)};
+  }
+  static inline reg div(reg const& a, reg const& b) {
+    return {_mm256_div_pd(a.v, b.v)};
+  }
+  static inline reg min(reg const& a, reg const& b) {
+    return {_mm256_min_pd(a.v, b.v)};
+  }
+  static inline reg max(reg const& a, reg const& b) {
+    return {_mm256_max_pd(a.v, b.v)};
+  }
+  static inline reg neg(reg const& a) {
+    return {_mm256_xor_pd(a.v, _mm256_set1_pd(-0.0))};
+  }
+  static inline reg abs(reg const& a) {
+    return {_mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v)};
+  }
+  static inline reg sqrt(reg const& a) { return {_mm256_sqrt_pd(a.v)}; }
+  static inline reg fma(reg const& a, reg const& b, reg const& c) {
+#ifdef __FMA__
+    return {_mm256_fmadd_pd(a.v, b.v, c.v)};
+#else
+    return {_mm256_add_pd(_mm256_mul_pd(a.v, b.v), c.v)};
+#endif
+  }
+
+  static inline mask cmp_eq(reg const& a, reg const& b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ)};
+  }
+  static inline mask cmp_ne(reg const& a, reg const& b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_NEQ_UQ)};
+  }
+  static inline mask cmp_lt(reg const& a, reg const& b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)};
+  }
+  static inline mask cmp_le(reg const& a, reg const& b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ)};
+  }
+  static inline mask cmp_gt(reg const& a, reg const& b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ)};
+  }
+  static inline mask cmp_ge(reg const& a, reg const& b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ)};
+  }
+
+  static inline mask mask_broadcast(bool a) {
+    return {_mm256_castsi256_pd(_mm256_set1_epi64x(a ? -1 : 0))};
+  }
+  static inline mask mask_first(int n) {
+    return {_mm256_castsi256_pd(_mm256_cmpgt_epi64(
+        _mm256_set1_epi64x(n), _mm256_setr_epi64x(0, 1, 2, 3)))};
+  }
+  static inline bool mask_get(mask const& m, int i) {
+    return (_mm256_movemask_pd(m.v) >> i) & 1;
+  }
+  static inline mask mask_and(mask const& a, mask const& b) {
+    return {_mm256_and_pd(a.v, b.v)};
+  }
+  static inline mask mask_or(mask const& a, mask const& b) {
+    return {_mm256_or_pd(a.v, b.v)};
+  }
+  static inline mask mask_not(mask const& a) {
+    return {_mm256_xor_pd(a.v, mask_broadcast(true).v)};
+  }
+  static inline int popcount(mask const& a) {
+    return bit_count(unsigned(_mm256_movemask_pd(a.v)));
+  }
+
+  static inline reg blend(mask const& m, reg const& a, reg const& b) {
+    return {_mm256_blendv_pd(a.v, b.v, m.v)};
+  }
+  static inline reg masked_load(mask const& m, reg const& a,
+                                double const* ptr) {
+    return {_mm256_blendv_pd(
+        a.v, _mm256_maskload_pd(ptr, _mm256_castpd_si256(m.v)), m.v)};
+  }
+  static inline void masked_store(mask const& m, reg const& a, double* ptr) {
+    _mm256_maskstore_pd(ptr, _mm256_castpd_si256(m.v), a.v);
+  }
+  static inline reg gather(mask const& m, reg const& a, double const* ptr,
+                           std::int32_t const* index) {
+    return {_mm256_mask_i32gather_pd(
+        a.v, ptr, _mm_loadu_si128(reinterpret_cast<__m128i const*>(index)),
+        m.v, sizeof(double))};
+  }
+  // AVX2 has no scatter instruction
+  static inline void scatter(mask const& m, reg const& a, double* ptr,
+                             std::int32_t const* index) {
+    alignas(32) double tmp[size];
+    _mm256_store_pd(tmp, a.v);
+    int const bits = _mm256_movemask_pd(m.v);
+    for (int i = 0; i < size; ++i)
+      if ((bits >> i) & 1) ptr[index[i]] = tmp[i];
+  }
+
+  static inline double reduce_sum(reg const& a) {
+    __m128d const r = _mm_add_pd(_mm256_castpd256_pd128(a.v),
+                                 _mm256_extractf128_pd(a.v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(r, _mm_unpackhi_pd(r, r)));
+  }
+  static inline double reduce_min(reg const& a) {
+    __m128d const r = _mm_min_pd(_mm256_castpd256_pd128(a.v),
+                                 _mm256_extractf128_pd(a.v, 1));
+    return _mm_cvtsd_f64(_mm_min_sd(r, _mm_unpackhi_pd(r, r)));
+  }
+  static inline double reduce_max(reg const& a) {
+    __m128d const r = _mm_max_pd(_mm256_castpd256_pd128(a.v),
+                                 _mm256_extractf128_pd(a.v, 1));
+    return _mm_cvtsd_f64(_mm_max_sd(r, _mm_unpackhi_pd(r, r)));
+  }
+};
+
+template <>
+struct SIMDOps<float, Kokkos::Experimental::simd_abi::avx2_fixed_size<8>> {
+  enum : int { size = 8 };
+
+  struct reg {
+    __m256 v;
+  };
+  struct mask {
+    __m256 v;
+  };
+
+  static inline reg broadcast(float a) { return {_mm256_set1_ps(a)}; }
+  static inline reg load(float const* ptr) { return {_mm256_loadu_ps(ptr)}; }
+  static inline reg load_aligned(float const* ptr) {
+    return {_mm256_load_ps(ptr)};
+  }
+  static inline void store(float* ptr, reg const& a) {
+    _mm256_storeu_ps(ptr, a.v);
+  }
+  static inline void store_aligned(float* ptr, reg const& a) {
+    _mm256_store_ps(ptr, a.v);
+  }
+  static inline float get(reg const& a, int i) {
+    alignas(32) float tmp[size];
+    _mm256_store_ps(tmp, a.v);
+    return tmp[i];
+  }
+
+  static inline reg add(reg const& a, reg const& b) {
+    return {_mm256_add_ps(a.v, b.v)};
+  }
+  static inline reg sub(reg const& a, reg const& b) {
+    return {_mm256_sub_ps(a.v, b.v)};
+  }
+  static inline reg mul(reg const& a, reg const& b) {
+    return {_mm256_mul_ps(a.v, b.v)};
+  }
+  static inline reg div(reg const& a, reg const& b) {
+    return {_mm256_div_ps(a.v, b.v)};
+  }
+  static inline reg min(reg const& a, reg const& b) {
+    return {_mm256_min_ps(a.v, b.v)};
+  }
+  static inline reg max(reg const& a, reg const& b) {
+    return {_mm256_max_ps(a.v, b.v)};
+  }
+  static inline reg neg(reg const& a) {
+    return {_mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f))};
+  }
+  static inline reg abs(reg const& a) {
+    return {_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v)};
+  }
+  static inline reg sqrt(reg const& a) { return {_mm256_sqrt_ps(a.v)}; }
+  static inline reg fma(reg const& a, reg const& b, reg const& c) {
+#ifdef __FMA__
+    return {_mm256_fmadd_ps(a.v, b.v, c.v)};
+#else
+    return {_mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v)};
+#endif
+  }
+
+  static inline mask cmp_eq(reg const& a, reg const& b) {
+    return {_mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ)};
+  }
+  static inline mask cmp_ne(reg const& a, reg const& b) {
+    return {_mm256_cmp_ps(a.v, b.v, _CMP_NEQ_UQ)};
+  }
+  static inline mask cmp_lt(reg const& a, reg const& b) {
+    return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)};
+  }
+  static inline mask cmp_le(reg const& a, reg const& b) {
+    return {_mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ)};
+  }
+  static inline mask cmp_gt(reg const& a, reg const& b) {
+    return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)};
+  }
+  static inline mask cmp_ge(reg const& a, reg const& b) {
+    return {_mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ)};
+  }
+
+  static inline mask mask_broadcast(bool a) {
+    return {_mm256_castsi256_ps(_mm256_set1_epi32(a ? -1 : 0))};
+  }
+  static inline mask mask_first(int n) {
+    return {_mm256_castsi256_ps(_mm256_cmpgt_epi32(
+        _mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)))};
+  }
+  static inline bool mask_get(mask const& m, int i) {
+    return (_mm256_movemask_ps(m.v) >> i) & 1;
+  }
+  static inline mask mask_and(mask const& a, mask const& b) {
+    return {_mm256_and_ps(a.v, b.v)};
+  }
+  static inline mask mask_or(mask const& a, mask const& b) {
+    return {_mm256_or_ps(a.v, b.v)};
+  }
+  static inline mask mask_not(mask const& a) {
+    return {_mm256_xor_ps(a.v, mask_broadcast(true).v)};
+  }
+  static inline int popcount(mask const& a) {
+    return bit_count(unsigned(_mm256_movemask_ps(a.v)));
+  }
+
+  static inline reg blend(mask const& m, reg const& a, reg const& b) {
+    return {_mm256_blendv_ps(a.v, b.v, m.v)};
+  }
+  static inline reg masked_load(mask const& m, reg const& a,
+                                float const* ptr) {
+    return {_mm256_blendv_ps(
+        a.v, _mm256_maskload_ps(ptr, _mm256_castps_si256(m.v)), m.v)};
+  }
+  static inline void masked_store(mask const& m, reg const& a, float* ptr) {
+    _mm256_maskstore_ps(ptr, _mm256_castps_si256(m.v), a.v);
+  }
+  static inline reg gather(mask const& m, reg const& a, float const* ptr,
+                           std::int32_t const* index) {
+    return {_mm256_mask_i32gather_ps(
+        a.v, ptr, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(index)),
+        m.v, sizeof(float))};
+  }
+  // AVX2 has no scatter instruction
+  static inline void scatter(mask const& m, reg const& a, float* ptr,
+                             std::int32_t const* index) {
+    alignas(32) float tmp[size];
+    _mm256_store_ps(tmp, a.v);
+    int const bits = _mm256_movemask_ps(m.v);
+    for (int i = 0; i < size; ++i)
+      if ((bits >> i) & 1) ptr[index[i]] = tmp[i];
+  }
+
+  static inline float reduce_sum(reg const& a) {
+    __m128 r = _mm_add_ps(_mm256_castps256_ps128(a.v),
+                          _mm256_extractf128_ps(a.v, 1));
+    r        = _mm_add_ps(r, _mm_movehl_ps(r, r));
+    return _mm_cvtss_f32(_mm_add_ss(r, _mm_movehdup_ps(r)));
+  }
+  static inline float reduce_min(reg const& a) {
+    __m128 r = _mm_min_ps(_mm256_castps256_ps128(a.v),
+                          _mm256_extractf128_ps(a.v, 1));
+    r        = _mm_min_ps(r, _mm_movehl_ps(r, r));
+    return _mm_cvtss_f32(_mm_min_ss(r, _mm_movehdup_ps(r)));
+  }
+  static inline float reduce_max(reg const& a) {
+    __m128 r = _mm_max_ps(_mm256_castps256_ps128(a.v),
+                          _mm256_extractf128_ps(a.v, 1));
+    r        = _mm_max_ps(r, _mm_movehl_ps(r, r));
+    return _mm_cvtss_f32(_mm_max_ss(r, _mm_movehdup_ps(r)));
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,329 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SIMD_AVX512_HPP
+#define KOKKOS_SIMD_AVX512_HPP
+
+#include <impl/Kokkos_BitOps.hpp>
+
+#include <immintrin.h>
+
+// SIMDOps specializations for simd_abi::avx512_fixed_size. Included from
+// Kokkos_SIMD.hpp when compiling host code with AVX-512F enabled. Masks
+// live in the opmask registers, so masked loads, stores, gathers and
+// scatters map onto single instructions.
+
+// GCC implements the unmasked AVX-512 intrinsics on top of an undefined
+// pass-through register (_mm512_reduce_add_pd extracts its upper half from
+// one) and warns about it once the intrinsics are inlined into these
+// wrappers. The pragmas below silence those warnings here only.
+#if defined(KOKKOS_COMPILER_GNU)
+#define KOKKOS_IMPL_SIMD_AVX512_SUPPRESS_UNINITIALIZED
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+template <>
+struct SIMDOps<double, Kokkos::Experimental::simd_abi::avx512_fixed_size<8>> {
+  enum : int { size = 8 };
+
+  struct reg {
+    __m512d v;
+  };
+  struct mask {
+    __mmask8 v;
+  };
+
+  static inline reg broadcast(double a) { return {_mm512_set1_pd(a)}; }
+  static inline reg load(double const* ptr) { return {_mm512_loadu_pd(ptr)}; }
+  static inline reg load_aligned(double const* ptr) {
+    return {_mm512_load_pd(ptr)};
+  }
+  static inline void store(double* ptr, reg const& a) {
+    _mm512_storeu_pd(ptr, a.v);
+  }
+  static inline void store_aligned(double* ptr, reg const& a) {
+    _mm512_store_pd(ptr, a.v);
+  }
+  static inline double get(reg const& a, int i) {
+    alignas(64) double tmp[size];
+    _mm512_store_pd(tmp, a.v);
+    return tmp[i];
+  }
+
+  static inline reg add(reg const& a, reg const& b) {
+    return {_mm512_add_pd(a.v, b.v)};
+  }
+  static inline reg sub(reg const& a, reg const& b) {
+    return {_mm512_sub_pd(a.v, b.v)};
+  }
+  static inline reg mul(reg const& a, reg const& b) {
+    return {_mm512_mul_pd(a.v, b.v)};
+  }
+  static inline reg div(reg const& a, reg const& b) {
+    return {_mm512_div_pd(a.v, b.v)};
+  }
+  static inline reg min(reg const& a, reg const& b) {
+    return {_mm512_min_pd(a.v, b.v)};
+  }
+  static inline reg max(reg const& a, reg const& b) {
+    return {_mm512_max_pd(a.v, b.v)};
+  }
+  static inline reg neg(reg const& a) {
+    return {_mm512_castsi512_pd(
+        _mm512_xor_si512(_mm512_castpd_si512(a.v),
+                         _mm512_castpd_si512(_mm512_set1_pd(-0.0))))};
+  }
+  static inline reg abs(reg const& a) { return {_mm512_abs_pd(a.v)}; }
+  static inline reg sqrt(reg const& a) { return {_mm512_sqrt_pd(a.v)}; }
+  static inline reg fma(reg const& a, reg const& b, reg const& c) {
+    return {_mm512_fmadd_pd(a.v, b.v, c.v)};
+  }
+
+  static inline mask cmp_eq(reg const& a, reg const& b) {
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_EQ_OQ)};
+  }
+  static inline mask cmp_ne(reg const& a, reg const& b) {
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_NEQ_UQ)};
+  }
+  static inline mask cmp_lt(reg const& a, reg const& b) {
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ)};
+  }
+  static inline mask cmp_le(reg const& a, reg const& b) {
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_LE_OQ)};
+  }
+  static inline mask cmp_gt(reg const& a, reg const& b) {
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_GT_OQ)};
+  }
+  static inline mask cmp_ge(reg const& a, reg const& b) {
+    return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_GE_OQ)};
+  }
+
+  static inline mask mask_broadcast(bool a) {
+    return {__mmask8(a ? 0xFFu : 0u)};
+  }
+  static inline mask mask_first(int n) {
+    return {__mmask8(n <= 0 ? 0u : n >= size ? 0xFFu : (1u << n) - 1u)};
+  }
+  static inline bool mask_get(mask const& m, int i) { return (m.v >> i) & 1; }
+  static inline mask mask_and(mask const& a, mask const& b) {
+    return {__mmask8(a.v & b.v)};
+  }
+  static inline mask mask_or(mask const& a, mask const& b) {
+    return {__mmask8(a.v | b.v)};
+  }
+  static inline mask mask_not(mask const& a) { return {__mmask8(~a.v)}; }
+  static inline int popcount(mask const& a) { return bit_count(a.v); }
+
+  static inline reg blend(mask const& m, reg const& a, reg const& b) {
+    return {_mm512_mask_blend_pd(m.v, a.v, b.v)};
+  }
+  static inline reg masked_load(mask const& m, reg const& a,
+                                double const* ptr) {
+    return {_mm512_mask_loadu_pd(a.v, m.v, ptr)};
+  }
+  static inline void masked_store(mask const& m, reg const& a, double* ptr) {
+    _mm512_mask_storeu_pd(ptr, m.v, a.v);
+  }
+  static inline reg gather(mask const& m, reg const& a, double const* ptr,
+                           std::int32_t const* index) {
+    return {_mm512_mask_i32gather_pd(
+        a.v, m.v, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(index)),
+        ptr, sizeof(double))};
+  }
+  static inline void scatter(mask const& m, reg const& a, double* ptr,
+                             std::int32_t const* index) {
+    _mm512_mask_i32scatter_pd(
+        ptr, m.v, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(index)),
+        a.v, sizeof(double));
+  }
+
+  static inline double reduce_sum(reg const& a) {
+    return _mm512_reduce_add_pd(a.v);
+  }
+  static inline double reduce_min(reg const& a) {
+    return _mm512_reduce_min_pd(a.v);
+  }
+  static inline double reduce_max(reg const& a) {
+    return _mm512_reduce_max_pd(a.v);
+  }
+};
+
+template <>
+struct SIMDOps<float, Kokkos::Experimental::simd_abi::avx512_fixed_size<16>> {
+  enum : int { size = 16 };
+
+  struct reg {
+    __m512 v;
+  };
+  struct mask {
+    __mmask16 v;
+  };
+
+  static inline reg broadcast(float a) { return {_mm512_set1_ps(a)}; }
+  static inline reg load(float const* ptr) { return {_mm512_loadu_ps(ptr)}; }
+  static inline reg load_aligned(float const* ptr) {
+    return {_mm512_load_ps(ptr)};
+  }
+  static inline void store(float* ptr, reg const& a) {
+    _mm512_storeu_ps(ptr, a.v);
+  }
+  static inline void store_aligned(float* ptr, reg const& a) {
+    _mm512_store_ps(ptr, a.v);
+  }
+  static inline float get(reg const& a, int i) {
+    alignas(64) float tmp[size];
+    _mm512_store_ps(tmp, a.v);
+    return tmp[i];
+  }
+
+  static inline reg add(reg const& a, reg const& b) {
+    return {_mm512_add_ps(a.v, b.v)};
+  }
+  static inline reg sub(reg const& a, reg const& b) {
+    return {_mm512_sub_ps(a.v, b.v)};
+  }
+  static inline reg mul(reg const& a, reg const& b) {
+    return {_mm512_mul_ps(a.v, b.v)};
+  }
+  static inline reg div(reg const& a, reg const& b) {
+    return {_mm512_div_ps(a.v, b.v)};
+  }
+  static inline reg min(reg const& a, reg const& b) {
+    return {_mm512_min_ps(a.v, b.v)};
+  }
+  static inline reg max(reg const& a, reg const& b) {
+    return {_mm512_max_ps(a.v, b.v)};
+  }
+  static inline reg neg(reg const& a) {
+    return {_mm512_castsi512_ps(
+        _mm512_xor_si512(_mm512_castps_si512(a.v),
+                         _mm512_castps_si512(_mm512_set1_ps(-0.0f))))};
+  }
+  static inline reg abs(reg const& a) { return {_mm512_abs_ps(a.v)}; }
+  static inline reg sqrt(reg const& a) { return {_mm512_sqrt_ps(a.v)}; }
+  static inline reg fma(reg const& a, reg const& b, reg const& c) {
+    return {_mm512_fmadd_ps(a.v, b.v, c.v)};
+  }
+
+  static inline mask cmp_eq(reg const& a, reg const& b) {
+    return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_EQ_OQ)};
+  }
+  static inline mask cmp_ne(reg const& a, reg const& b) {
+    return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_NEQ_UQ)};
+  }
+  static inline mask cmp_lt(reg const& a, reg const& b) {
+    return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ)};
+  }
+  static inline mask cmp_le(reg const& a, reg const& b) {
+    return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_LE_OQ)};
+  }
+  static inline mask cmp_gt(reg const& a, reg const& b) {
+    return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_GT_OQ)};
+  }
+  static inline mask cmp_ge(reg const& a, reg const& b) {
+    return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_GE_OQ)};
+  }
+
+  static inline mask mask_broadcast(bool a) {
+    return {__mmask16(a ? 0xFFFFu : 0u)};
+  }
+  static inline mask mask_first(int n) {
+    return {__mmask16(n <= 0 ? 0u : n >= size ? 0xFFFFu : (1u << n) - 1u)};
+  }
+  static inline bool mask_get(mask const& m, int i) { return (m.v >> i) & 1; }
+  static inline mask mask_and(mask const& a, mask const& b) {
+    return {__mmask16(a.v & b.v)};
+  }
+  static inline mask mask_or(mask const& a, mask const& b) {
+    return {__mmask16(a.v | b.v)};
+  }
+  static inline mask mask_not(mask const& a) { return {__mmask16(~a.v)}; }
+  static inline int popcount(mask const& a) { return bit_count(a.v); }
+
+  static inline reg blend(mask const& m, reg const& a, reg const& b) {
+    return {_mm512_mask_blend_ps(m.v, a.v, b.v)};
+  }
+  static inline reg masked_load(mask const& m, reg const& a,
+                                float const* ptr) {
+    return {_mm512_mask_loadu_ps(a.v, m.v, ptr)};
+  }
+  static inline void masked_store(mask const& m, reg const& a, float* ptr) {
+    _mm512_mask_storeu_ps(ptr, m.v, a.v);
+  }
+  static inline reg gather(mask const& m, reg const& a, float const* ptr,
+                           std::int32_t const* index) {
+    return {_mm512_mask_i32gather_ps(
+        a.v, m.v, _mm512_loadu_si512(index), ptr, sizeof(float))};
+  }
+  static inline void scatter(mask const& m, reg const& a, float* ptr,
+                             std::int32_t const* index) {
+    _mm512_mask_i32scatter_ps(ptr, m.v, _mm512_loadu_si512(index), a.v,
+                              sizeof(float));
+  }
+
+  static inline float reduce_sum(reg const& a) {
+    return _mm512_reduce_add_ps(a.v);
+  }
+  static inline float reduce_min(reg const& a) {
+    return _mm512_reduce_min_ps(a.v);
+  }
+  static inline float reduce_max(reg const& a) {
+    return _mm512_reduce_max_ps(a.v);
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_SIMD_AVX512_SUPPRESS_UNINITIALIZED
+#pragma GCC diagnostic pop
+#undef KOKKOS_IMPL_SIMD_AVX512_SUPPRESS_UNINITIALIZED
+#endif
+
+#endif
@@ -0,0 +1,323 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SIMD_NEON_HPP
+#define KOKKOS_SIMD_NEON_HPP
+
+#include <arm_neon.h>
+
+// SIMDOps specializations for simd_abi::neon_fixed_size. Included from
+// Kokkos_SIMD.hpp when compiling host code for AArch64. NEON has no masked
+// memory instructions, so masked loads, stores, gathers and scatters go
+// through a lane loop that only touches memory of the active lanes.
+
+namespace Kokkos {
+namespace Impl {
+
+template <>
+struct SIMDOps<double, Kokkos::Experimental::simd_abi::neon_fixed_size<2>> {
+  enum : int { size = 2 };
+
+  struct reg {
+    float64x2_t v;
+  };
+  struct mask {
+    uint64x2_t v;
+  };
+
+  static inline reg broadcast(double a) { return {vdupq_n_f64(a)}; }
+  static inline reg load(double const* ptr) { return {vld1q_f64(ptr)}; }
+  static inline reg load_aligned(double const* ptr) {
+    return {vld1q_f64(ptr)};
+  }
+  static inline void store(double* ptr, reg const& a) { vst1q_f64(ptr, a.v); }
+  static inline void store_aligned(double* ptr, reg const& a) {
+    vst1q_f64(ptr, a.v);
+  }
+  static inline double get(reg const& a, int i) {
+    double tmp[size];
+    vst1q_f64(tmp, a.v);
+    return tmp[i];
+  }
+
+  static inline reg add(reg const& a, reg const& b) {
+    return {vaddq_f64(a.v, b.v)};
+  }
+  static inline reg sub(reg const& a, reg const& b) {
+    return {vsubq_f64(a.v, b.v)};
+  }
+  static inline reg mul(reg const& a, reg const& b) {
+    return {vmulq_f64(a.v, b.v)};
+  }
+  static inline reg div(reg const& a, reg const& b) {
+    return {vdivq_f64(a.v, b.v)};
+  }
+  static inline reg min(reg const& a, reg const& b) {
+    return {vminq_f64(a.v, b.v)};
+  }
+  static inline reg max(reg const& a, reg const& b) {
+    return {vmaxq_f64(a.v, b.v)};
+  }
+  static inline reg neg(reg const& a) { return {vnegq_f64(a.v)}; }
+  static inline reg abs(reg const& a) { return {vabsq_f64(a.v)}; }
+  static inline reg sqrt(reg const& a) { return {vsqrtq_f64(a.v)}; }
+  static inline reg fma(reg const& a, reg const& b, reg const& c) {
+    return {vfmaq_f64(c.v, a.v, b.v)};
+  }
+
+  static inline mask cmp_eq(reg const& a, reg const& b) {
+    return {vceqq_f64(a.v, b.v)};
+  }
+  static inline mask cmp_ne(reg const& a, reg const& b) {
+    return mask_not(cmp_eq(a, b));
+  }
+  static inline mask cmp_lt(reg const& a, reg const& b) {
+    return {vcltq_f64(a.v, b.v)};
+  }
+  static inline mask cmp_le(reg const& a, reg const& b) {
+    return {vcleq_f64(a.v, b.v)};
+  }
+  static inline mask cmp_gt(reg const& a, reg const& b) {
+    return {vcgtq_f64(a.v, b.v)};
+  }
+  static inline mask cmp_ge(reg const& a, reg const& b) {
+    return {vcgeq_f64(a.v, b.v)};
+  }
+
+  static inline mask mask_broadcast(bool a) {
+    return {vdupq_n_u64(a ? ~uint64_t(0) : uint64_t(0))};
+  }
+  static inline mask mask_first(int n) {
+    int64_t const lanes[size] = {0, 1};
+    return {vcltq_s64(vld1q_s64(lanes), vdupq_n_s64(n))};
+  }
+  static inline bool mask_get(mask const& m, int i) {
+    uint64_t tmp[size];
+    vst1q_u64(tmp, m.v);
+    return tmp[i] != 0;
+  }
+  static inline mask mask_and(mask const& a, mask const& b) {
+    return {vandq_u64(a.v, b.v)};
+  }
+  static inline mask mask_or(mask const& a, mask const& b) {
+    return {vorrq_u64(a.v, b.v)};
+  }
+  static inline mask mask_not(mask const& a) {
+    return {veorq_u64(a.v, vdupq_n_u64(~uint64_t(0)))};
+  }
+  static inline int popcount(mask const& a) {
+    return int(vaddvq_u64(vshrq_n_u64(a.v, 63)));
+  }
+
+  static inline reg blend(mask const& m, reg const& a, reg const& b) {
+    return {vbslq_f64(m.v, b.v, a.v)};
+  }
+  static inline reg masked_load(mask const& m, reg const& a,
+                                double const* ptr) {
+    double tmp[size];
+    vst1q_f64(tmp, a.v);
+    for (int i = 0; i < size; ++i)
+      if (mask_get(m, i)) tmp[i] = ptr[i];
+    return {vld1q_f64(tmp)};
+  }
+  static inline void masked_store(mask const& m, reg const& a, double* ptr) {
+    double tmp[size];
+    vst1q_f64(tmp, a.v);
+    for (int i = 0; i < size; ++i)
+      if (mask_get(m, i)) ptr[i] = tmp[i];
+  }
+  static inline reg gather(mask const& m, reg const& a, double const* ptr,
+                           std::int32_t const* index) {
+    double tmp[size];
+    vst1q_f64(tmp, a.v);
+    for (int i = 0; i < size; ++i)
+      if (mask_get(m, i)) tmp[i] = ptr[index[i]];
+    return {vld1q_f64(tmp)};
+  }
+  static inline void scatter(mask const& m, reg const& a, double* ptr,
+                             std::int32_t const* index) {
+    double tmp[size];
+    vst1q_f64(tmp, a.v);
+    for (int i = 0; i < size; ++i)
+      if (mask_get(m, i)) ptr[index[i]] = tmp[i];
+  }
+
+  static inline double reduce_sum(reg const& a) { return vaddvq_f64(a.v); }
+  static inline double reduce_min(reg const& a) { return vminvq_f64(a.v); }
+  static inline double reduce_max(reg const& a) { return vmaxvq_f64(a.v); }
+};
+
+template <>
+struct SIMDOps<float, Kokkos::Experimental::simd_abi::neon_fixed_size<4>> {
+  enum : int { size = 4 };
+
+  struct reg {
+    float32x4_t v;
+  };
+  struct mask {
+    uint32x4_t v;
+  };
+
+  static inline reg broadcast(float a) { return {vdupq_n_f32(a)}; }
+  static inline reg load(float const* ptr) { return {vld1q_f32(ptr)}; }
+  static inline reg load_aligned(float const* ptr) { return {vld1q_f32(ptr)}; }
+  static inline void store(float* ptr, reg const& a) { vst1q_f32(ptr, a.v); }
+  static inline void store_aligned(float* ptr, reg const& a) {
+    vst1q_f32(ptr, a.v);
+  }
+  static inline float get(reg const& a, int i) {
+    float tmp[size];
+    vst1q_f32(tmp, a.v);
+    return tmp[i];
+  }
+
+  static inline reg add(reg const& a, reg const& b) {
+    return {vaddq_f32(a.v, b.v)};
+  }
+  static inline reg sub(reg const& a, reg const& b) {
+    return {vsubq_f32(a.v, b.v)};
+  }
+  static inline reg mul(reg const& a, reg const& b) {
+    return {vmulq_f32(a.v, b.v)};
+  }
+  static inline reg div(reg const& a, reg const& b) {
+    return {vdivq_f32(a.v, b.v)};
+  }
+  static inline reg min(reg const& a, reg const& b) {
+    return {vminq_f32(a.v, b.v)};
+  }
+  static inline reg max(reg const& a, reg const& b) {
+    return {vmaxq_f32(a.v, b.v)};
+  }
+  static inline reg neg(reg const& a) { return {vnegq_f32(a.v)}; }
+  static inline reg abs(reg const& a) { return {vabsq_f32(a.v)}; }
+  static inline reg sqrt(reg const& a) { return {vsqrtq_f32(a.v)}; }
+  static inline reg fma(reg const& a, reg const& b, reg const& c) {
+    return {vfmaq_f32(c.v, a.v, b.v)};
+  }
+
+  static inline mask cmp_eq(reg const& a, reg const& b) {
+    return {vceqq_f32(a.v, b.v)};
+  }
+  static inline mask cmp_ne(reg const& a, reg const& b) {
+    return {vmvnq_u32(vceqq_f32(a.v, b.v))};
+  }
+  static inline mask cmp_lt(reg const& a, reg const& b) {
+    return {vcltq_f32(a.v, b.v)};
+  }
+  static inline mask cmp_le(reg const& a, reg const& b) {
+    return {vcleq_f32(a.v, b.v)};
+  }
+  static inline mask cmp_gt(reg const& a, reg const& b) {
+    return {vcgtq_f32(a.v, b.v)};
+  }
+  static inline mask cmp_ge(reg const& a, reg const& b) {
+    return {vcgeq_f32(a.v, b.v)};
+  }
+
+  static inline mask mask_broadcast(bool a) {
+    return {vdupq_n_u32(a ? ~uint32_t(0) : uint32_t(0))};
+  }
+  static inline mask mask_first(int n) {
+    int32_t const lanes[size] = {0, 1, 2, 3};
+    return {vcltq_s32(vld1q_s32(lanes), vdupq_n_s32(n))};
+  }
+  static inline bool mask_get(mask const& m, int i) {
+    uint32_t tmp[size];
+    vst1q_u32(tmp, m.v);
+    return tmp[i] != 0;
+  }
+  static inline mask mask_and(mask const& a, mask const& b) {
+    return {vandq_u32(a.v, b.v)};
+  }
+  static inline mask mask_or(mask const& a, mask const& b) {
+    return {vorrq_u32(a.v, b.v)};
+  }
+  static inline mask mask_not(mask const& a) { return {vmvnq_u32(a.v)}; }
+  static inline int popcount(mask const& a) {
+    return int(vaddvq_u32(vshrq_n_u32(a.v, 31)));
+  }
+
+  static inline reg blend(mask const& m, reg const& a, reg const& b) {
+    return {vbslq_f32(m.v, b.v, a.v)};
+  }
+  static inline reg masked_load(mask const& m, reg const& a,
+                                float const* ptr) {
+    float tmp[size];
+    vst1q_f32(tmp, a.v);
+    for (int i = 0; i < size; ++i)
+      if (mask_get(m, i)) tmp[i] = ptr[i];
+    return {vld1q_f32(tmp)};
+  }
+  static inline void masked_store(mask const& m, reg const& a, float* ptr) {
+    float tmp[size];
+    vst1q_f32(tmp, a.v);
+    for (int i = 0; i < size; ++i)
+      if (mask_get(m, i)) ptr[i] = tmp[i];
+  }
+  static inline reg gather(mask const& m, reg const& a, float const* ptr,
+                           std::int32_t const* index) {
+    float tmp[size];
+    vst1q_f32(tmp, a.v);
+    for (int i = 0; i < size; ++i)
+      if (mask_get(m, i)) tmp[i] = ptr[index[i]];
+    return {vld1q_f32(tmp)};
+  }
+  static inline void scatter(mask const& m, reg const& a, float* ptr,
+                             std::int32_t const* index) {
+    float tmp[size];
+    vst1q_f32(tmp, a.v);
+    for (int i = 0; i < size; ++i)
+      if (mask_get(m, i)) ptr[index[i]] = tmp[i];
+  }
+
+  static inline float reduce_sum(reg const& a) { return vaddvq_f32(a.v); }
+  static inline float reduce_min(reg const& a) { return vminvq_f32(a.v); }
+  static inline float reduce_max(reg const& a) { return vmaxvq_f32(a.v); }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -65,6 +65,7 @@
 #include <impl/Kokkos_TaskPolicyData.hpp>
 #include <impl/Kokkos_TaskTeamMember.hpp>
 #include <impl/Kokkos_EBO.hpp>
+#include <impl/Kokkos_Profiling_TaskTrace.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -192,6 +193,9 @@ class SimpleTaskScheduler
 
     auto rv = functor_future_type(&runnable_task);
 
+    Kokkos::Tools::Impl::task_trace_event(
+        Kokkos::Tools::Impl::TaskTraceEvent::spawn, &runnable_task);
+
     Kokkos::memory_fence();  // fence to ensure dependent stores are visible
 
     m_queue->schedule_runnable(std::move(runnable_task), team_scheduler_info());
@@ -62,6 +62,7 @@
 #include <impl/Kokkos_Atomic_Increment.hpp>
 #include <impl/Kokkos_OptionalRef.hpp>
 #include <impl/Kokkos_LIFO.hpp>
+#include <impl/Kokkos_Profiling_TaskTrace.hpp>
 
 #include <string>
 #include <typeinfo>
@@ -161,11 +162,15 @@ class SingleTaskQueue
     for (int i_priority = 0; i_priority < NumQueue; ++i_priority) {
       // Check for a team task with this priority
       return_value = m_ready_queues[i_priority][TaskTeam].pop();
-      if (return_value) return return_value;
+      if (return_value) break;
 
       // Check for a single task with this priority
       return_value = m_ready_queues[i_priority][TaskSingle].pop();
-      if (return_value) return return_value;
+      if (return_value) break;
+    }
+    if (return_value) {
+      Kokkos::Tools::Impl::task_trace_event(
+          Kokkos::Tools::Impl::TaskTraceEvent::start, &*return_value);
     }
     // if nothing was found, return a default-constructed (empty) OptionalRef
     return return_value;
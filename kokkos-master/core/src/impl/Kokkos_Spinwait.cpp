@@ -49,6 +49,8 @@
 #include <impl/Kokkos_Spinwait.hpp>
 #include <impl/Kokkos_BitOps.hpp>
 
+#include <algorithm>
+
 #if defined(KOKKOS_ENABLE_STDTHREAD) || defined(_WIN32)
 #include <thread>
 #elif !defined(_WIN32)
@@ -60,6 +62,14 @@
 #include <windows.h>
 #endif
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <climits>
+#include <ctime>
+#endif
+
 /*--------------------------------------------------------------------------*/
 
 namespace Kokkos {
@@ -151,6 +161,95 @@ void host_thread_yield(const uint32_t i, const WaitMode mode) {
 #endif /* defined( KOKKOS_ENABLE_ASM ) */
 }
 
+namespace {
+
+constexpr int default_spin_limit = 1 << 12;
+constexpr int min_spin_budget    = 1 << 4;
+
+// Longest a sleeping thread goes without checking its flag [ns]
+constexpr long sleep_timeout = 1000000;
+
+int g_spin_limit = default_spin_limit;
+
+// Number of threads sleeping in host_thread_wait_while_equal
+int g_sleeping_threads = 0;
+
+void sleep_while_equal(int volatile& flag, const int value) {
+#if defined(__linux__)
+  timespec req;
+  req.tv_sec  = 0;
+  req.tv_nsec = sleep_timeout;
+  syscall(SYS_futex, const_cast<int*>(&flag), FUTEX_WAIT_PRIVATE, value, &req,
+          nullptr, 0);
+#elif defined(KOKKOS_ENABLE_STDTHREAD) || defined(_WIN32)
+  (void)flag;
+  (void)value;
+  std::this_thread::sleep_for(std::chrono::microseconds(16));
+#else
+  (void)flag;
+  (void)value;
+  timespec req;
+  req.tv_sec  = 0;
+  req.tv_nsec = 16000;
+  nanosleep(&req, nullptr);
+#endif
+}
+
+}  // namespace
+
+void host_thread_wait_while_equal(int volatile& flag, const int value,
+                                  const WaitMode mode) {
+  // Spin iterations that recent waits of this thread needed
+  static thread_local int t_spin_estimate = default_spin_limit / 4;
+
+  const int limit = g_spin_limit;
+  const int budget =
+      WaitMode::PASSIVE == mode
+          ? 0
+          : std::max(std::min(2 * t_spin_estimate, limit),
+                     std::min(min_spin_budget, limit));
+
+  Kokkos::store_fence();
+
+  uint32_t i = 0;
+  while (value == flag && int(i) < budget) {
+    host_thread_yield(++i, WaitMode::ROOT);
+  }
+
+  if (value != flag) {
+    t_spin_estimate += (int(i) - t_spin_estimate) / 8;
+  } else {
+    // The wait outlasted the budget, so spinning was wasted
+    t_spin_estimate -= t_spin_estimate / 8;
+
+    Kokkos::atomic_increment(&g_sleeping_threads);
+    while (value == flag) {
+      sleep_while_equal(flag, value);
+    }
+    Kokkos::atomic_decrement(&g_sleeping_threads);
+  }
+
+  Kokkos::load_fence();
+}
+
+void host_thread_wake(int volatile& flag) {
+  // Orders the change of the flag before reading the number of sleepers;
+  // a sleeper increments it before the kernel checks the flag.
+  Kokkos::memory_fence();
+  if (0 < *((int volatile*)&g_sleeping_threads)) {
+#if defined(__linux__)
+    syscall(SYS_futex, const_cast<int*>(&flag), FUTEX_WAKE_PRIVATE, INT_MAX,
+            nullptr, nullptr, 0);
+#else
+    (void)flag;
+#endif
+  }
+}
+
+void host_thread_set_spin_limit(const int limit) {
+  g_spin_limit = limit < 0 ? default_spin_limit : limit;
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -65,6 +65,26 @@ enum class WaitMode : int {
 
 void host_thread_yield(const uint32_t i, const WaitMode mode);
 
+/* Block the calling thread while 'flag == value'.
+ *
+ * The thread first spins for a budget adapted to the duration of its recent
+ * waits: waits that end while spinning grow the budget, waits that outlast
+ * it shrink the budget. It then sleeps in the kernel (a futex on Linux)
+ * until 'host_thread_wake' is called on the flag. Sleeps are bounded, so a
+ * change of the flag without a wake is noticed late but never missed.
+ * WaitMode::PASSIVE skips the spinning.
+ */
+void host_thread_wait_while_equal(int volatile& flag, const int value,
+                                  const WaitMode mode = WaitMode::ACTIVE);
+
+/* Wake the threads sleeping on 'flag' after it has been changed. Cheap when
+ * no thread is sleeping. */
+void host_thread_wake(int volatile& flag);
+
+/* Upper bound of the adaptive spin budget in iterations, 0 to always sleep
+ * right away and -1 to restore the default. */
+void host_thread_set_spin_limit(const int limit);
+
 template <typename T>
 typename std::enable_if<std::is_integral<T>::value, void>::type
 root_spinwait_while_equal(T const volatile& flag, const T value) {
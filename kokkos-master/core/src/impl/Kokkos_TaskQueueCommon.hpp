@@ -61,6 +61,7 @@
 #include <impl/Kokkos_Atomic_Increment.hpp>
 #include <impl/Kokkos_OptionalRef.hpp>
 #include <impl/Kokkos_LIFO.hpp>
+#include <impl/Kokkos_Profiling_TaskTrace.hpp>
 
 #include <string>
 #include <typeinfo>
@@ -184,6 +185,10 @@ class TaskQueueCommonMixin {
   template <class TaskQueueTraits, class TeamSchedulerInfo>
   KOKKOS_FUNCTION void complete(RunnableTaskBase<TaskQueueTraits>&& task,
                                 TeamSchedulerInfo const& info) {
+    Kokkos::Tools::Impl::task_trace_event(
+        Kokkos::Tools::Impl::TaskTraceEvent::end, &task,
+        task.get_respawn_flag() ? Kokkos::Tools::Impl::task_trace_respawned
+                                : 0);
     if (task.get_respawn_flag()) {
       _self().schedule_runnable(std::move(task), info);
     } else {
@@ -294,6 +299,8 @@ class TaskQueueCommonMixin {
     }
     // Put it in the appropriate ready queue if it's ready
     else if (task_is_ready) {
+      Kokkos::Tools::Impl::task_trace_event(
+          Kokkos::Tools::Impl::TaskTraceEvent::ready, &task);
       // Increment the ready count
       _self()._increment_ready_count();
       // and enqueue the task
@@ -60,6 +60,7 @@
 #include <impl/Kokkos_Atomic_Increment.hpp>
 #include <impl/Kokkos_OptionalRef.hpp>
 #include <impl/Kokkos_LIFO.hpp>
+#include <impl/Kokkos_Profiling_TaskTrace.hpp>
 
 #include <string>
 #include <typeinfo>
@@ -109,6 +110,10 @@ class TaskQueueMemoryManager : public TaskQueueBase {
       // an approximation, which is probably fine...)
       if (m_max_alloc < m_count_alloc) m_max_alloc = m_count_alloc;
 
+      Kokkos::Tools::Impl::task_trace_pool_allocate(
+          static_cast<size_t>(requested_size), data != nullptr,
+          m_pool.capacity());
+
       return {data != nullptr, data};
     }
   }
@@ -199,6 +204,8 @@ class TaskQueueMemoryManager : public TaskQueueBase {
   template <class CountType>
   KOKKOS_INLINE_FUNCTION void deallocate(
       PoolAllocatedObjectBase<CountType>&& obj) {
+    Kokkos::Tools::Impl::task_trace_pool_deallocate(
+        static_cast<size_t>(obj.get_allocation_size()));
     m_pool.deallocate((void*)&obj, 1);
     Kokkos::atomic_decrement(&m_count_alloc);  // memory_order_relaxed
   }
@@ -353,4 +353,46 @@ TEST(TEST_CATEGORY, deep_copy_conversion) {
   Impl::TestDeepCopyScalarConversion<double, float, right, stride>().run_tests(
       N0, N1);
 }
+
+TEST(TEST_CATEGORY, deep_copy_async) {
+  using view_type =
+      Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace>;
+  const int N0 = 1000;
+  const int N1 = 37;
+
+  view_type b("B", N0, N1);
+  view_type c("C", N0, N1);
+  Kokkos::Experimental::HostCopyFuture copy_b;
+  {
+    // The source goes out of scope before the copy is waited for
+    view_type a("A", N0, N1);
+    for (int i = 0; i < N0; ++i)
+      for (int j = 0; j < N1; ++j) a(i, j) = i * N1 + j;
+    copy_b = Kokkos::Experimental::deep_copy_async(TEST_EXECSPACE(), b, a);
+  }
+  copy_b.wait();
+  ASSERT_TRUE(copy_b.is_ready());
+
+  // Copies complete in order, a fence waits for all of them
+  view_type d("D", N0, N1);
+  Kokkos::Experimental::deep_copy_async(TEST_EXECSPACE(), c, b);
+  Kokkos::Experimental::deep_copy_async(TEST_EXECSPACE(), d, c);
+  Kokkos::Experimental::deep_copy_async(TEST_EXECSPACE(), c, d);
+  TEST_EXECSPACE().fence();
+
+  int errors = 0;
+  for (int i = 0; i < N0; ++i)
+    for (int j = 0; j < N1; ++j)
+      if (b(i, j) != i * N1 + j || c(i, j) != i * N1 + j) ++errors;
+  ASSERT_EQ(errors, 0);
+
+  // Non-contiguous copies are synchronous
+  auto b_sub = Kokkos::subview(b, Kokkos::ALL(), std::make_pair(0, 5));
+  auto c_sub = Kokkos::subview(c, Kokkos::ALL(), std::make_pair(1, 6));
+  Kokkos::Experimental::HostCopyFuture copy_sub =
+      Kokkos::Experimental::deep_copy_async(TEST_EXECSPACE(), b_sub, c_sub);
+  ASSERT_TRUE(copy_sub.is_ready());
+  ASSERT_EQ(b(3, 0), c(3, 1));
+  ASSERT_EQ(b(3, 4), c(3, 5));
+}
 }  // namespace Test
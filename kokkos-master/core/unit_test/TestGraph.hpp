@@ -94,6 +94,15 @@ struct SetResultToViewFunctor {
   }
 };
 
+template <class ExecSpace>
+struct AxpbFunctor {
+  Kokkos::View<double*, ExecSpace> x;
+  Kokkos::View<double*, ExecSpace> y;
+  double a, b;
+
+  KOKKOS_FUNCTION void operator()(const int i) const { y(i) = a * x(i) + b; }
+};
+
 struct TEST_CATEGORY_FIXTURE(count_bugs) : public ::testing::Test {
  public:
   using count_functor      = CountTestFunctor<TEST_EXECSPACE>;
@@ -198,6 +207,73 @@ TEST_F(TEST_CATEGORY_FIXTURE(count_bugs), when_all_cycle) {
   //----------------------------------------
 }
 
+TEST_F(TEST_CATEGORY_FIXTURE(count_bugs), fan_out_repeat) {
+  view_type reduction_out{"reduction_out"};
+  view_host reduction_host{"reduction_host"};
+  auto graph = Kokkos::Experimental::create_graph(ex, [&](auto root) {
+    //----------------------------------------
+    // Independent kernels between a common predecessor and successor
+    auto f_setup = root.then_parallel_for(1, set_functor{count, 0});
+    auto f1 = f_setup.then_parallel_for(2, count_functor{count, bugs, 0, 8});
+    auto f2 = f_setup.then_parallel_for(3, count_functor{count, bugs, 0, 8});
+    auto f3 = f_setup.then_parallel_for(4, count_functor{count, bugs, 0, 8});
+    Kokkos::Experimental::when_all(f1, f2, f3)
+        .then_parallel_for(1, count_functor{count, bugs, 9, 9})
+        .then_parallel_reduce(1, set_result_functor{count}, reduction_out);
+    //----------------------------------------
+  });
+
+  //----------------------------------------
+  constexpr int repeats = 3;
+
+  for (int i = 0; i < repeats; ++i) {
+    graph.submit();
+    Kokkos::deep_copy(ex, reduction_host, reduction_out);
+    Kokkos::deep_copy(ex, bugs_host, bugs);
+    ex.fence();
+    ASSERT_EQ(10, reduction_host());
+    ASSERT_EQ(0, bugs_host());
+  }
+  //----------------------------------------
+}
+
+TEST(TEST_CATEGORY, graph_fusable_chain) {
+  using view_type = Kokkos::View<double*, TEST_EXECSPACE>;
+  using functor   = AxpbFunctor<TEST_EXECSPACE>;
+
+  const int n = 10000;
+  view_type x("x", n), y("y", n), z("z", n);
+  TEST_EXECSPACE ex{};
+
+  auto policy = Kokkos::Experimental::require(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(ex, 0, n),
+      Kokkos::Experimental::WorkItemProperty::HintFusable);
+
+  auto graph = Kokkos::Experimental::create_graph(ex, [&](auto root) {
+    // x = 1, y = 2 x + 1, x = 3 y - 1 may run fused, but z = x + 2 has to
+    // wait for all of x since it does not cover the same range
+    auto f1 = root.then_parallel_for(policy, functor{x, x, 0, 1})
+                  .then_parallel_for(policy, functor{x, y, 2, 1})
+                  .then_parallel_for(policy, functor{y, x, 3, -1});
+    f1.then_parallel_for(Kokkos::RangePolicy<TEST_EXECSPACE>(ex, 0, n / 2),
+                         functor{x, z, 1, 2});
+  });
+
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    graph.submit();
+    ex.fence();
+
+    auto x_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+    auto y_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+    auto z_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), z);
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(y_host(i), 3.0);
+      ASSERT_EQ(x_host(i), 8.0);
+      ASSERT_EQ(z_host(i), i < n / 2 ? 10.0 : 0.0);
+    }
+  }
+}
+
 // This test is disabled because we don't currently support copying to host,
 // even asynchronously. We _may_ want to do that eventually?
 TEST_F(TEST_CATEGORY_FIXTURE(count_bugs), DISABLED_repeat_chain) {
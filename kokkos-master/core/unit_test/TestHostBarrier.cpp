@@ -1,7 +1,189 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
 #include <gtest/gtest.h>
 
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_HostThreadTeam.hpp>
+
+#include <vector>
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
 namespace Test {
 
-TEST(host_barrier, openmp) {}
+#if defined(KOKKOS_ENABLE_OPENMP)
+
+namespace {
+
+using Kokkos::Impl::HostThreadTeamData;
+
+// A pool of 'pool_size' OpenMP threads organized with the given group size,
+// see Kokkos::Impl::host_thread_team_set_pool_group.
+struct TestHostPool {
+  std::vector<HostThreadTeamData> data;
+  std::vector<std::vector<int64_t>> scratch;
+  std::vector<HostThreadTeamData*> members;
+
+  TestHostPool(const int pool_size, const int group_size)
+      : data(pool_size), scratch(pool_size), members(pool_size) {
+    const size_t bytes =
+        HostThreadTeamData::scratch_size(sizeof(int64_t), 0, 0, 0);
+
+    for (int r = 0; r < pool_size; ++r) {
+      scratch[r].resize(bytes / sizeof(int64_t));
+      data[r].scratch_assign(scratch[r].data(), bytes, sizeof(int64_t), 0, 0,
+                             0);
+      members[r] = &data[r];
+    }
+
+    Kokkos::Impl::host_thread_team_set_pool_group(group_size);
+    HostThreadTeamData::organize_pool(members.data(), pool_size);
+    Kokkos::Impl::host_thread_team_set_pool_group(-1);
+  }
+
+  ~TestHostPool() {
+    for (auto& d : data) d.disband_pool();
+  }
+};
+
+void test_pool_rendezvous(const int pool_size, const int group_size) {
+  TestHostPool pool(pool_size, group_size);
+
+  constexpr int nrounds = 16;
+
+  int64_t arrived = 0;
+  int errors      = 0;
+  int nthreads    = 0;
+
+#pragma omp parallel num_threads(pool_size)
+  {
+    if (omp_get_num_threads() == pool_size) {
+      HostThreadTeamData& self = pool.data[omp_get_thread_num()];
+
+      if (self.pool_rank() == 0) nthreads = pool_size;
+
+      for (int round = 0; round < nrounds; ++round) {
+        Kokkos::atomic_increment(&arrived);
+
+        if (self.pool_rendezvous()) self.pool_rendezvous_release();
+
+        // Nobody may pass the rendezvous before all have arrived
+        if (Kokkos::atomic_fetch_add(&arrived, 0) !=
+            int64_t(pool_size) * (round + 1)) {
+          Kokkos::atomic_increment(&errors);
+        }
+
+        if (self.pool_rendezvous()) self.pool_rendezvous_release();
+      }
+    }
+  }
+
+  if (nthreads == pool_size) {
+    ASSERT_EQ(errors, 0);
+  }
+}
+
+void test_pool_reduce_group(const int pool_size, const int group_size) {
+  TestHostPool pool(pool_size, group_size);
+
+  int nthreads = 0;
+
+  for (int round = 0; round < 4; ++round) {
+#pragma omp parallel num_threads(pool_size)
+    {
+      if (omp_get_num_threads() == pool_size) {
+        HostThreadTeamData& self = pool.data[omp_get_thread_num()];
+
+        if (self.pool_rank() == 0) nthreads = pool_size;
+
+        *self.pool_reduce_local() = self.pool_rank() + 1 + round;
+
+        self.pool_reduce_group(
+            [](int64_t* dst, const int64_t* src) { *dst += *src; });
+      }
+    }
+
+    if (nthreads != pool_size) return;
+
+    const HostThreadTeamData& root = pool.data[0];
+    const int stride               = root.pool_group_size();
+
+    if (0 < group_size) {
+      ASSERT_EQ(stride, group_size < pool_size ? group_size : pool_size);
+    }
+
+    int64_t sum = *root.pool_reduce_local();
+    for (int r = stride; r < pool_size; r += stride) {
+      sum += *pool.data[r].pool_reduce_local();
+    }
+
+    ASSERT_EQ(sum, int64_t(pool_size) * (pool_size + 1) / 2 +
+                       int64_t(pool_size) * round);
+  }
+}
+
+}  // namespace
+
+TEST(host_barrier, pool_rendezvous) {
+  for (int pool_size : {1, 2, 5, 8, 13}) {
+    for (int group_size : {1, 0, 2, 3, 4, 64}) {
+      test_pool_rendezvous(pool_size, group_size);
+    }
+  }
+}
+
+TEST(host_barrier, pool_reduce_group) {
+  for (int pool_size : {1, 2, 5, 8, 13}) {
+    for (int group_size : {1, 0, 2, 3, 4, 64}) {
+      test_pool_reduce_group(pool_size, group_size);
+    }
+  }
+}
+
+#endif
 
 }  // namespace Test
@@ -0,0 +1,204 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_HostThreadTeam.hpp>
+#if defined(KOKKOS_ENABLE_TASKDAG)
+#include <impl/Kokkos_ChaseLev.hpp>
+#endif
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Test {
+
+namespace {
+
+using Kokkos::Impl::HostThreadTeamData;
+
+// Every index of [ 0 .. length ) is handed out exactly once while the
+// members of a pool of std::threads pop their own deque and steal from the
+// others.  Rank 0 is slow, so that the other members run out of work and
+// steal from it, and thieves push what is left of a stolen range into their
+// own deque, where it can be stolen again.
+void test_work_deque(const int pool_size, const int64_t length,
+                     const int chunk) {
+  std::vector<HostThreadTeamData> data(pool_size);
+  std::vector<std::vector<int64_t>> scratch(pool_size);
+  std::vector<HostThreadTeamData*> members(pool_size);
+
+  const size_t bytes =
+      HostThreadTeamData::scratch_size(sizeof(int64_t), 0, 0, 0);
+
+  for (int r = 0; r < pool_size; ++r) {
+    scratch[r].resize(bytes / sizeof(int64_t));
+    data[r].scratch_assign(scratch[r].data(), bytes, sizeof(int64_t), 0, 0, 0);
+    members[r] = &data[r];
+  }
+  HostThreadTeamData::organize_pool(members.data(), pool_size);
+
+  for (auto& d : data) d.set_work_partition(length, chunk);
+
+  std::vector<int> runs(length, 0);
+  std::vector<std::thread> threads;
+
+  for (int r = 0; r < pool_size; ++r) {
+    threads.emplace_back([&, r] {
+      HostThreadTeamData& self = data[r];
+      for (auto range = self.get_work_deque_chunk(); range.first != -1;
+           range       = self.get_work_deque_chunk()) {
+        for (int64_t i = range.first; i < range.second; ++i) {
+          Kokkos::atomic_increment(&runs[i]);
+        }
+        if (r == 0) std::this_thread::yield();
+      }
+    });
+  }
+  for (auto& t : threads) t.join();
+
+  for (auto& d : data) d.disband_pool();
+
+  int errors = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    if (runs[i] != 1) ++errors;
+  }
+  ASSERT_EQ(errors, 0);
+}
+
+#if defined(KOKKOS_ENABLE_TASKDAG)
+
+struct TestDequeNode : Kokkos::Impl::SimpleSinglyLinkedListNode<> {
+  int id = 0;
+};
+
+// A small buffer, so that the deque wraps around and fills up
+using test_deque_type = Kokkos::Impl::ChaseLevDeque<
+    TestDequeNode,
+    Kokkos::Impl::fixed_size_circular_buffer<
+        Kokkos::Impl::SimpleSinglyLinkedListNode<>, 64, int32_t>,
+    int32_t>;
+
+// The owner pushes every node and pops some of them back while the thieves
+// steal from the other end; every node must be run exactly once.
+void test_chase_lev_deque(const int num_thieves, const int num_nodes) {
+  test_deque_type deque;
+  std::vector<TestDequeNode> nodes(num_nodes);
+  std::vector<int> runs(num_nodes, 0);
+  std::atomic<bool> done(false);
+
+  for (int i = 0; i < num_nodes; ++i) nodes[i].id = i;
+
+  auto run = [&](TestDequeNode& node) {
+    Kokkos::atomic_increment(&runs[node.id]);
+  };
+
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < num_thieves; ++t) {
+    thieves.emplace_back([&] {
+      while (!done.load()) {
+        auto node = deque.steal();
+        if (node) {
+          run(*node);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  for (int i = 0; i < num_nodes; ++i) {
+    // Run the newest nodes when the deque is full, and now and then anyway
+    while (!deque.push(nodes[i])) {
+      auto node = deque.pop();
+      if (node) run(*node);
+    }
+    if (i % 7 == 0) {
+      auto node = deque.pop();
+      if (node) run(*node);
+    }
+    // Let the thieves in, even on a single core
+    if (i % 16 == 0) std::this_thread::yield();
+  }
+  for (auto node = deque.pop(); node; node = deque.pop()) run(*node);
+
+  done.store(true);
+  for (auto& t : thieves) t.join();
+
+  int errors = 0;
+  for (int i = 0; i < num_nodes; ++i) {
+    if (runs[i] != 1) ++errors;
+  }
+  ASSERT_EQ(errors, 0);
+  ASSERT_TRUE(deque.empty());
+}
+
+#endif
+
+}  // namespace
+
+TEST(host_work_deque, pop_steal) {
+  for (int pool_size : {1, 2, 3, 5, 8}) {
+    for (int chunk : {1, 3, 64}) {
+      test_work_deque(pool_size, 100000, chunk);
+      test_work_deque(pool_size, 7, chunk);
+    }
+  }
+}
+
+#if defined(KOKKOS_ENABLE_TASKDAG)
+
+TEST(host_work_deque, chase_lev_push_pop_steal) {
+  for (int num_thieves : {1, 2, 4}) {
+    for (int repeat = 0; repeat < 10; ++repeat) {
+      test_chase_lev_deque(num_thieves, 20000);
+    }
+  }
+}
+
+#endif
+
+}  // namespace Test
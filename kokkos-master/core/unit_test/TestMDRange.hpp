@@ -42,7 +42,10 @@
 //@HEADER
 */
 
+#include <algorithm>
+#include <array>
 #include <cstdio>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -3685,6 +3688,187 @@ struct TestMDRange_ReduceScalar {
   }
 };
 
+template <typename ExecSpace>
+struct TestMDRange_TileOrder {
+  using value_type = long;
+  using ViewType   = Kokkos::View<int ***, ExecSpace>;
+
+  ViewType count;
+  int lower[3];
+
+  TestMDRange_TileOrder(const int L0, const int L1, const int L2,
+                        const int N0, const int N1, const int N2)
+      : count("count", N0 - L0, N1 - L1, N2 - L2) {
+    lower[0] = L0;
+    lower[1] = L1;
+    lower[2] = L2;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k) const {
+    Kokkos::atomic_add(&count(i - lower[0], j - lower[1], k - lower[2]), 1);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k, long &lsum) const {
+    lsum += count(i - lower[0], j - lower[1], k - lower[2]);
+  }
+
+  template <class RangeType>
+  static void check(const int L0, const int L1, const int L2, const int N0,
+                    const int N1, const int N2,
+                    typename RangeType::tile_type const &tile,
+                    Kokkos::TileOrder order) {
+    RangeType range(typename RangeType::point_type{{L0, L1, L2}},
+                    typename RangeType::point_type{{N0, N1, N2}}, tile);
+    range.set_tile_order(order);
+    ASSERT_TRUE(range.tile_order() == order);
+
+    TestMDRange_TileOrder functor(L0, L1, L2, N0, N1, N2);
+    parallel_for(range, functor);
+    long sum = 0;
+    parallel_reduce(range, functor, sum);
+    ASSERT_EQ(sum, long(N0 - L0) * (N1 - L1) * (N2 - L2));
+
+    auto h_count =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), functor.count);
+    int errors = 0;
+    for (int i = 0; i < N0 - L0; ++i)
+      for (int j = 0; j < N1 - L1; ++j)
+        for (int k = 0; k < N2 - L2; ++k)
+          if (h_count(i, j, k) != 1) ++errors;
+    ASSERT_EQ(errors, 0);
+  }
+
+  static void test_tile_order(const int N0, const int N1, const int N2) {
+    using range_right =
+        Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<3>,
+                              Kokkos::IndexType<int>>;
+    using range_left =
+        Kokkos::MDRangePolicy<ExecSpace,
+                              Kokkos::Rank<3, Kokkos::Iterate::Left,
+                                           Kokkos::Iterate::Left>,
+                              Kokkos::IndexType<int>>;
+    for (auto order :
+         {Kokkos::TileOrder::Lexicographic, Kokkos::TileOrder::Morton}) {
+      check<range_right>(-1, 2, 0, N0, N1, N2, {{0, 0, 0}}, order);
+      check<range_right>(-1, 2, 0, N0, N1, N2, {{3, 5, 2}}, order);
+      check<range_left>(-1, 2, 0, N0, N1, N2, {{0, 0, 0}}, order);
+      check<range_left>(-1, 2, 0, N0, N1, N2, {{2, 3, 4}}, order);
+      // Ranges below zero whose last tile ends past the upper bound
+      check<range_right>(-5, -4, -3, 1, 2, 1, {{3, 4, 5}}, order);
+      check<range_left>(-5, -4, -3, 1, 2, 1, {{3, 4, 5}}, order);
+    }
+  }
+};
+
+template <typename ExecSpace>
+struct TestMDRange_DefaultTile {
+  using tile_array = std::array<std::int64_t, 3>;
+
+  static tile_array default_tile(const int rank, const bool inner_is_right,
+                                 tile_array span, tile_array tile,
+                                 const std::int64_t concurrency,
+                                 const std::int64_t budget) {
+    Kokkos::Impl::host_mdrange_default_tile(rank, inner_is_right, span.data(),
+                                            tile.data(), concurrency, budget);
+    return tile;
+  }
+
+  // The shapes chosen for a fixed budget, independent of the cache sizes
+  static void test_default_tile() {
+    // Whole rows in the innermost dimension, the rest of the budget for the
+    // outer one
+    ASSERT_EQ(default_tile(2, true, {{1000, 64}}, {{0, 0}}, 1, 1024),
+              (tile_array{{16, 64, 0}}));
+    ASSERT_EQ(default_tile(2, false, {{64, 1000}}, {{0, 0}}, 1, 1024),
+              (tile_array{{64, 16, 0}}));
+    // Rows longer than the budget are cut to it
+    ASSERT_EQ(default_tile(2, true, {{1000, 4096}}, {{0, 0}}, 1, 1024),
+              (tile_array{{1, 1024, 0}}));
+    // The outer dimensions share the budget evenly
+    ASSERT_EQ(default_tile(3, true, {{100, 100, 16}}, {{0, 0, 0}}, 1, 1024),
+              (tile_array{{8, 8, 16}}));
+
+    // Outer tiles are halved until there are 8 tiles per thread, then the
+    // inner ones
+    ASSERT_EQ(default_tile(2, true, {{64, 64}}, {{0, 0}}, 4, 4096),
+              (tile_array{{2, 64, 0}}));
+    ASSERT_EQ(default_tile(2, true, {{1, 64}}, {{0, 0}}, 4, 4096),
+              (tile_array{{1, 2, 0}}));
+    for (std::int64_t concurrency : {1, 3, 8, 64}) {
+      const tile_array span = {{37, 51, 29}};
+      const tile_array tile =
+          default_tile(3, true, span, {{0, 0, 0}}, concurrency, 4096);
+      std::int64_t num_tiles = 1;
+      for (int i = 0; i < 3; ++i) {
+        ASSERT_GE(tile[i], 1);
+        ASSERT_LE(tile[i], span[i]);
+        num_tiles *= (span[i] + tile[i] - 1) / tile[i];
+      }
+      ASSERT_GE(num_tiles, std::min<std::int64_t>(8 * concurrency,
+                                                  span[0] * span[1] * span[2]));
+    }
+
+    // Tiles given by the user are left untouched and use up their part of
+    // the budget
+    ASSERT_EQ(default_tile(2, true, {{100, 64}}, {{5, 0}}, 1, 1024),
+              (tile_array{{5, 64, 0}}));
+    ASSERT_EQ(default_tile(2, true, {{100, 64}}, {{0, 7}}, 1, 1024),
+              (tile_array{{100, 7, 0}}));
+    ASSERT_EQ(default_tile(3, true, {{10, 20, 30}}, {{3, 5, 2}}, 64, 1024),
+              (tile_array{{3, 5, 2}}));
+  }
+
+  // What the MDRangeTuner chooses among, and how it applies a choice
+  static void test_tile_candidates() {
+    using range_type =
+        Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<3>,
+                              Kokkos::IndexType<int>>;
+    using tile_type = typename range_type::tile_type;
+    if (!std::is_same<typename ExecSpace::memory_space,
+                      Kokkos::HostSpace>::value) {
+      return;
+    }
+
+    using point_type = typename range_type::point_type;
+
+    range_type explicit_range(point_type{{0, 0, 0}}, point_type{{17, 23, 9}},
+                              tile_type{{3, 5, 2}});
+    ASSERT_FALSE(explicit_range.impl_tune_tile_size());
+    ASSERT_EQ(explicit_range.m_tile[0], 3);
+    ASSERT_EQ(explicit_range.m_tile[1], 5);
+    ASSERT_EQ(explicit_range.m_tile[2], 2);
+
+    range_type range(point_type{{0, 0, 0}}, point_type{{17, 23, 9}},
+                     tile_type{{0, 4, 0}});
+    ASSERT_TRUE(range.impl_tune_tile_size());
+    const std::vector<tile_type> candidates =
+        range.impl_tile_size_candidates();
+    ASSERT_GE(candidates.size(), 1u);
+    for (size_t c = 0; c < candidates.size(); ++c) {
+      // The user's tile is kept by every candidate
+      ASSERT_EQ(candidates[c][1], 4);
+      for (size_t d = 0; d < c; ++d) {
+        ASSERT_FALSE(candidates[c][0] == candidates[d][0] &&
+                     candidates[c][1] == candidates[d][1] &&
+                     candidates[c][2] == candidates[d][2]);
+      }
+      range_type tuned = range;
+      tuned.impl_change_tile_size(candidates[c]);
+      for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(tuned.m_tile[i], candidates[c][i]);
+      }
+      ASSERT_EQ(tuned.m_num_tiles,
+                ((17 + candidates[c][0] - 1) / candidates[c][0]) *
+                    ((23 + candidates[c][1] - 1) / candidates[c][1]) *
+                    ((9 + candidates[c][2] - 1) / candidates[c][2]));
+      TestMDRange_TileOrder<ExecSpace>::template check<range_type>(
+          -1, 2, 0, 17, 23, 9, candidates[c], Kokkos::TileOrder::Lexicographic);
+    }
+  }
+};
+
 }  // namespace
 
 }  // namespace Test
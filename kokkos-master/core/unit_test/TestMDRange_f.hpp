@@ -50,4 +50,16 @@ TEST(TEST_CATEGORY, mdrange_scalar) {
   TestMDRange_ReduceScalar<TEST_EXECSPACE>::test_scalar_reduce(12, 11);
 }
 
+TEST(TEST_CATEGORY, mdrange_tile_order) {
+  TestMDRange_TileOrder<TEST_EXECSPACE>::test_tile_order(17, 23, 9);
+}
+
+TEST(TEST_CATEGORY, mdrange_default_tile) {
+  TestMDRange_DefaultTile<TEST_EXECSPACE>::test_default_tile();
+}
+
+TEST(TEST_CATEGORY, mdrange_tile_candidates) {
+  TestMDRange_DefaultTile<TEST_EXECSPACE>::test_tile_candidates();
+}
+
 }  // namespace Test
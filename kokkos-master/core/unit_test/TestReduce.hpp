@@ -249,6 +249,34 @@ class CombinedReduceFunctorSameType {
   }
 };
 
+template <class ExecSpace>
+struct LaneReduceFunctor {
+  struct TagMax {};
+  struct TagMinLoc {};
+
+  using minloc_type = typename Kokkos::MinLoc<double, int64_t>::value_type;
+
+  // Distinct values of both signs for i < 1009, so MinLoc has no ties
+  KOKKOS_INLINE_FUNCTION
+  static double value(const int64_t i) { return double((i * 97) % 1009) - 504; }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i, double& update) const { update += value(i); }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagMax, const int64_t i, double& update) const {
+    if (update < value(i)) update = value(i);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagMinLoc, const int64_t i, minloc_type& update) const {
+    if (value(i) < update.val) {
+      update.val = value(i);
+      update.loc = i;
+    }
+  }
+};
+
 namespace {
 
 template <typename ScalarType, class DeviceType>
@@ -551,4 +579,52 @@ TEST(TEST_CATEGORY, int_combined_reduce_mixed) {
   ASSERT_EQ(nsum, result2);
   ASSERT_EQ(nsum, result3_v());
 }
+
+// Host backends keep several partial results per thread for built-in
+// reducers; check ranges that are not a multiple of the number of lanes.
+TEST(TEST_CATEGORY, reduce_lanes_partial_range) {
+  using functor_type = LaneReduceFunctor<TEST_EXECSPACE>;
+  using minloc_type  = typename functor_type::minloc_type;
+
+  for (int64_t begin : {0, 1, 5}) {
+    for (int64_t end :
+         {begin, begin + 1, begin + 3, begin + 17, int64_t(1001)}) {
+      double sum_ref = 0;
+      double max_ref = -Kokkos::reduction_identity<double>::min();
+      minloc_type minloc_ref;
+      minloc_ref.val = Kokkos::reduction_identity<double>::min();
+      minloc_ref.loc = Kokkos::reduction_identity<int64_t>::min();
+      for (int64_t i = begin; i < end; ++i) {
+        const double v = functor_type::value(i);
+        sum_ref += v;
+        if (max_ref < v) max_ref = v;
+        if (v < minloc_ref.val) {
+          minloc_ref.val = v;
+          minloc_ref.loc = i;
+        }
+      }
+
+      double sum = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<TEST_EXECSPACE>(begin, end), functor_type(),
+          sum);
+      ASSERT_EQ(sum_ref, sum);
+
+      double max = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<TEST_EXECSPACE, functor_type::TagMax>(begin,
+                                                                    end),
+          functor_type(), Kokkos::Max<double>(max));
+      ASSERT_EQ(max_ref, max);
+
+      minloc_type minloc;
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<TEST_EXECSPACE, functor_type::TagMinLoc>(begin,
+                                                                       end),
+          functor_type(), Kokkos::MinLoc<double, int64_t>(minloc));
+      ASSERT_EQ(minloc_ref.val, minloc.val);
+      ASSERT_EQ(minloc_ref.loc, minloc.loc);
+    }
+  }
+}
 }  // namespace Test
@@ -0,0 +1,318 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+
+#include <vector>
+
+namespace Test {
+
+namespace {
+
+using Kokkos::Experimental::element_aligned_tag;
+using Kokkos::Experimental::simd;
+using Kokkos::Experimental::simd_mask;
+using Kokkos::Experimental::vector_aligned_tag;
+using Kokkos::Experimental::where;
+
+template <class T, class Abi>
+void test_simd_arithmetic() {
+  using simd_type = simd<T, Abi>;
+  constexpr int N = simd_type::size();
+
+  alignas(64) T a[N];
+  alignas(64) T b[N];
+  alignas(64) T c[N];
+  for (int i = 0; i < N; ++i) {
+    a[i] = T(i + 1);
+    b[i] = T(2 * N - i);
+  }
+
+  simd_type x(a, element_aligned_tag());
+  simd_type y;
+  y.copy_from(b, element_aligned_tag());
+
+  simd_type const sum  = x + y;
+  simd_type const diff = x - y;
+  simd_type const prod = x * T(2);
+  simd_type const quot = y / x;
+  simd_type const neg  = -x;
+  simd_type const f    = Kokkos::Experimental::fma(x, y, simd_type(T(1)));
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(sum[i], a[i] + b[i]);
+    ASSERT_EQ(diff[i], a[i] - b[i]);
+    ASSERT_EQ(prod[i], a[i] * T(2));
+    ASSERT_EQ(quot[i], b[i] / a[i]);
+    ASSERT_EQ(neg[i], -a[i]);
+    ASSERT_EQ(f[i], a[i] * b[i] + T(1));
+  }
+
+  simd_type const lo = Kokkos::Experimental::min(x, y);
+  simd_type const hi = Kokkos::Experimental::max(x, y);
+  simd_type const ab = Kokkos::Experimental::abs(neg);
+  simd_type const sq = Kokkos::Experimental::sqrt(x * x);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(lo[i], a[i] < b[i] ? a[i] : b[i]);
+    ASSERT_EQ(hi[i], a[i] < b[i] ? b[i] : a[i]);
+    ASSERT_EQ(ab[i], a[i]);
+    ASSERT_EQ(sq[i], a[i]);
+  }
+
+  x += y;
+  x *= simd_type(T(3));
+  x.copy_to(c, vector_aligned_tag());
+  for (int i = 0; i < N; ++i) ASSERT_EQ(c[i], (a[i] + b[i]) * T(3));
+
+  T expected_sum = 0;
+  for (int i = 0; i < N; ++i) expected_sum += b[i];
+  ASSERT_EQ(Kokkos::Experimental::reduce(y), expected_sum);
+  ASSERT_EQ(Kokkos::Experimental::hmin(y), T(N + 1));
+  ASSERT_EQ(Kokkos::Experimental::hmax(y), T(2 * N));
+}
+
+template <class T, class Abi>
+void test_simd_mask() {
+  using simd_type = simd<T, Abi>;
+  using mask_type = simd_mask<T, Abi>;
+  constexpr int N = simd_type::size();
+
+  alignas(64) T a[N];
+  for (int i = 0; i < N; ++i) a[i] = T(i);
+  simd_type const x(a, element_aligned_tag());
+  simd_type const half(T(N / 2));
+
+  mask_type const lt = x < half;
+  mask_type const ge = x >= half;
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(lt[i], i < N / 2);
+    ASSERT_EQ(ge[i], !(i < N / 2));
+    ASSERT_EQ((x == half)[i], i == N / 2);
+    ASSERT_EQ((x != half)[i], i != N / 2);
+    ASSERT_EQ((x <= half)[i], i <= N / 2);
+    ASSERT_EQ((x > half)[i], i > N / 2);
+    ASSERT_EQ((!lt)[i], ge[i]);
+    ASSERT_FALSE((lt && ge)[i]);
+    ASSERT_TRUE((lt || ge)[i]);
+  }
+  ASSERT_EQ(Kokkos::Experimental::popcount(lt), N / 2);
+  ASSERT_TRUE(Kokkos::Experimental::all_of(lt || ge));
+  ASSERT_TRUE(Kokkos::Experimental::none_of(lt && ge));
+  ASSERT_EQ(Kokkos::Experimental::any_of(lt), N > 1);
+
+  for (int n = 0; n <= N; ++n) {
+    mask_type const m = mask_type::first_n(n);
+    ASSERT_EQ(Kokkos::Experimental::popcount(m), n);
+    for (int i = 0; i < N; ++i) ASSERT_EQ(m[i], i < n);
+  }
+
+  simd_type y(T(-1));
+  where(lt, y) = x;
+  simd_type const z = Kokkos::Experimental::choose(lt, x, simd_type(T(-1)));
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(y[i], i < N / 2 ? a[i] : T(-1));
+    ASSERT_EQ(z[i], y[i]);
+  }
+
+  // masked reductions only see the selected lanes
+  T expected_sum = 0;
+  for (int i = N / 2; i < N; ++i) expected_sum += a[i];
+  ASSERT_EQ(Kokkos::Experimental::reduce(where(ge, x)), expected_sum);
+  ASSERT_EQ(Kokkos::Experimental::hmin(where(ge, x)), T(N / 2));
+  ASSERT_EQ(Kokkos::Experimental::hmax(where(!(x > half), x)), T(N / 2));
+}
+
+template <class T, class Abi>
+void test_simd_masked_memory() {
+  using simd_type  = simd<T, Abi>;
+  using mask_type  = simd_mask<T, Abi>;
+  using index_type = Kokkos::Experimental::simd_index<T, Abi>;
+  constexpr int N  = simd_type::size();
+
+  // tail loads and stores must not touch memory past the active lanes
+  std::vector<T> src(2 * N, T(-7));
+  std::vector<T> dst(2 * N, T(-5));
+  for (int n = 0; n <= N; ++n) {
+    for (int i = 0; i < n; ++i) src[N + i] = T(i + 1);
+    mask_type const m = mask_type::first_n(n);
+    simd_type x(T(0));
+    where(m, x).copy_from(src.data() + N, element_aligned_tag());
+    for (int i = 0; i < N; ++i) ASSERT_EQ(x[i], i < n ? T(i + 1) : T(0));
+    where(m, x).copy_to(dst.data() + N, element_aligned_tag());
+    for (int i = 0; i < N; ++i)
+      ASSERT_EQ(dst[N + i], i < n ? T(i + 1) : T(-5));
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(dst[i], T(-5));
+      dst[N + i] = T(-5);
+    }
+  }
+
+  // gather reverses, scatter writes every other element
+  std::vector<T> table(2 * N);
+  for (int i = 0; i < 2 * N; ++i) table[i] = T(10 * i);
+  std::int32_t idx[N];
+  for (int i = 0; i < N; ++i) idx[i] = 2 * N - 1 - i;
+  index_type reverse(idx, element_aligned_tag());
+  mask_type const m = mask_type::first_n(N - N / 2);
+  simd_type g(T(1));
+  where(m, g).gather_from(table.data(), reverse);
+  for (int i = 0; i < N; ++i)
+    ASSERT_EQ(g[i], m[i] ? table[2 * N - 1 - i] : T(1));
+
+  for (int i = 0; i < N; ++i) idx[i] = 2 * i;
+  index_type even(idx, element_aligned_tag());
+  std::vector<T> out(2 * N, T(0));
+  where(m, g).scatter_to(out.data(), even);
+  for (int i = 0; i < 2 * N; ++i) {
+    bool const written = i % 2 == 0 && m[i / 2];
+    ASSERT_EQ(out[i], written ? g[i / 2] : T(0));
+  }
+}
+
+template <class T, class Abi>
+void test_simd_abi() {
+  test_simd_arithmetic<T, Abi>();
+  test_simd_mask<T, Abi>();
+  test_simd_masked_memory<T, Abi>();
+}
+
+// simd_for over a ThreadVectorRange computing y = 2 * x + y, and a View
+// whose value type is a pack.
+template <class ExecSpace, class T>
+struct TestSIMDParallel {
+  using abi_type    = Kokkos::Experimental::simd_abi::ForSpace<ExecSpace, T>;
+  using simd_type   = simd<T, abi_type>;
+  using mask_type   = simd_mask<T, abi_type>;
+  using policy_type = Kokkos::TeamPolicy<ExecSpace>;
+  using member_type = typename policy_type::member_type;
+  using view_type   = Kokkos::View<T**, Kokkos::LayoutRight, ExecSpace>;
+
+  view_type m_x;
+  view_type m_y;
+
+  void run_simd_for(int nrows, int ncols) {
+    m_x = view_type("x", nrows, ncols);
+    m_y = view_type("y", nrows, ncols);
+    auto h_x = Kokkos::create_mirror_view(m_x);
+    auto h_y = Kokkos::create_mirror_view(m_y);
+    for (int r = 0; r < nrows; ++r)
+      for (int c = 0; c < ncols; ++c) {
+        h_x(r, c) = T(r + c);
+        h_y(r, c) = T(r);
+      }
+    Kokkos::deep_copy(m_x, h_x);
+    Kokkos::deep_copy(m_y, h_y);
+
+    Kokkos::parallel_for(policy_type(nrows, Kokkos::AUTO), *this);
+
+    Kokkos::deep_copy(h_y, m_y);
+    for (int r = 0; r < nrows; ++r)
+      for (int c = 0; c < ncols; ++c) ASSERT_EQ(h_y(r, c), T(2 * (r + c) + r));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(member_type const& member) const {
+    int const r = member.league_rank();
+    Kokkos::Experimental::simd_for<T, abi_type>(
+        Kokkos::ThreadVectorRange(member, int(m_x.extent(1))),
+        [&](int c, mask_type const& m) {
+          simd_type x(T(0));
+          simd_type y(T(0));
+          where(m, x).copy_from(&m_x(r, c), element_aligned_tag());
+          where(m, y).copy_from(&m_y(r, c), element_aligned_tag());
+          y = Kokkos::Experimental::fma(simd_type(T(2)), x, y);
+          where(m, y).copy_to(&m_y(r, c), element_aligned_tag());
+        });
+  }
+
+  void run_view_of_packs(int n) {
+    Kokkos::View<simd_type*, ExecSpace> packs("packs", n);
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecSpace>(0, n), KOKKOS_LAMBDA(int i) {
+          packs(i) = simd_type(T(i));
+        });
+    T sum = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<ExecSpace>(0, n),
+        KOKKOS_LAMBDA(int i, T& update) {
+          update += Kokkos::Experimental::reduce(packs(i) + simd_type(T(1)));
+        },
+        sum);
+    ASSERT_EQ(sum, T(simd_type::size()) * T(n) * T(n + 1) / T(2));
+
+    simd_type pack_sum;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<ExecSpace>(0, n),
+        KOKKOS_LAMBDA(int i, simd_type& update) { update += packs(i); },
+        Kokkos::Sum<simd_type>(pack_sum));
+    for (int l = 0; l < simd_type::size(); ++l)
+      ASSERT_EQ(pack_sum[l], T(n) * T(n - 1) / T(2));
+  }
+};
+
+}  // namespace
+
+TEST(TEST_CATEGORY, simd_abi) {
+  using namespace Kokkos::Experimental::simd_abi;
+  test_simd_abi<double, scalar>();
+  test_simd_abi<float, scalar>();
+  test_simd_abi<double, fixed_size<4>>();
+  test_simd_abi<float, fixed_size<8>>();
+  test_simd_abi<double, native<double>>();
+  test_simd_abi<float, native<float>>();
+}
+
+TEST(TEST_CATEGORY, simd_parallel) {
+  // simd_for is only available for host execution spaces
+#if !defined(KOKKOS_ENABLE_CUDA) && !defined(KOKKOS_ENABLE_HIP) && \
+    !defined(KOKKOS_ENABLE_SYCL) && !defined(KOKKOS_ENABLE_OPENMPTARGET)
+  TestSIMDParallel<TEST_EXECSPACE, double>().run_simd_for(5, 37);
+  TestSIMDParallel<TEST_EXECSPACE, float>().run_simd_for(3, 5);
+#endif
+  TestSIMDParallel<TEST_EXECSPACE, double>().run_view_of_packs(100);
+}
+
+}  // namespace Test
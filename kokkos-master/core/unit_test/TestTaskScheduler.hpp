@@ -52,6 +52,8 @@
 #include <cstdio>
 #include <iostream>
 #include <cmath>
+#include <algorithm>
+#include <vector>
 
 //==============================================================================
 // <editor-fold desc="TestFib"> {{{1
@@ -814,6 +816,102 @@ struct TestMultipleDependence {
 
 }  // namespace TestTaskScheduler
 
+//==============================================================================
+// <editor-fold desc="TestTaskContinuation"> {{{1
+
+namespace TestTaskScheduler {
+
+// A successor made ready by a completed task runs on the team that completed
+// it, after any task of higher priority made ready at the same time
+template <class Scheduler>
+struct TestTaskContinuation {
+  using sched_type  = Scheduler;
+  using future_type = Kokkos::BasicFuture<void, Scheduler>;
+  using record_type =
+      Kokkos::View<int*, typename sched_type::execution_space>;
+  using value_type = void;
+
+  enum Role : int { Root, Predecessor, Successor, Urgent };
+  enum Record : int {
+    Released,
+    PredecessorTeam,
+    SuccessorTeam,
+    Clock,
+    SuccessorTime,
+    UrgentTime,
+    RecordSize
+  };
+
+  Role m_role;
+  record_type m_record;
+
+  KOKKOS_INLINE_FUNCTION
+  TestTaskContinuation(Role role, const record_type& record)
+      : m_role(role), m_record(record) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(typename sched_type::member_type& member) {
+    if (m_role == Root) {
+      auto predecessor =
+          Kokkos::task_spawn(Kokkos::TaskSingle(member.scheduler()),
+                             TestTaskContinuation(Predecessor, m_record));
+      // The successor is spawned last so that it is the first one to be made
+      // ready when the predecessor completes
+      Kokkos::task_spawn(Kokkos::TaskSingle(member.scheduler(), predecessor,
+                                            Kokkos::TaskPriority::High),
+                         TestTaskContinuation(Urgent, m_record));
+      Kokkos::task_spawn(Kokkos::TaskSingle(member.scheduler(), predecessor),
+                         TestTaskContinuation(Successor, m_record));
+      Kokkos::atomic_exchange(&m_record(Released), 1);
+    } else if (m_role == Predecessor) {
+      // Complete only once both successors are waiting
+      if (Kokkos::atomic_fetch_add(&m_record(Released), 0) == 0) {
+        Kokkos::respawn(this, member.scheduler());
+        return;
+      }
+      m_record(PredecessorTeam) = member.league_rank();
+    } else if (m_role == Successor) {
+      m_record(SuccessorTeam) = member.league_rank();
+      m_record(SuccessorTime) = Kokkos::atomic_fetch_add(&m_record(Clock), 1);
+    } else {
+      m_record(UrgentTime) = Kokkos::atomic_fetch_add(&m_record(Clock), 1);
+    }
+  }
+
+  static void run() {
+    using memory_space = typename sched_type::memory_space;
+
+    enum { MemoryCapacity = 16000 };
+    enum { MinBlockSize = 64 };
+    enum { MaxBlockSize = 1024 };
+    enum { SuperBlockSize = 4096 };
+
+    sched_type sched(memory_space(), MemoryCapacity, MinBlockSize, MaxBlockSize,
+                     SuperBlockSize);
+
+    record_type record("record", RecordSize);
+
+    Kokkos::host_spawn(Kokkos::TaskSingle(sched),
+                       TestTaskContinuation(Root, record));
+
+    Kokkos::wait(sched);
+
+    auto host_record =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), record);
+
+    ASSERT_EQ(host_record(SuccessorTeam), host_record(PredecessorTeam));
+    // Another team may steal the urgent task and run it at any time
+    if (typename sched_type::execution_space().concurrency() == 1) {
+      ASSERT_LT(host_record(UrgentTime), host_record(SuccessorTime));
+    }
+  }
+};
+
+}  // namespace TestTaskScheduler
+
+// </editor-fold> end TestTaskContinuation }}}1
+//==============================================================================
+
 //----------------------------------------------------------------------------
 
 #define KOKKOS_PP_CAT_IMPL(x, y) x##y
@@ -852,6 +950,46 @@ struct TestMultipleDependence {
 #undef TEST_SCHEDULER_SUFFIX
 #endif
 
+namespace Test {
+
+// Host teams of the MultipleTaskQueue schedulers pass continuations
+TEST(TEST_CATEGORY, task_continuation) {
+  if (!Kokkos::SpaceAccessibility<TEST_EXECSPACE,
+                                  Kokkos::HostSpace>::accessible) {
+    return;
+  }
+  for (int i = 0; i < 20; ++i) {
+    TestTaskScheduler::TestTaskContinuation<
+        Kokkos::TaskSchedulerMultiple<TEST_EXECSPACE>>::run();
+#ifndef _WIN32
+    TestTaskScheduler::TestTaskContinuation<
+        Kokkos::ChaseLevTaskScheduler<TEST_EXECSPACE>>::run();
+#endif
+  }
+}
+
+TEST(TEST_CATEGORY, task_steal_nearest_team) {
+  for (int32_t n_teams = 1; n_teams < 10; ++n_teams) {
+    for (int32_t team = 0; team < n_teams; ++team) {
+      std::vector<bool> visited(n_teams, false);
+      visited[team] = true;
+      for (int32_t i = 1; i < n_teams; ++i) {
+        const int32_t victim =
+            Kokkos::Impl::multiple_task_queue_steal_victim(team, i, n_teams);
+        ASSERT_FALSE(visited[victim]);
+        visited[victim] = true;
+        // Distance along the ring of teams
+        const int32_t distance =
+            std::min((victim - team + n_teams) % n_teams,
+                     (team - victim + n_teams) % n_teams);
+        ASSERT_EQ(distance, (i + 1) / 2);
+      }
+    }
+  }
+}
+
+}  // namespace Test
+
 #if 0
 #define TEST_SCHEDULER_SUFFIX _fixed_mempool
 #define TEST_SCHEDULER                                                      \
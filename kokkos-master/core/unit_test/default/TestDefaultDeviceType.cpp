@@ -44,7 +44,11 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 #include <Kokkos_Core.hpp>
+#include <impl/Kokkos_HostSpace_cache.hpp>
 #include <default/TestDefaultDeviceType_Category.hpp>
 #include <TestHalfConversion.hpp>
 #include <TestHalfOperators.hpp>
@@ -72,6 +76,222 @@ TEST(TEST_CATEGORY, host_space_access) {
                 "");
 }
 
+TEST(TEST_CATEGORY, host_space_numa_policy) {
+  using view_type = Kokkos::View<double*, Kokkos::HostSpace>;
+  const size_t n  = 1 << 20;
+
+  for (auto policy :
+       {Kokkos::HostSpace::NUMA_DEFAULT, Kokkos::HostSpace::NUMA_FIRST_TOUCH,
+        Kokkos::HostSpace::NUMA_INTERLEAVE, Kokkos::HostSpace::NUMA_BIND}) {
+#if !defined(__linux__)
+    if (policy == Kokkos::HostSpace::NUMA_INTERLEAVE ||
+        policy == Kokkos::HostSpace::NUMA_BIND) {
+      continue;
+    }
+#endif
+    Kokkos::HostSpace space(policy);
+    ASSERT_EQ(space.numa_policy(), policy);
+
+    view_type a(Kokkos::view_alloc("NumaPolicy", space), n);
+    view_type b(
+        Kokkos::view_alloc("NumaPolicy", space, Kokkos::WithoutInitializing),
+        n);
+
+    Kokkos::deep_copy(b, 2.0);
+    Kokkos::deep_copy(a, b);
+
+    int errors = 0;
+    for (size_t i = 0; i < n; ++i) {
+      if (a(i) != 2.0) ++errors;
+    }
+    ASSERT_EQ(errors, 0);
+  }
+
+  ASSERT_THROW(Kokkos::HostSpace(Kokkos::HostSpace::NUMA_BIND, -1),
+               std::runtime_error);
+}
+
+TEST(TEST_CATEGORY, host_space_huge_pages) {
+  using view_type = Kokkos::View<double*, Kokkos::HostSpace>;
+
+  ASSERT_EQ(Kokkos::HostSpace().huge_pages(),
+            Kokkos::Impl::host_space_huge_pages());
+  ASSERT_EQ(
+      Kokkos::HostSpace(Kokkos::HostSpace::HUGE_PAGES_DEFAULT).huge_pages(),
+      Kokkos::Impl::host_space_huge_pages());
+
+  // Sizes below, at and above one 2M page, the explicit huge page modes
+  // fall back to transparent huge pages if the pool is empty
+  for (auto mode :
+       {Kokkos::HostSpace::HUGE_PAGES_OFF, Kokkos::HostSpace::HUGE_PAGES_THP,
+        Kokkos::HostSpace::HUGE_PAGES_2M, Kokkos::HostSpace::HUGE_PAGES_1G}) {
+    Kokkos::HostSpace space(mode);
+    ASSERT_EQ(space.huge_pages(), mode);
+
+    for (size_t n : {size_t(1000), size_t(1) << 18, (size_t(3) << 18) + 7}) {
+      view_type a(Kokkos::view_alloc("HugePages", space), n);
+      view_type b(
+          Kokkos::view_alloc("HugePages", space, Kokkos::WithoutInitializing),
+          n);
+
+      Kokkos::deep_copy(b, 3.0);
+      Kokkos::deep_copy(a, b);
+
+      int errors = 0;
+      for (size_t i = 0; i < n; ++i) {
+        if (a(i) != 3.0) ++errors;
+      }
+      ASSERT_EQ(errors, 0);
+    }
+  }
+
+  // Combined with a NUMA placement policy
+#if defined(__linux__)
+  Kokkos::HostSpace::HugePages saved = Kokkos::Impl::host_space_huge_pages();
+  Kokkos::Impl::host_space_set_huge_pages(Kokkos::HostSpace::HUGE_PAGES_THP);
+  Kokkos::HostSpace thp_numa_space(Kokkos::HostSpace::NUMA_INTERLEAVE);
+  Kokkos::Impl::host_space_set_huge_pages(saved);
+  ASSERT_EQ(thp_numa_space.huge_pages(), Kokkos::HostSpace::HUGE_PAGES_THP);
+
+  view_type c(Kokkos::view_alloc("HugePages", thp_numa_space), 1 << 20);
+  Kokkos::deep_copy(c, 4.0);
+  ASSERT_EQ(c(0), 4.0);
+  ASSERT_EQ(c((1 << 20) - 1), 4.0);
+#endif
+}
+
+TEST(TEST_CATEGORY, host_space_alloc_cache) {
+  using view_type = Kokkos::View<int*, Kokkos::HostSpace>;
+
+  const size_t saved = Kokkos::Impl::host_space_cache_threshold();
+  Kokkos::Impl::host_space_cache_set_threshold(size_t(1) << 16);
+  Kokkos::HostSpace space;
+  Kokkos::Impl::host_space_cache_set_threshold(saved);
+
+  const Kokkos::Experimental::HostSpaceCacheStats before =
+      Kokkos::Experimental::host_space_cache_stats();
+
+  // Repeated short-lived small Views of varying size, the first one of
+  // each size class misses and the following ones reuse its block.
+  const int repeat = 10;
+  for (int r = 0; r < repeat; ++r) {
+    for (int n : {1, 100, 1000, 10000}) {
+      view_type a(Kokkos::view_alloc("AllocCache", space), n);
+      Kokkos::deep_copy(a, r);
+      ASSERT_EQ(a(n - 1), r);
+    }
+  }
+  // Above the threshold
+  { view_type a(Kokkos::view_alloc("AllocCache", space), 100000); }
+
+  const Kokkos::Experimental::HostSpaceCacheStats after =
+      Kokkos::Experimental::host_space_cache_stats();
+
+  ASSERT_EQ(after.allocations - before.allocations, size_t(4 * repeat));
+  ASSERT_EQ(after.deallocations - before.deallocations, size_t(4 * repeat));
+  ASSERT_GE(after.hits - before.hits, size_t(4 * (repeat - 1)));
+  ASSERT_GT(after.cached_bytes, 0u);
+
+  // The threshold captured by the View's space decides where it is freed
+  view_type b(Kokkos::view_alloc("AllocCache", space), 10);
+  b = view_type(Kokkos::view_alloc("AllocCache", Kokkos::HostSpace()), 10);
+  ASSERT_EQ(Kokkos::Experimental::host_space_cache_stats().deallocations -
+                after.deallocations,
+            1u);
+
+  // The path of each block is recorded when it is allocated, a space
+  // configured differently returns it the same way
+  Kokkos::HostSpace uncached_space;
+  void* cached = space.allocate(1000);
+  uncached_space.deallocate(cached, 1000);
+  ASSERT_EQ(Kokkos::Experimental::host_space_cache_stats().deallocations -
+                after.deallocations,
+            2u);
+  void* uncached = uncached_space.allocate(1000);
+  space.deallocate(uncached, 1000);
+  ASSERT_EQ(Kokkos::Experimental::host_space_cache_stats().deallocations -
+                after.deallocations,
+            2u);
+  Kokkos::HostSpace thp_space(Kokkos::HostSpace::HUGE_PAGES_THP);
+  void* huge = thp_space.allocate(size_t(1) << 22);
+  space.deallocate(huge, size_t(1) << 22);
+
+  // Blocks cached by other live threads are released as well
+  std::thread([&] {
+    void* other = space.allocate(1000);
+    space.deallocate(other, 1000);
+    Kokkos::Impl::host_space_cache_release();
+    ASSERT_EQ(Kokkos::Experimental::host_space_cache_stats().cached_bytes,
+              0u);
+
+    other = space.allocate(1000);
+    space.deallocate(other, 1000);
+    ASSERT_GT(Kokkos::Experimental::host_space_cache_stats().cached_bytes,
+              0u);
+  }).join();
+  Kokkos::Impl::host_space_cache_release();
+  ASSERT_EQ(Kokkos::Experimental::host_space_cache_stats().cached_bytes, 0u);
+}
+
+TEST(TEST_CATEGORY, host_space_stream_copy_fill) {
+  const ptrdiff_t n = (ptrdiff_t(1) << 20) + 13;
+  std::vector<char> src(n + 64), dst(n + 64);
+  for (ptrdiff_t i = 0; i < n + 64; ++i) src[i] = char(i * 7 + 1);
+
+  // Misaligned source and destination with unaligned length
+  for (int src_offset : {0, 3, 32}) {
+    for (int dst_offset : {0, 5, 63}) {
+      std::fill(dst.begin(), dst.end(), char(0));
+      Kokkos::Impl::hostspace_stream_copy(dst.data() + dst_offset,
+                                          src.data() + src_offset, n);
+      int errors = 0;
+      for (ptrdiff_t i = 0; i < n; ++i) {
+        if (dst[dst_offset + i] != src[src_offset + i]) ++errors;
+      }
+      ASSERT_EQ(errors, 0);
+      ASSERT_EQ(dst[dst_offset + n], char(0));
+    }
+  }
+
+  // Values of every size dividing a cache line
+  struct value16 {
+    int64_t a, b;
+  };
+  const value16 value = {0x0102030405060708, 0x1112131415161718};
+  for (size_t value_size : {1, 2, 4, 8, 16}) {
+    for (int dst_offset : {0, 2, 48}) {
+      std::fill(dst.begin(), dst.end(), char(0));
+      const ptrdiff_t bytes = (n / value_size) * value_size;
+      Kokkos::Impl::hostspace_stream_fill(dst.data() + dst_offset, &value,
+                                          value_size, bytes);
+      int errors = 0;
+      for (ptrdiff_t i = 0; i < bytes; ++i) {
+        if (dst[dst_offset + i] !=
+            reinterpret_cast<const char*>(&value)[i % value_size])
+          ++errors;
+      }
+      ASSERT_EQ(errors, 0);
+      ASSERT_EQ(dst[dst_offset + bytes], char(0));
+    }
+  }
+
+  // deep_copy of Views above the streaming limit, unless the last level
+  // cache makes them too large for a unit test
+  if (Kokkos::Impl::hostspace_streaming_limit() > (ptrdiff_t(1) << 27)) return;
+
+  using view_type = Kokkos::View<double*, Kokkos::HostSpace>;
+  const size_t m  = Kokkos::Impl::hostspace_streaming_limit() / 8 + 3;
+  view_type a(Kokkos::view_alloc("StreamA", Kokkos::WithoutInitializing), m);
+  view_type b(Kokkos::view_alloc("StreamB", Kokkos::WithoutInitializing), m);
+  Kokkos::deep_copy(a, 1.5);
+  Kokkos::deep_copy(b, a);
+  int errors = 0;
+  for (size_t i = 0; i < m; ++i) {
+    if (b(i) != 1.5) ++errors;
+  }
+  ASSERT_EQ(errors, 0);
+}
+
 }  // namespace Test
 
 #endif
@@ -0,0 +1,207 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+// This file tests the built-in tuner enabled through KOKKOS_TUNING_FILE
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <Kokkos_Core.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* results_file = "kokkos_test_tuning.txt";
+
+// Returns the number of samples recorded for a problem
+long samples_of(const std::string& problem) {
+  std::ifstream in(results_file);
+  const std::string prefix = problem + '\t';
+  std::string line;
+  long samples = 0;
+  while (std::getline(in, line)) {
+    if (line.compare(0, prefix.size(), prefix) == 0) {
+      const auto field = line.find('\t', prefix.size()) + 1;
+      samples += std::stol(line.substr(field));
+    }
+  }
+  return samples;
+}
+
+// Returns the values of the points recorded for a problem
+std::vector<std::string> points_of(const std::string& problem) {
+  std::ifstream in(results_file);
+  const std::string prefix = problem + '\t';
+  std::string line;
+  std::vector<std::string> points;
+  while (std::getline(in, line)) {
+    if (line.compare(0, prefix.size(), prefix) == 0) {
+      points.push_back(line.substr(
+          prefix.size(), line.find('\t', prefix.size()) - prefix.size()));
+    }
+  }
+  return points;
+}
+
+// Only the value 2 is cheap, the tuner must settle on it
+void spend_time_unless_two(int64_t value) {
+  if (value == 2) return;
+  const auto start = std::chrono::steady_clock::now();
+  while (std::chrono::steady_clock::now() - start <
+         std::chrono::microseconds(200)) {
+  }
+}
+
+}  // namespace
+
+int main() {
+  {
+    std::ofstream out(results_file);
+    out << "earlier_run_chunk_size\t8\t3\t0.5\t1.5\n";
+  }
+  setenv("KOKKOS_TUNING_FILE", results_file, 1);
+  unsetenv("KOKKOS_PROFILE_LIBRARY");
+  Kokkos::InitArguments arguments;
+  arguments.tune_internals = true;
+  Kokkos::initialize(arguments);
+  size_t num_tile_candidates = 0;
+  {
+    using execution_space = Kokkos::DefaultHostExecutionSpace;
+    Kokkos::View<long*, execution_space> view("tuned", 10000);
+    for (int repeat = 0; repeat < 40; ++repeat) {
+      Kokkos::parallel_for(
+          "tuned_for", Kokkos::RangePolicy<execution_space>(0, 10000),
+          KOKKOS_LAMBDA(int i) { view(i) += i; });
+    }
+    long sum = 0;
+    Kokkos::parallel_reduce(
+        "tuned_reduce", Kokkos::RangePolicy<execution_space>(0, 10000),
+        KOKKOS_LAMBDA(int i, long& update) { update += view(i); }, sum);
+    if (sum != 40L * 9999 * 10000 / 2) {
+      throw std::runtime_error("Wrong result of the tuned kernels");
+    }
+
+    // MDRangeTuner picks one of the policy's tile candidates, numbered
+    // from one, and the kernel still covers the whole range
+    using mdrange_type =
+        Kokkos::MDRangePolicy<execution_space, Kokkos::Rank<2>>;
+    const mdrange_type mdrange({0, 0}, {100, 100});
+    num_tile_candidates = mdrange.impl_tile_size_candidates().size();
+    Kokkos::View<long**, execution_space> grid("tuned_grid", 100, 100);
+    for (int repeat = 0; repeat < 20; ++repeat) {
+      Kokkos::parallel_for(
+          "tuned_mdrange", mdrange,
+          KOKKOS_LAMBDA(int i, int j) { grid(i, j) += 1; });
+    }
+    long grid_sum = 0;
+    Kokkos::parallel_reduce(
+        "grid_sum", Kokkos::RangePolicy<execution_space>(0, 100),
+        KOKKOS_LAMBDA(int i, long& update) {
+          for (int j = 0; j < 100; ++j) update += grid(i, j);
+        },
+        grid_sum);
+    if (grid_sum != 20L * 100 * 100) {
+      throw std::runtime_error("Wrong result of the tuned MDRange kernel");
+    }
+
+    // A problem declared by the application
+    using namespace Kokkos::Tools::Experimental;
+    int64_t candidates[] = {1, 2, 3};
+    VariableInfo info;
+    info.type          = ValueType::kokkos_value_int64;
+    info.category      = StatisticalCategory::kokkos_value_ordinal;
+    info.valueQuantity = CandidateValueType::kokkos_value_set;
+    info.candidates    = make_candidate_set(3, candidates);
+    const size_t id    = declare_output_type("application_choice", info);
+    int fastest = 0;
+    for (int repeat = 0; repeat < 60; ++repeat) {
+      const size_t context = get_new_context_id();
+      begin_context(context);
+      VariableValue value = make_variable_value(id, int64_t(0));
+      request_output_values(context, 1, &value);
+      if (value.value.int_value < 1 || value.value.int_value > 3) {
+        throw std::runtime_error("The tuner chose an invalid value");
+      }
+      spend_time_unless_two(value.value.int_value);
+      end_context(context);
+      // Each value is timed twice first, then the fastest one is used
+      // except for the occasional exploration
+      if (repeat >= 10 && value.value.int_value == 2) ++fastest;
+    }
+    if (fastest < 40) {
+      throw std::runtime_error("The tuner did not settle on the fastest value");
+    }
+  }
+  Kokkos::finalize();
+
+  // The chunk size problems are named after the power of two of the length
+  if (samples_of("tuned_for_chunk_size_log2_13") != 40 ||
+      samples_of("tuned_reduce_chunk_size_log2_13") != 1 ||
+      samples_of("application_choice") != 60 ||
+      samples_of("earlier_run_chunk_size") != 3) {
+    throw std::runtime_error("Tuning results are missing samples");
+  }
+  if (samples_of("tuned_mdrange_tile_shape") != 20) {
+    throw std::runtime_error("Tuning results are missing MDRange samples");
+  }
+  for (const auto& point : points_of("tuned_mdrange_tile_shape")) {
+    const long index = std::stol(point);
+    if (std::to_string(index) != point || index < 1 ||
+        size_t(index) > num_tile_candidates) {
+      throw std::runtime_error("Wrong MDRange tile candidate index");
+    }
+  }
+  // The points searched are the chunk sizes themselves
+  for (const auto& point : points_of("tuned_for_chunk_size_log2_13")) {
+    const long chunk = std::stol(point);
+    if (std::to_string(chunk) != point || chunk < 1 ||
+        (chunk & (chunk - 1)) != 0) {
+      throw std::runtime_error("Chunk size candidates are not powers of two");
+    }
+  }
+  std::remove(results_file);
+}
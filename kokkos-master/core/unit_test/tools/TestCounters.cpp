@@ -0,0 +1,105 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+// This file tests the built-in hardware counter tool enabled through
+// KOKKOS_PROFILE_COUNTERS
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <Kokkos_Core.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+const char* counter_file = "kokkos_test_counters.csv";
+
+// Returns the calls column of the summary line of a label
+int calls_of(const std::string& type, const std::string& name) {
+  std::ifstream in(counter_file);
+  const std::string prefix = type + ",\"" + name + "\",";
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.compare(0, prefix.size(), prefix) == 0) {
+      return std::stoi(line.substr(prefix.size()));
+    }
+  }
+  return 0;
+}
+
+}  // namespace
+
+int main() {
+  std::remove(counter_file);
+  setenv("KOKKOS_PROFILE_COUNTERS", counter_file, 1);
+  unsetenv("KOKKOS_PROFILE_LIBRARY");
+  Kokkos::initialize();
+  {
+    using execution_space = Kokkos::DefaultHostExecutionSpace;
+    Kokkos::View<double*, execution_space> view("counted", 1000);
+    Kokkos::Profiling::pushRegion("counted_region");
+    for (int repeat = 0; repeat < 3; ++repeat) {
+      Kokkos::parallel_for(
+          "counted_for", Kokkos::RangePolicy<execution_space>(0, 1000),
+          KOKKOS_LAMBDA(int i) { view(i) += i; });
+    }
+    double sum = 0;
+    Kokkos::parallel_reduce(
+        "counted_reduce", Kokkos::RangePolicy<execution_space>(0, 1000),
+        KOKKOS_LAMBDA(int i, double& update) { update += view(i); }, sum);
+    Kokkos::Profiling::popRegion();
+    if (sum != 3 * 999 * 1000 / 2) {
+      throw std::runtime_error("Wrong result of the counted reduction");
+    }
+  }
+  Kokkos::finalize();
+
+  if (calls_of("parallel_for", "counted_for") != 3 ||
+      calls_of("parallel_reduce", "counted_reduce") != 1 ||
+      calls_of("region", "counted_region") != 1) {
+    throw std::runtime_error("Counter summary is missing kernels or regions");
+  }
+  std::remove(counter_file);
+}
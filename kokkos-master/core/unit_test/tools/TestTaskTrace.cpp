@@ -0,0 +1,170 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+// This file tests the task scheduler tracing enabled through
+// KOKKOS_TASK_TRACE
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <Kokkos_Core.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#if defined(KOKKOS_ENABLE_TASKDAG) && \
+    (defined(KOKKOS_ENABLE_OPENMP) || defined(KOKKOS_ENABLE_SERIAL))
+
+namespace {
+
+const char* trace_file = "kokkos_test_task_trace.json";
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+using execution_space = Kokkos::OpenMP;
+#else
+using execution_space = Kokkos::Serial;
+#endif
+using scheduler_type = Kokkos::ChaseLevTaskScheduler<execution_space>;
+
+struct TracedFib {
+  using value_type  = long;
+  using future_type = Kokkos::BasicFuture<long, scheduler_type>;
+
+  future_type dep[2];
+  const value_type n;
+
+  KOKKOS_INLINE_FUNCTION
+  TracedFib(const value_type arg_n) : dep{}, n(arg_n) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(scheduler_type::member_type& member, value_type& result) {
+    auto& sched = member.scheduler();
+    if (n < 2) {
+      result = n;
+    } else if (!dep[0].is_null() && !dep[1].is_null()) {
+      result = dep[0].get() + dep[1].get();
+    } else {
+      dep[1] = Kokkos::task_spawn(Kokkos::TaskSingle(sched), TracedFib(n - 2));
+      dep[0] = Kokkos::task_spawn(Kokkos::TaskSingle(sched), TracedFib(n - 1));
+      auto fib_all = sched.when_all(dep, 2);
+      if (dep[0].is_null() || dep[1].is_null() || fib_all.is_null()) {
+        Kokkos::abort("TracedFib insufficient memory");
+      }
+      Kokkos::respawn(this, fib_all);
+    }
+  }
+};
+
+// Number of tasks spawned and respawned to compute fib(n)
+uint64_t fib_spawns(long n) {
+  return n < 2 ? 1 : 1 + fib_spawns(n - 1) + fib_spawns(n - 2);
+}
+
+uint64_t fib_respawns(long n) {
+  return n < 2 ? 0 : 1 + fib_respawns(n - 1) + fib_respawns(n - 2);
+}
+
+void check(bool condition, const char* message) {
+  if (!condition) throw std::runtime_error(message);
+}
+
+}  // namespace
+
+int main() {
+  constexpr long n = 12;
+  std::remove(trace_file);
+  setenv("KOKKOS_TASK_TRACE", trace_file, 1);
+  Kokkos::initialize();
+  {
+    scheduler_type sched(scheduler_type::memory_space(), 1 << 20, 64, 1024,
+                         4096);
+    {
+      auto f = Kokkos::host_spawn(Kokkos::TaskSingle(sched), TracedFib(n));
+      Kokkos::wait(sched);
+      check(f.get() == 144, "Wrong result of the traced task DAG");
+    }
+
+    auto counters = Kokkos::Tools::Experimental::get_task_trace_counters();
+    const uint64_t tasks = fib_spawns(n) + fib_respawns(n);
+    check(counters.spawned == fib_spawns(n), "Wrong number of spawned tasks");
+    check(counters.respawned == fib_respawns(n),
+          "Wrong number of respawned tasks");
+    check(counters.executed == tasks, "Wrong number of executed tasks");
+    check(counters.became_ready == tasks, "Wrong number of ready tasks");
+    // One allocation per spawn and one per when_all
+    check(counters.allocations == tasks, "Wrong number of allocations");
+    check(counters.failed_allocations == 0, "Unexpected failed allocations");
+    check(counters.allocated_bytes == 0, "Task memory was not released");
+    check(counters.peak_allocated_bytes > 0 &&
+              counters.peak_allocated_bytes <= counters.pool_capacity,
+          "Wrong peak of allocated task memory");
+    check(counters.dropped_events == 0, "Unexpected dropped trace events");
+    check(counters.max_queue_wait_time <= counters.queue_wait_time,
+          "Wrong queue wait times");
+  }
+  Kokkos::finalize();
+
+  std::ifstream in(trace_file);
+  std::stringstream trace;
+  trace << in.rdbuf();
+  const std::string text = trace.str();
+  check(text.find("\"traceEvents\":[") != std::string::npos,
+        "Task trace is not a trace event file");
+  size_t runs  = 0;
+  size_t found = text.find("\"ph\":\"X\"");
+  while (found != std::string::npos) {
+    ++runs;
+    found = text.find("\"ph\":\"X\"", found + 1);
+  }
+  check(runs == fib_spawns(n) + fib_respawns(n),
+        "Task trace is missing task runs");
+  std::remove(trace_file);
+}
+
+#else
+
+int main() {}
+
+#endif
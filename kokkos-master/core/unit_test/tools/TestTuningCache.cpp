@@ -0,0 +1,187 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+// This file tests the tuning cache enabled through KOKKOS_TUNING_CACHE: a
+// first process tunes with the built-in tuner and fills the cache, a second
+// one without any tuning tool gets its answers from the cache
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <Kokkos_Core.hpp>
+#include <stdexcept>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+const char* cache_file   = "kokkos_test_tuning_cache.txt";
+const char* results_file = "kokkos_test_tuning_cache_results.txt";
+
+using namespace Kokkos::Tools::Experimental;
+
+int64_t candidates[] = {10, 20, 30};
+
+size_t declare_choice(const char* name = "cached_choice") {
+  VariableInfo info;
+  info.type          = ValueType::kokkos_value_int64;
+  info.category      = StatisticalCategory::kokkos_value_ordinal;
+  info.valueQuantity = CandidateValueType::kokkos_value_set;
+  info.candidates    = make_candidate_set(3, candidates);
+  return declare_output_type(name, info);
+}
+
+int64_t request_choice(size_t id, int64_t size) {
+  const size_t context = get_new_context_id();
+  begin_context(context);
+  VariableValue input =
+      make_variable_value(get_problem_size_context_variable_id(), size);
+  set_input_values(context, 1, &input);
+  VariableValue value = make_variable_value(id, int64_t(0));
+  request_output_values(context, 1, &value);
+  end_context(context);
+  return value.value.int_value;
+}
+
+void run_kernels() {
+  using execution_space = Kokkos::DefaultHostExecutionSpace;
+  Kokkos::View<long*, execution_space> view("cached", 10000);
+  for (int repeat = 0; repeat < 100; ++repeat) {
+    Kokkos::parallel_for(
+        "cached_for", Kokkos::RangePolicy<execution_space>(0, 10000),
+        KOKKOS_LAMBDA(int i) { view(i) += i; });
+  }
+  long sum = 0;
+  Kokkos::parallel_reduce(
+      "cached_reduce", Kokkos::RangePolicy<execution_space>(0, 10000),
+      KOKKOS_LAMBDA(int i, long& update) { update += view(i); }, sum);
+  if (sum != 100L * 9999 * 10000 / 2) {
+    throw std::runtime_error("Wrong result of the tuned kernels");
+  }
+}
+
+// Returns the values stored for a key
+std::string cached_values(const std::string& key) {
+  std::ifstream in(cache_file);
+  std::string line;
+  std::getline(in, line);
+  if (line != "# Kokkos tuning cache, version 1") return "";
+  while (std::getline(in, line)) {
+    const auto key_begin = line.find('\t') + 1;
+    const auto key_end   = line.find('\t', key_begin);
+    if (line.compare(key_begin, key_end - key_begin, key) == 0) {
+      return line.substr(key_end + 1, line.find('\t', key_end + 1) - key_end -
+                                          1);
+    }
+  }
+  return "";
+}
+
+void tune() {
+  setenv("KOKKOS_TUNING_FILE", results_file, 1);
+  Kokkos::InitArguments arguments;
+  arguments.tune_internals = true;
+  Kokkos::initialize(arguments);
+  run_kernels();
+  const size_t id = declare_choice();
+  for (int repeat = 0; repeat < 40; ++repeat) request_choice(id, 1000);
+  // Too few requests for the search to settle, nothing is cached
+  const size_t unsettled = declare_choice("unsettled_choice");
+  for (int repeat = 0; repeat < 3; ++repeat) request_choice(unsettled, 1000);
+  Kokkos::finalize();
+}
+
+void reuse() {
+  unsetenv("KOKKOS_TUNING_FILE");
+  Kokkos::InitArguments arguments;
+  arguments.tune_internals = true;
+  Kokkos::initialize(arguments);
+  if (!have_tuning_tool()) {
+    throw std::runtime_error("The tuning cache does not answer requests");
+  }
+  run_kernels();
+  const size_t id = declare_choice();
+  // 600 and 1000 round to the same power of two, 5000 was never tuned
+  const int64_t cached = request_choice(id, 600);
+  const int64_t missed = request_choice(id, 5000);
+  Kokkos::finalize();
+  if (std::to_string(cached) != cached_values("cached_choice;"
+                                              "kokkos.problem_size=2^10") ||
+      missed != 0) {
+    throw std::runtime_error("Wrong answers from the tuning cache");
+  }
+}
+
+}  // namespace
+
+int main() {
+  std::remove(cache_file);
+  std::remove(results_file);
+  setenv("KOKKOS_TUNING_CACHE", cache_file, 1);
+  unsetenv("KOKKOS_PROFILE_LIBRARY");
+
+  // Kokkos can only be initialized once per process
+  const pid_t child = fork();
+  if (child == 0) {
+    tune();
+    std::exit(0);
+  }
+  int status = 1;
+  waitpid(child, &status, 0);
+  if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    throw std::runtime_error("Tuning process failed");
+  }
+  if (cached_values("cached_for_chunk_size_log2_13;kokkos.problem_size=2^14")
+          .empty()) {
+    throw std::runtime_error("Tuning cache is missing the tuned kernel");
+  }
+  if (!cached_values("unsettled_choice;kokkos.problem_size=2^10").empty()) {
+    throw std::runtime_error("Tuning cache stored an exploratory answer");
+  }
+  reuse();
+
+  std::remove(cache_file);
+  std::remove(results_file);
+}